@@ -22,6 +22,7 @@
 #define VARIANT_RAJA_TEAMS_SEQ       1
 #define VARIANT_RAJA_VECTOR          1
 #define VARIANT_RAJA_MATRIX          1
+#define VARIANT_RAJA_MATRIX_MULTIPLY 1
 #define VARIANT_RAJA_SEQ_SHMEM       1
 
 #if defined(RAJA_ENABLE_OPENMP)
@@ -775,6 +776,65 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 #endif
 
 
+//----------------------------------------------------------------------------//
+
+#if VARIANT_RAJA_MATRIX_MULTIPLY
+{
+  std::cout << "\n Running RAJA blocked matrix multiply version of LTimes...\n";
+
+  std::memset(phi_data, 0, phi_size * sizeof(double));
+
+  //
+  // For each group, phi(:, g, :) += L * psi(:, g, :), with the same data
+  // layout as the C-version. Each group's slice is viewed as a matrix.
+  //
+  using MatrixView = RAJA::View<double, Layout<2, int>>;
+
+  std::array<RAJA::idx_t, 2> col_perm {{1, 0}};
+
+  MatrixView L(L_data,
+               RAJA::make_permuted_layout({{num_m, num_d}}, col_perm));
+
+  RAJA::Timer timer;
+  timer.start();
+
+  for (int iter = 0;iter < num_iter;++ iter){
+    for (int g = 0; g < num_g; ++g) {
+      MatrixView psi(psi_data + g*num_z*num_d,
+                     RAJA::make_permuted_layout({{num_d, num_z}}, col_perm));
+      MatrixView phi(phi_data + g*num_z*num_m,
+                     RAJA::make_permuted_layout({{num_m, num_z}}, col_perm));
+
+      RAJA::expt::matrix_multiply<seq_exec>(num_m, num_z, num_d,
+                                            L, psi, phi, 1.0, 1.0);
+    }
+  }
+
+  timer.stop();
+  double t = timer.elapsed();
+  double gflop_rate = total_flops / t / 1.0e9;
+  std::cout << "  RAJA blocked matrix multiply version of LTimes run time (sec.): "
+            << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+
+#if defined(DEBUG_LTIMES)
+  using LView = TypedView<double, Layout<2, int, 0>, IM, ID>;
+  using PsiView = TypedView<double, Layout<3, int, 0>, ID, IG, IZ>;
+  using PhiView = TypedView<double, Layout<3, int, 0>, IM, IG, IZ>;
+
+  std::array<RAJA::idx_t, 3> group_perm {{1, 2, 0}};
+  LView L_check(L_data,
+                RAJA::make_permuted_layout({{num_m, num_d}}, col_perm));
+  PsiView psi_check(psi_data,
+                    RAJA::make_permuted_layout({{num_d, num_g, num_z}}, group_perm));
+  PhiView phi_check(phi_data,
+                    RAJA::make_permuted_layout({{num_m, num_g, num_z}}, group_perm));
+
+  checkResult(phi_check, L_check, psi_check, num_m, num_d, num_g, num_z);
+#endif
+}
+#endif
+
+
 //----------------------------------------------------------------------------//
 #if VARIANT_RAJA_SEQ_SHMEM
 {
@@ -0,0 +1,86 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Atomic benchmarks: atomic adds into a small contended histogram and into
+// one location per element.
+//
+
+#include "microbenchmark.hpp"
+
+namespace raja_microbenchmark
+{
+
+namespace
+{
+
+using range_type = RAJA::TypedRangeSegment<RAJA::Index_type>;
+
+template <typename EXEC_POL, typename ATOMIC_POL, typename T>
+void register_atomic_type(std::string const& pol_name, Sizes const& sizes)
+{
+  const std::string type_name = TypeName<T>::get();
+
+  register_sized(make_name({"atomic", "add_histogram_16", pol_name, type_name}),
+                 sizes,
+                 [](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    const std::vector<int> bins = make_random_data<int>(n, 16);
+    std::vector<T> hist(16, T(0));
+    const int* bins_ptr = bins.data();
+    T* hist_ptr = hist.data();
+
+    run_kernel(state, n, sizeof(int), [&]() {
+      RAJA::forall<EXEC_POL>(range_type(0, n), [=](RAJA::Index_type i) {
+        RAJA::atomicAdd<ATOMIC_POL>(&hist_ptr[bins_ptr[i]], T(1));
+      });
+    });
+  });
+
+  register_sized(make_name({"atomic", "add_spread", pol_name, type_name}),
+                 sizes,
+                 [](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    std::vector<T> y(n, T(0));
+    T* y_ptr = y.data();
+
+    run_kernel(state, n, 2.0 * sizeof(T), [&]() {
+      RAJA::forall<EXEC_POL>(range_type(0, n), [=](RAJA::Index_type i) {
+        RAJA::atomicAdd<ATOMIC_POL>(&y_ptr[i], T(1));
+      });
+    });
+  });
+}
+
+template <typename EXEC_POL, typename ATOMIC_POL>
+void register_atomic_policy(std::string const& pol_name, Sizes const& sizes)
+{
+  register_atomic_type<EXEC_POL, ATOMIC_POL, int>(pol_name, sizes);
+  register_atomic_type<EXEC_POL, ATOMIC_POL, double>(pol_name, sizes);
+}
+
+}  // namespace
+
+void register_atomic_benchmarks(Sizes const& sizes)
+{
+  register_atomic_policy<RAJA::seq_exec, RAJA::seq_atomic>(
+      "seq_atomic", sizes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  register_atomic_policy<RAJA::omp_parallel_for_exec, RAJA::omp_atomic>(
+      "omp_atomic", sizes);
+  register_atomic_policy<RAJA::omp_parallel_for_exec, RAJA::builtin_atomic>(
+      "omp_builtin_atomic", sizes);
+#endif
+
+#if defined(RAJA_ENABLE_THREADS)
+  register_atomic_policy<RAJA::threads_exec, RAJA::builtin_atomic>(
+      "threads_builtin_atomic", sizes);
+#endif
+}
+
+}  // namespace raja_microbenchmark
@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// forall benchmarks: streaming copy and daxpy kernels.
+//
+
+#include "microbenchmark.hpp"
+
+namespace raja_microbenchmark
+{
+
+namespace
+{
+
+template <typename EXEC_POL, typename T>
+void register_forall_type(std::string const& pol_name, Sizes const& sizes)
+{
+  const std::string type_name = TypeName<T>::get();
+
+  register_sized(make_name({"forall", "copy", pol_name, type_name}), sizes,
+                 [](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    std::vector<T> x(n, T(1));
+    std::vector<T> y(n, T(0));
+    const T* x_ptr = x.data();
+    T* y_ptr = y.data();
+
+    run_kernel(state, n, 2.0 * sizeof(T), [&]() {
+      RAJA::forall<EXEC_POL>(RAJA::TypedRangeSegment<RAJA::Index_type>(0, n),
+                             [=](RAJA::Index_type i) { y_ptr[i] = x_ptr[i]; });
+    });
+  });
+
+  register_sized(make_name({"forall", "daxpy", pol_name, type_name}), sizes,
+                 [](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    std::vector<T> x(n, T(1));
+    std::vector<T> y(n, T(0));
+    const T a = T(2);
+    const T* x_ptr = x.data();
+    T* y_ptr = y.data();
+
+    run_kernel(state, n, 3.0 * sizeof(T), [&]() {
+      RAJA::forall<EXEC_POL>(RAJA::TypedRangeSegment<RAJA::Index_type>(0, n),
+                             [=](RAJA::Index_type i) {
+        y_ptr[i] += a * x_ptr[i];
+      });
+    });
+  });
+}
+
+template <typename EXEC_POL>
+void register_forall_policy(std::string const& pol_name, Sizes const& sizes)
+{
+  register_forall_type<EXEC_POL, int>(pol_name, sizes);
+  register_forall_type<EXEC_POL, float>(pol_name, sizes);
+  register_forall_type<EXEC_POL, double>(pol_name, sizes);
+}
+
+}  // namespace
+
+void register_forall_benchmarks(Sizes const& sizes)
+{
+  register_forall_policy<RAJA::seq_exec>("seq_exec", sizes);
+  register_forall_policy<RAJA::simd_exec>("simd_exec", sizes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  register_forall_policy<RAJA::omp_parallel_for_exec>(
+      "omp_parallel_for_exec", sizes);
+  register_forall_policy<RAJA::omp_parallel_for_static_exec<>>(
+      "omp_parallel_for_static_exec", sizes);
+  register_forall_policy<RAJA::omp_parallel_for_dynamic_exec<1024>>(
+      "omp_parallel_for_dynamic_exec_1024", sizes);
+  register_forall_policy<RAJA::omp_parallel_ws_exec<>>(
+      "omp_parallel_ws_exec", sizes);
+#endif
+
+#if defined(RAJA_ENABLE_THREADS)
+  register_forall_policy<RAJA::threads_exec>("threads_exec", sizes);
+#endif
+}
+
+}  // namespace raja_microbenchmark
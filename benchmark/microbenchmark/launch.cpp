@@ -0,0 +1,106 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Launch benchmarks: host launch back-ends running a 1D daxpy and a 2D copy
+// with the outer loop spread over the team and the inner loop sequential.
+//
+
+#include "microbenchmark.hpp"
+
+namespace raja_microbenchmark
+{
+
+namespace
+{
+
+//! number of columns in the 2D copy
+constexpr RAJA::Index_type num_cols = 1024;
+
+using range_type = RAJA::TypedRangeSegment<RAJA::Index_type>;
+
+template <typename LAUNCH_POL, typename LOOP_POL, typename T>
+void register_launch_type(std::string const& pol_name, Sizes const& sizes)
+{
+  using launch_policy = RAJA::LaunchPolicy<LAUNCH_POL>;
+  using outer_loop = RAJA::LoopPolicy<LOOP_POL>;
+  using inner_loop = RAJA::LoopPolicy<RAJA::seq_exec>;
+
+  const std::string type_name = TypeName<T>::get();
+
+  register_sized(make_name({"launch", "daxpy", pol_name, type_name}),
+                 sizes,
+                 [](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    std::vector<T> x(n, T(1));
+    std::vector<T> y(n, T(2));
+    const T a = T(3);
+    const T* x_ptr = x.data();
+    T* y_ptr = y.data();
+
+    run_kernel(state, n, 3.0 * sizeof(T), [&]() {
+      RAJA::launch<launch_policy>(
+          RAJA::LaunchParams(), [=](RAJA::LaunchContext ctx) {
+        RAJA::loop<outer_loop>(ctx, range_type(0, n), [&](RAJA::Index_type i) {
+          y_ptr[i] += a * x_ptr[i];
+        });
+      });
+    });
+  });
+
+  register_sized(make_name({"launch", "copy_2d", pol_name, type_name}),
+                 sizes,
+                 [](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    const RAJA::Index_type num_rows = (n + num_cols - 1) / num_cols;
+    const RAJA::Index_type len = num_rows * num_cols;
+    std::vector<T> x(len, T(1));
+    std::vector<T> y(len, T(0));
+    const T* x_ptr = x.data();
+    T* y_ptr = y.data();
+
+    run_kernel(state, len, 2.0 * sizeof(T), [&]() {
+      RAJA::launch<launch_policy>(
+          RAJA::LaunchParams(), [=](RAJA::LaunchContext ctx) {
+        RAJA::loop<outer_loop>(ctx, range_type(0, num_rows),
+                               [&](RAJA::Index_type r) {
+          RAJA::loop<inner_loop>(ctx, range_type(0, num_cols),
+                                 [&](RAJA::Index_type c) {
+            y_ptr[r * num_cols + c] = x_ptr[r * num_cols + c];
+          });
+        });
+      });
+    });
+  });
+}
+
+template <typename LAUNCH_POL, typename LOOP_POL>
+void register_launch_policy(std::string const& pol_name, Sizes const& sizes)
+{
+  register_launch_type<LAUNCH_POL, LOOP_POL, float>(pol_name, sizes);
+  register_launch_type<LAUNCH_POL, LOOP_POL, double>(pol_name, sizes);
+}
+
+}  // namespace
+
+void register_launch_benchmarks(Sizes const& sizes)
+{
+  register_launch_policy<RAJA::seq_launch_t, RAJA::seq_exec>(
+      "seq_launch_t", sizes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  register_launch_policy<RAJA::omp_launch_t, RAJA::omp_for_exec>(
+      "omp_launch_t", sizes);
+#endif
+
+#if defined(RAJA_ENABLE_THREADS)
+  register_launch_policy<RAJA::threads_launch_t, RAJA::threads_for_exec>(
+      "threads_launch_t", sizes);
+#endif
+}
+
+}  // namespace raja_microbenchmark
@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// RAJA microbenchmark suite.
+//
+// Benchmarks forall, reductions, multi-reductions, scans, sorts, atomics,
+// WorkGroup, and launch with the host policies enabled in the build, over
+// several data types and problem sizes. Benchmark names have the form
+//
+//   <feature>/<kernel>/<policy>/<type>/<size>
+//
+// Results can be written in machine readable form with the google benchmark
+// options, for example
+//
+//   raja-microbenchmark.exe --benchmark_out=raja.json --benchmark_out_format=json
+//   raja-microbenchmark.exe --benchmark_format=csv > raja.csv
+//
+// and results from two builds compared with the google benchmark
+// tools/compare.py script. --benchmark_filter=<regex> selects benchmarks.
+//
+// The problem sizes are set with the options
+//
+//   --size_min=<n>   smallest problem size (default 1024)
+//   --size_max=<n>   largest problem size (default 1048576)
+//   --size_mult=<n>  multiplier between sizes (default 32)
+//
+
+#include "microbenchmark.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+
+//! remove the size options from argv and store them in sizes
+bool parse_size_options(int& argc, char** argv,
+                        raja_microbenchmark::Sizes& sizes)
+{
+  int out = 1;
+  for (int i = 1; i < argc; ++i) {
+    const char* arg = argv[i];
+    if (std::strncmp(arg, "--size_min=", 11) == 0) {
+      sizes.min = std::atol(arg + 11);
+    } else if (std::strncmp(arg, "--size_max=", 11) == 0) {
+      sizes.max = std::atol(arg + 11);
+    } else if (std::strncmp(arg, "--size_mult=", 12) == 0) {
+      sizes.mult = std::atoi(arg + 12);
+    } else {
+      argv[out++] = argv[i];
+    }
+  }
+  argc = out;
+
+  if (sizes.min < 1 || sizes.max < sizes.min || sizes.mult < 2) {
+    std::cerr << "invalid sizes: --size_min=" << sizes.min
+              << " --size_max=" << sizes.max
+              << " --size_mult=" << sizes.mult << std::endl;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  raja_microbenchmark::Sizes sizes;
+  if (!parse_size_options(argc, argv, sizes)) {
+    return 1;
+  }
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  raja_microbenchmark::register_forall_benchmarks(sizes);
+  raja_microbenchmark::register_reduce_benchmarks(sizes);
+  raja_microbenchmark::register_multi_reduce_benchmarks(sizes);
+  raja_microbenchmark::register_scan_benchmarks(sizes);
+  raja_microbenchmark::register_sort_benchmarks(sizes);
+  raja_microbenchmark::register_atomic_benchmarks(sizes);
+  raja_microbenchmark::register_workgroup_benchmarks(sizes);
+  raja_microbenchmark::register_launch_benchmarks(sizes);
+
+  benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
@@ -0,0 +1,168 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Shared helpers for the RAJA microbenchmark suite.
+//
+// Each benchmark runs one RAJA kernel per iteration. Only the kernel is timed,
+// setup done between iterations (for example restoring unsorted data) is
+// excluded. Every benchmark reports these counters:
+//
+//   elements     number of elements processed by one kernel
+//   ns_per_elem  kernel time per element in nanoseconds
+//   GB_per_s     bytes moved by the kernel per second, in 1e9 bytes
+//
+// in addition to the google benchmark items_per_second and bytes_per_second.
+//
+
+#ifndef RAJA_MICROBENCHMARK_HPP
+#define RAJA_MICROBENCHMARK_HPP
+
+#include "RAJA/RAJA.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace raja_microbenchmark
+{
+
+//! problem sizes used by every benchmark
+struct Sizes {
+  RAJA::Index_type min = 1 << 10;
+  RAJA::Index_type max = 1 << 20;
+  int mult = 32;
+};
+
+//! name used for a data type in benchmark names
+template <typename T>
+struct TypeName;
+
+template <>
+struct TypeName<int> {
+  static const char* get() { return "int"; }
+};
+
+template <>
+struct TypeName<long> {
+  static const char* get() { return "long"; }
+};
+
+template <>
+struct TypeName<float> {
+  static const char* get() { return "float"; }
+};
+
+template <>
+struct TypeName<double> {
+  static const char* get() { return "double"; }
+};
+
+//! join the parts of a benchmark name with '/'
+inline std::string make_name(std::initializer_list<std::string> parts)
+{
+  std::string name;
+  for (std::string const& part : parts) {
+    if (!name.empty()) {
+      name += '/';
+    }
+    name += part;
+  }
+  return name;
+}
+
+/*!
+ * \brief  Register func(benchmark::State&) under name for every size.
+ */
+template <typename Func>
+void register_sized(std::string const& name, Sizes const& sizes, Func&& func)
+{
+  benchmark::RegisterBenchmark(name.c_str(), std::forward<Func>(func))
+      ->RangeMultiplier(sizes.mult)
+      ->Range(sizes.min, sizes.max)
+      ->UseRealTime()
+      ->Unit(benchmark::kMicrosecond);
+}
+
+/*!
+ * \brief  Time kernel() once per benchmark iteration, calling setup() before
+ *         each untimed, and set the suite counters for n elements and
+ *         bytes_per_elem bytes moved per element.
+ */
+template <typename Setup, typename Kernel>
+void run_kernel(benchmark::State& state,
+                RAJA::Index_type n,
+                double bytes_per_elem,
+                Setup&& setup,
+                Kernel&& kernel)
+{
+  using clock = std::chrono::steady_clock;
+
+  double kernel_seconds = 0.0;
+  for (auto _ : state) {
+    setup();
+    const clock::time_point start = clock::now();
+    kernel();
+    benchmark::ClobberMemory();
+    const clock::time_point stop = clock::now();
+    kernel_seconds += std::chrono::duration<double>(stop - start).count();
+  }
+
+  const double elems = static_cast<double>(n) * state.iterations();
+  state.SetItemsProcessed(static_cast<int64_t>(elems));
+  state.SetBytesProcessed(static_cast<int64_t>(elems * bytes_per_elem));
+  state.counters["elements"] = static_cast<double>(n);
+  if (elems > 0.0 && kernel_seconds > 0.0) {
+    state.counters["ns_per_elem"] = kernel_seconds * 1.0e9 / elems;
+    state.counters["GB_per_s"] = elems * bytes_per_elem / kernel_seconds * 1.0e-9;
+  }
+}
+
+template <typename Kernel>
+void run_kernel(benchmark::State& state,
+                RAJA::Index_type n,
+                double bytes_per_elem,
+                Kernel&& kernel)
+{
+  run_kernel(state, n, bytes_per_elem, []() {}, std::forward<Kernel>(kernel));
+}
+
+//! deterministic pseudo random values in [0, range)
+template <typename T>
+std::vector<T> make_random_data(RAJA::Index_type n, unsigned range)
+{
+  std::vector<T> data(n);
+  unsigned long long x = 0x9E3779B97F4A7C15ull;
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    data[i] = static_cast<T>(x % range);
+  }
+  return data;
+}
+
+//
+// Registration functions, one per benchmarked feature.
+//
+void register_forall_benchmarks(Sizes const& sizes);
+void register_reduce_benchmarks(Sizes const& sizes);
+void register_multi_reduce_benchmarks(Sizes const& sizes);
+void register_scan_benchmarks(Sizes const& sizes);
+void register_sort_benchmarks(Sizes const& sizes);
+void register_atomic_benchmarks(Sizes const& sizes);
+void register_workgroup_benchmarks(Sizes const& sizes);
+void register_launch_benchmarks(Sizes const& sizes);
+
+}  // namespace raja_microbenchmark
+
+#endif  // closing endif for header file include guard
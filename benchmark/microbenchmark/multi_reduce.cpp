@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Multi-reduction benchmarks: binned sum, min, and max with few and many
+// bins.
+//
+
+#include "microbenchmark.hpp"
+
+#include <limits>
+
+namespace raja_microbenchmark
+{
+
+namespace
+{
+
+using range_type = RAJA::TypedRangeSegment<RAJA::Index_type>;
+
+template <typename EXEC_POL, typename MULTI_REDUCE_POL, typename T>
+void register_multi_reduce_bins(std::string const& pol_name,
+                                int num_bins,
+                                Sizes const& sizes)
+{
+  const std::string type_name = TypeName<T>::get();
+  const std::string bins_name = "bins_" + std::to_string(num_bins);
+
+  register_sized(make_name({"multi_reduce", "sum", bins_name, pol_name, type_name}),
+                 sizes,
+                 [num_bins](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    std::vector<T> x = make_random_data<T>(n, 1000);
+    std::vector<int> bins = make_random_data<int>(n, num_bins);
+    const T* x_ptr = x.data();
+    const int* bins_ptr = bins.data();
+
+    run_kernel(state, n, sizeof(T) + sizeof(int), [&]() {
+      RAJA::MultiReduceSum<MULTI_REDUCE_POL, T> r(num_bins, T(0));
+      RAJA::forall<EXEC_POL>(range_type(0, n), [=](RAJA::Index_type i) {
+        r[bins_ptr[i]] += x_ptr[i];
+      });
+      benchmark::DoNotOptimize(r.get(0));
+    });
+  });
+
+  register_sized(make_name({"multi_reduce", "min", bins_name, pol_name, type_name}),
+                 sizes,
+                 [num_bins](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    std::vector<T> x = make_random_data<T>(n, 1000);
+    std::vector<int> bins = make_random_data<int>(n, num_bins);
+    const T* x_ptr = x.data();
+    const int* bins_ptr = bins.data();
+
+    run_kernel(state, n, sizeof(T) + sizeof(int), [&]() {
+      RAJA::MultiReduceMin<MULTI_REDUCE_POL, T> r(num_bins,
+                                                  std::numeric_limits<T>::max());
+      RAJA::forall<EXEC_POL>(range_type(0, n), [=](RAJA::Index_type i) {
+        r[bins_ptr[i]].min(x_ptr[i]);
+      });
+      benchmark::DoNotOptimize(r.get(0));
+    });
+  });
+
+  register_sized(make_name({"multi_reduce", "max", bins_name, pol_name, type_name}),
+                 sizes,
+                 [num_bins](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    std::vector<T> x = make_random_data<T>(n, 1000);
+    std::vector<int> bins = make_random_data<int>(n, num_bins);
+    const T* x_ptr = x.data();
+    const int* bins_ptr = bins.data();
+
+    run_kernel(state, n, sizeof(T) + sizeof(int), [&]() {
+      RAJA::MultiReduceMax<MULTI_REDUCE_POL, T> r(num_bins,
+                                                  std::numeric_limits<T>::lowest());
+      RAJA::forall<EXEC_POL>(range_type(0, n), [=](RAJA::Index_type i) {
+        r[bins_ptr[i]].max(x_ptr[i]);
+      });
+      benchmark::DoNotOptimize(r.get(0));
+    });
+  });
+}
+
+template <typename EXEC_POL, typename MULTI_REDUCE_POL>
+void register_multi_reduce_policy(std::string const& pol_name,
+                                  Sizes const& sizes)
+{
+  for (int num_bins : {16, 1024}) {
+    register_multi_reduce_bins<EXEC_POL, MULTI_REDUCE_POL, int>(
+        pol_name, num_bins, sizes);
+    register_multi_reduce_bins<EXEC_POL, MULTI_REDUCE_POL, double>(
+        pol_name, num_bins, sizes);
+  }
+}
+
+}  // namespace
+
+void register_multi_reduce_benchmarks(Sizes const& sizes)
+{
+  register_multi_reduce_policy<RAJA::seq_exec, RAJA::seq_multi_reduce>(
+      "seq_multi_reduce", sizes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  register_multi_reduce_policy<RAJA::omp_parallel_for_exec,
+                               RAJA::omp_multi_reduce>(
+      "omp_multi_reduce", sizes);
+  register_multi_reduce_policy<RAJA::omp_parallel_for_exec,
+                               RAJA::omp_multi_reduce_ordered>(
+      "omp_multi_reduce_ordered", sizes);
+  register_multi_reduce_policy<RAJA::omp_parallel_for_exec,
+                               RAJA::omp_multi_reduce_combine_in_parallel>(
+      "omp_multi_reduce_combine_in_parallel", sizes);
+#endif
+}
+
+}  // namespace raja_microbenchmark
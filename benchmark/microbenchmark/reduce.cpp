@@ -0,0 +1,216 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Reduction benchmarks: every reducer type with each reduction policy, and
+// the forall param reductions with each execution policy.
+//
+
+#include "microbenchmark.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace raja_microbenchmark
+{
+
+namespace
+{
+
+using range_type = RAJA::TypedRangeSegment<RAJA::Index_type>;
+
+/*!
+ * \brief  Register a reduction kernel, kernel(n, x) runs the reduction over
+ *         x[0, n) and returns its result.
+ */
+template <typename T, typename Kernel>
+void register_reduce(std::string const& kernel_name,
+                     std::string const& pol_name,
+                     Sizes const& sizes,
+                     Kernel kernel)
+{
+  register_sized(make_name({"reduce", kernel_name, pol_name, TypeName<T>::get()}),
+                 sizes,
+                 [kernel](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    std::vector<T> x = make_random_data<T>(n, 1000);
+    const T* x_ptr = x.data();
+
+    run_kernel(state, n, sizeof(T), [&]() {
+      benchmark::DoNotOptimize(kernel(n, x_ptr));
+    });
+  });
+}
+
+template <typename EXEC_POL, typename REDUCE_POL, typename T>
+void register_reducer_bitwise(std::string const&, Sizes const&, std::false_type)
+{
+}
+
+template <typename EXEC_POL, typename REDUCE_POL, typename T>
+void register_reducer_bitwise(std::string const& pol_name,
+                              Sizes const& sizes,
+                              std::true_type)
+{
+  register_reduce<T>("bitor", pol_name, sizes,
+                     [](RAJA::Index_type n, const T* x) {
+    RAJA::ReduceBitOr<REDUCE_POL, T> r(T(0));
+    RAJA::forall<EXEC_POL>(range_type(0, n), [=](RAJA::Index_type i) {
+      r |= x[i];
+    });
+    return r.get();
+  });
+
+  register_reduce<T>("bitand", pol_name, sizes,
+                     [](RAJA::Index_type n, const T* x) {
+    RAJA::ReduceBitAnd<REDUCE_POL, T> r(~T(0));
+    RAJA::forall<EXEC_POL>(range_type(0, n), [=](RAJA::Index_type i) {
+      r &= x[i];
+    });
+    return r.get();
+  });
+}
+
+template <typename EXEC_POL, typename REDUCE_POL, typename T>
+void register_reducer_type(std::string const& pol_name, Sizes const& sizes)
+{
+  register_reduce<T>("sum", pol_name, sizes,
+                     [](RAJA::Index_type n, const T* x) {
+    RAJA::ReduceSum<REDUCE_POL, T> r(T(0));
+    RAJA::forall<EXEC_POL>(range_type(0, n), [=](RAJA::Index_type i) {
+      r += x[i];
+    });
+    return r.get();
+  });
+
+  register_reduce<T>("min", pol_name, sizes,
+                     [](RAJA::Index_type n, const T* x) {
+    RAJA::ReduceMin<REDUCE_POL, T> r(std::numeric_limits<T>::max());
+    RAJA::forall<EXEC_POL>(range_type(0, n), [=](RAJA::Index_type i) {
+      r.min(x[i]);
+    });
+    return r.get();
+  });
+
+  register_reduce<T>("max", pol_name, sizes,
+                     [](RAJA::Index_type n, const T* x) {
+    RAJA::ReduceMax<REDUCE_POL, T> r(std::numeric_limits<T>::lowest());
+    RAJA::forall<EXEC_POL>(range_type(0, n), [=](RAJA::Index_type i) {
+      r.max(x[i]);
+    });
+    return r.get();
+  });
+
+  register_reduce<T>("minloc", pol_name, sizes,
+                     [](RAJA::Index_type n, const T* x) {
+    RAJA::ReduceMinLoc<REDUCE_POL, T> r(std::numeric_limits<T>::max(), -1);
+    RAJA::forall<EXEC_POL>(range_type(0, n), [=](RAJA::Index_type i) {
+      r.minloc(x[i], i);
+    });
+    return r.getLoc();
+  });
+
+  register_reduce<T>("maxloc", pol_name, sizes,
+                     [](RAJA::Index_type n, const T* x) {
+    RAJA::ReduceMaxLoc<REDUCE_POL, T> r(std::numeric_limits<T>::lowest(), -1);
+    RAJA::forall<EXEC_POL>(range_type(0, n), [=](RAJA::Index_type i) {
+      r.maxloc(x[i], i);
+    });
+    return r.getLoc();
+  });
+
+  register_reducer_bitwise<EXEC_POL, REDUCE_POL, T>(
+      pol_name, sizes, typename std::is_integral<T>::type{});
+}
+
+template <typename EXEC_POL, typename REDUCE_POL>
+void register_reducer_policy(std::string const& pol_name, Sizes const& sizes)
+{
+  register_reducer_type<EXEC_POL, REDUCE_POL, int>(pol_name, sizes);
+  register_reducer_type<EXEC_POL, REDUCE_POL, double>(pol_name, sizes);
+}
+
+template <typename EXEC_POL, typename T>
+void register_param_reduce_type(std::string const& pol_name, Sizes const& sizes)
+{
+  using VALOP_SUM = RAJA::expt::ValOp<T, RAJA::operators::plus>;
+  using VALOP_MIN = RAJA::expt::ValOp<T, RAJA::operators::minimum>;
+  using VALLOC = RAJA::expt::ValLoc<T, RAJA::Index_type>;
+  using VALOPLOC_MAX =
+      RAJA::expt::ValLocOp<T, RAJA::Index_type, RAJA::operators::maximum>;
+
+  register_reduce<T>("param_sum", pol_name, sizes,
+                     [](RAJA::Index_type n, const T* x) {
+    T sum = T(0);
+    RAJA::forall<EXEC_POL>(range_type(0, n),
+        RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+        [=](RAJA::Index_type i, VALOP_SUM& _sum) {
+      _sum += x[i];
+    });
+    return sum;
+  });
+
+  register_reduce<T>("param_min", pol_name, sizes,
+                     [](RAJA::Index_type n, const T* x) {
+    T min = std::numeric_limits<T>::max();
+    RAJA::forall<EXEC_POL>(range_type(0, n),
+        RAJA::expt::Reduce<RAJA::operators::minimum>(&min),
+        [=](RAJA::Index_type i, VALOP_MIN& _min) {
+      _min.min(x[i]);
+    });
+    return min;
+  });
+
+  register_reduce<T>("param_maxloc", pol_name, sizes,
+                     [](RAJA::Index_type n, const T* x) {
+    VALLOC maxloc(std::numeric_limits<T>::lowest(), -1);
+    RAJA::forall<EXEC_POL>(range_type(0, n),
+        RAJA::expt::Reduce<RAJA::operators::maximum>(&maxloc),
+        [=](RAJA::Index_type i, VALOPLOC_MAX& _maxloc) {
+      _maxloc.maxloc(x[i], i);
+    });
+    return maxloc.getLoc();
+  });
+}
+
+template <typename EXEC_POL>
+void register_param_reduce_policy(std::string const& pol_name,
+                                  Sizes const& sizes)
+{
+  register_param_reduce_type<EXEC_POL, int>(pol_name, sizes);
+  register_param_reduce_type<EXEC_POL, double>(pol_name, sizes);
+}
+
+}  // namespace
+
+void register_reduce_benchmarks(Sizes const& sizes)
+{
+  register_reducer_policy<RAJA::seq_exec, RAJA::seq_reduce>(
+      "seq_reduce", sizes);
+  register_param_reduce_policy<RAJA::seq_exec>("seq_exec", sizes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  register_reducer_policy<RAJA::omp_parallel_for_exec, RAJA::omp_reduce>(
+      "omp_reduce", sizes);
+  register_reducer_policy<RAJA::omp_parallel_for_exec,
+                          RAJA::omp_reduce_ordered>(
+      "omp_reduce_ordered", sizes);
+  register_reducer_policy<RAJA::omp_parallel_for_exec,
+                          RAJA::omp_reduce_combine_on_get>(
+      "omp_reduce_combine_on_get", sizes);
+  register_param_reduce_policy<RAJA::omp_parallel_for_exec>(
+      "omp_parallel_for_exec", sizes);
+#endif
+
+#if defined(RAJA_ENABLE_THREADS)
+  register_reducer_policy<RAJA::threads_exec, RAJA::threads_reduce>(
+      "threads_reduce", sizes);
+  register_param_reduce_policy<RAJA::threads_exec>("threads_exec", sizes);
+#endif
+}
+
+}  // namespace raja_microbenchmark
@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Scan benchmarks: inclusive in-place and exclusive out-of-place sum scans.
+//
+
+#include "microbenchmark.hpp"
+
+#include <algorithm>
+
+namespace raja_microbenchmark
+{
+
+namespace
+{
+
+template <typename EXEC_POL, typename T>
+void register_scan_type(std::string const& pol_name, Sizes const& sizes)
+{
+  const std::string type_name = TypeName<T>::get();
+
+  register_sized(make_name({"scan", "inclusive_inplace", pol_name, type_name}),
+                 sizes,
+                 [](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    const std::vector<T> x_init = make_random_data<T>(n, 16);
+    std::vector<T> x(n);
+
+    run_kernel(state, n, 2.0 * sizeof(T),
+        [&]() { std::copy(x_init.begin(), x_init.end(), x.begin()); },
+        [&]() {
+      RAJA::inclusive_scan_inplace<EXEC_POL>(RAJA::make_span(x.data(), n));
+    });
+  });
+
+  register_sized(make_name({"scan", "exclusive", pol_name, type_name}),
+                 sizes,
+                 [](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    const std::vector<T> x = make_random_data<T>(n, 16);
+    std::vector<T> y(n);
+
+    run_kernel(state, n, 2.0 * sizeof(T), [&]() {
+      RAJA::exclusive_scan<EXEC_POL>(RAJA::make_span(x.data(), n),
+                                     RAJA::make_span(y.data(), n));
+    });
+  });
+}
+
+template <typename EXEC_POL>
+void register_scan_policy(std::string const& pol_name, Sizes const& sizes)
+{
+  register_scan_type<EXEC_POL, int>(pol_name, sizes);
+  register_scan_type<EXEC_POL, double>(pol_name, sizes);
+}
+
+}  // namespace
+
+void register_scan_benchmarks(Sizes const& sizes)
+{
+  register_scan_policy<RAJA::seq_exec>("seq_exec", sizes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  register_scan_policy<RAJA::omp_parallel_for_exec>(
+      "omp_parallel_for_exec", sizes);
+  register_scan_policy<RAJA::omp_parallel_for_scan_three_pass_exec>(
+      "omp_parallel_for_scan_three_pass_exec", sizes);
+  register_scan_policy<RAJA::omp_parallel_for_scan_single_pass_exec>(
+      "omp_parallel_for_scan_single_pass_exec", sizes);
+#endif
+
+#if defined(RAJA_ENABLE_THREADS)
+  register_scan_policy<RAJA::threads_exec>("threads_exec", sizes);
+#endif
+}
+
+}  // namespace raja_microbenchmark
@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Sort benchmarks: sort, stable_sort, and sort_pairs of random keys. The
+// unsorted data is restored, untimed, before each iteration.
+//
+
+#include "microbenchmark.hpp"
+
+#include <algorithm>
+
+namespace raja_microbenchmark
+{
+
+namespace
+{
+
+template <typename EXEC_POL, typename T>
+void register_sort_type(std::string const& pol_name, Sizes const& sizes)
+{
+  const std::string type_name = TypeName<T>::get();
+
+  register_sized(make_name({"sort", "sort", pol_name, type_name}),
+                 sizes,
+                 [](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    const std::vector<T> keys_init = make_random_data<T>(n, 1u << 30);
+    std::vector<T> keys(n);
+
+    run_kernel(state, n, 2.0 * sizeof(T),
+        [&]() { std::copy(keys_init.begin(), keys_init.end(), keys.begin()); },
+        [&]() {
+      RAJA::sort<EXEC_POL>(RAJA::make_span(keys.data(), n));
+    });
+  });
+
+  register_sized(make_name({"sort", "stable_sort", pol_name, type_name}),
+                 sizes,
+                 [](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    const std::vector<T> keys_init = make_random_data<T>(n, 1u << 30);
+    std::vector<T> keys(n);
+
+    run_kernel(state, n, 2.0 * sizeof(T),
+        [&]() { std::copy(keys_init.begin(), keys_init.end(), keys.begin()); },
+        [&]() {
+      RAJA::stable_sort<EXEC_POL>(RAJA::make_span(keys.data(), n));
+    });
+  });
+
+  register_sized(make_name({"sort", "sort_pairs", pol_name, type_name}),
+                 sizes,
+                 [](benchmark::State& state) {
+    const RAJA::Index_type n = state.range(0);
+    const std::vector<T> keys_init = make_random_data<T>(n, 1u << 30);
+    std::vector<T> keys(n);
+    std::vector<RAJA::Index_type> vals(n);
+
+    run_kernel(state, n, 2.0 * (sizeof(T) + sizeof(RAJA::Index_type)),
+        [&]() {
+          std::copy(keys_init.begin(), keys_init.end(), keys.begin());
+          for (RAJA::Index_type i = 0; i < n; ++i) {
+            vals[i] = i;
+          }
+        },
+        [&]() {
+      RAJA::sort_pairs<EXEC_POL>(RAJA::make_span(keys.data(), n),
+                                 RAJA::make_span(vals.data(), n));
+    });
+  });
+}
+
+template <typename EXEC_POL>
+void register_sort_policy(std::string const& pol_name, Sizes const& sizes)
+{
+  register_sort_type<EXEC_POL, int>(pol_name, sizes);
+  register_sort_type<EXEC_POL, double>(pol_name, sizes);
+}
+
+}  // namespace
+
+void register_sort_benchmarks(Sizes const& sizes)
+{
+  register_sort_policy<RAJA::seq_exec>("seq_exec", sizes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  register_sort_policy<RAJA::omp_parallel_for_exec>(
+      "omp_parallel_for_exec", sizes);
+#endif
+}
+
+}  // namespace raja_microbenchmark
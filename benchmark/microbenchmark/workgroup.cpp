@@ -0,0 +1,99 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// WorkGroup benchmarks: a halo exchange like pack of many short loops. Each
+// iteration enqueues the loops, instantiates the group, and runs it, so the
+// times include the WorkGroup overheads as well as the loops themselves.
+//
+
+#include "microbenchmark.hpp"
+
+#include <memory>
+
+namespace raja_microbenchmark
+{
+
+namespace
+{
+
+//! number of loops enqueued per WorkGroup
+constexpr int num_loops = 64;
+
+using range_type = RAJA::TypedRangeSegment<int>;
+
+template <typename WORK_POL, typename ORDER_POL, typename T>
+void register_workgroup_type(std::string const& pol_name, Sizes const& sizes)
+{
+  const std::string type_name = TypeName<T>::get();
+
+  register_sized(make_name({"workgroup", "pack_64_loops", pol_name, type_name}),
+                 sizes,
+                 [](benchmark::State& state) {
+    using workgroup_policy =
+        RAJA::WorkGroupPolicy<WORK_POL,
+                              ORDER_POL,
+                              RAJA::ragged_array_of_objects,
+                              RAJA::indirect_function_call_dispatch>;
+
+    using workpool = RAJA::
+        WorkPool<workgroup_policy, int, RAJA::xargs<>, std::allocator<char>>;
+    using workgroup = RAJA::
+        WorkGroup<workgroup_policy, int, RAJA::xargs<>, std::allocator<char>>;
+    using worksite = RAJA::
+        WorkSite<workgroup_policy, int, RAJA::xargs<>, std::allocator<char>>;
+
+    const RAJA::Index_type n = state.range(0);
+    const int loop_len = static_cast<int>(n / num_loops);
+    const std::vector<int> list = make_random_data<int>(n, n);
+    const std::vector<T> var = make_random_data<T>(n, 1024);
+    std::vector<T> buffer(n);
+
+    const int* list_ptr = list.data();
+    const T* var_ptr = var.data();
+
+    workpool pool(std::allocator<char>{});
+
+    run_kernel(state, n, 2.0 * sizeof(T) + sizeof(int), [&]() {
+      for (int l = 0; l < num_loops; ++l) {
+        T* buf = buffer.data() + l * loop_len;
+        const int* lst = list_ptr + l * loop_len;
+        pool.enqueue(range_type(0, loop_len), [=](int i) {
+          buf[i] = var_ptr[lst[i]];
+        });
+      }
+      workgroup group = pool.instantiate();
+      worksite site = group.run();
+      RAJA_UNUSED_VAR(site);
+    });
+  });
+}
+
+template <typename WORK_POL, typename ORDER_POL>
+void register_workgroup_policy(std::string const& pol_name, Sizes const& sizes)
+{
+  register_workgroup_type<WORK_POL, ORDER_POL, int>(pol_name, sizes);
+  register_workgroup_type<WORK_POL, ORDER_POL, double>(pol_name, sizes);
+}
+
+}  // namespace
+
+void register_workgroup_benchmarks(Sizes const& sizes)
+{
+  register_workgroup_policy<RAJA::seq_work, RAJA::ordered>(
+      "seq_work_ordered", sizes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  register_workgroup_policy<RAJA::omp_work, RAJA::ordered>(
+      "omp_work_ordered", sizes);
+  register_workgroup_policy<RAJA::omp_work,
+                            RAJA::unordered_omp_flattened_loop_iter>(
+      "omp_work_unordered_omp_flattened_loop_iter", sizes);
+#endif
+}
+
+}  // namespace raja_microbenchmark
@@ -143,9 +143,26 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   RAJA::View<int, RAJA::Layout<DIM, int, 1>> array_view_copy(d_array_copy, N, N);
   RAJA::View<int, RAJA::Layout<DIM, int, 1>> kernel_view(d_kernel, K, K);
 
+  // the image again, stored in 16 x 16 tiles so the blur's neighbors in
+  // both dimensions are close in memory
+  using tiled_layout = RAJA::TiledLayout<DIM, 16, int>;
+  tiled_layout tiled(N, N);
+  int* d_array_tiled = def_device_res.allocate<int>(tiled.size());
+  RAJA::View<int, tiled_layout> array_view_tiled(d_array_tiled, tiled);
+
+  timer.start();
+
+  RAJA::copy_view<device_pol>(array_view_tiled, array_view_copy);
+  def_device_res.wait();
+
+  timer.stop();
+
+  std::cout<<"Elapsed time converting to tiled RAJA view : "<<timer.elapsed()<<std::endl;
+
   RAJA::RangeSegment range_i(0, N);
   RAJA::RangeSegment range_j(0, N);
 
+  timer.reset();
   timer.start();
 
   RAJA::kernel<kernel_pol>
@@ -203,12 +220,42 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
   std::cout<<"Elapsed time with NO RAJA view : "<<timer.elapsed()<<std::endl;
 
+
+ timer.reset();
+ timer.start();
+
+  RAJA::kernel<kernel_pol>
+    (RAJA::make_tuple(range_i, range_j),
+     [=] RAJA_HOST_DEVICE (int i, int j) {
+      int sum = 0;
+
+      // looping through the "blur"
+      for (int m = 0; m < K; ++m) {
+	for (int n = 0; n < K; ++n) {
+	  int x = i + m;
+	  int y = j + n;
+
+	  // adding the "blur" to the "image" wherever the blur is located on the image
+	  if (x < N && y < N) {
+	    sum += kernel_view(m, n) * array_view_tiled(x, y);
+	  }
+	}
+      }
+
+      array_view_tiled(i, j) += sum;
+    }
+  );
+  timer.stop();
+
+  std::cout<<"Elapsed time with tiled RAJA view : "<<timer.elapsed()<<std::endl;
+
   def_device_res.memcpy(array, d_array, N * N * sizeof(int));
   def_device_res.memcpy(array_copy, d_array_copy, N * N * sizeof(int));
 
   def_device_res.deallocate(d_array);
   def_device_res.deallocate(d_array_copy);
   def_device_res.deallocate(d_kernel);
+  def_device_res.deallocate(d_array_tiled);
 
   def_host_res.deallocate(array);
   def_host_res.deallocate(array_copy);
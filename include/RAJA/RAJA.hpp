@@ -87,6 +87,11 @@
 #endif
 #endif
 
+#if defined(RAJA_ENABLE_THREADS)
+#include "RAJA/policy/threads.hpp"
+#include "RAJA/policy/host_async.hpp"
+#endif
+
 #if defined(RAJA_ENABLE_DESUL_ATOMICS)
     #include "RAJA/policy/desul.hpp"
 #endif
@@ -112,12 +117,16 @@
 //
 // Multidimensional layouts and views
 //
+#include "RAJA/util/FastDivisor.hpp"
 #include "RAJA/util/Layout.hpp"
 #include "RAJA/util/OffsetLayout.hpp"
 #include "RAJA/util/PermutedLayout.hpp"
 #include "RAJA/util/StaticLayout.hpp"
 #include "RAJA/util/IndexLayout.hpp"
+#include "RAJA/util/TiledLayout.hpp"
+#include "RAJA/util/MortonLayout.hpp"
 #include "RAJA/util/View.hpp"
+#include "RAJA/pattern/copy_view.hpp"
 
 
 //
@@ -135,6 +144,11 @@
 //
 #include "RAJA/pattern/atomic.hpp"
 
+//
+// NUMA first touch host allocation
+//
+#include "RAJA/util/FirstTouchAllocator.hpp"
+
 //
 // Shared memory view patterns
 //
@@ -197,6 +211,9 @@
 
 #include "RAJA/pattern/sort.hpp"
 
+#include "RAJA/pattern/compact.hpp"
+#include "RAJA/pattern/histogram.hpp"
+
 namespace RAJA {
 namespace expt{}
 //  // provide a RAJA::expt namespace for experimental work, but bring alias
@@ -23,6 +23,7 @@
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/Iterators.hpp"
 #include "RAJA/internal/RAJAVec.hpp"
 
@@ -30,6 +31,9 @@
 
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include <vector>
 
 namespace RAJA
 {
@@ -595,7 +599,7 @@ public:
   using value_type = RAJA::Index_type;
 
   //! create empty TypedIndexSet
-  RAJA_INLINE TypedIndexSet() : m_len(0) {}
+  RAJA_INLINE TypedIndexSet() : m_len(0), m_dep_graph_set(false) {}
 
   //! dtor cleans up segements that we own (none)
   RAJA_INLINE
@@ -609,6 +613,8 @@ public:
     segment_offsets = c.segment_offsets;
     segment_icounts = c.segment_icounts;
     m_len = c.m_len;
+    m_dep_graph = c.m_dep_graph;
+    m_dep_graph_set = c.m_dep_graph_set;
   }
 
   //! Swap function for copy-and-swap idiom (deep copy).
@@ -619,8 +625,108 @@ public:
     swap(segment_offsets, other.segment_offsets);
     swap(segment_icounts, other.segment_icounts);
     swap(m_len, other.m_len);
+    swap(m_dep_graph, other.m_dep_graph);
+    swap(m_dep_graph_set, other.m_dep_graph_set);
   }
 
+  //!  @name Segment dependency graph methods
+  ///
+  /// A dependency graph orders the execution of the segments for the
+  /// omp_taskgraph_segit segment iteration policy: a segment runs only after
+  /// every segment it depends on has completed. To set up a graph, call
+  /// initDependencyGraph() after all segments are added, add dependencies
+  /// with addSegmentDependency(), then call finalizeDependencyGraph().
+  ///
+  /// Adding segments after that discards the graph.
+  ///
+
+  //! Create a graph node for each segment, with no dependencies
+  void initDependencyGraph()
+  {
+    m_dep_graph.assign(segment_types.size(), DepGraphNode());
+    m_dep_graph_set = false;
+  }
+
+  //! Make segment segid wait for segment dep_segid to complete
+  void addSegmentDependency(int segid, int dep_segid)
+  {
+    const int num_seg = static_cast<int>(m_dep_graph.size());
+    if (segid < 0 || segid >= num_seg || dep_segid < 0 ||
+        dep_segid >= num_seg || segid == dep_segid) {
+      RAJA_ABORT_OR_THROW("TypedIndexSet invalid segment dependency");
+    }
+    m_dep_graph[dep_segid].addDepTask(segid);
+    m_dep_graph_set = false;
+  }
+
+  ///
+  /// Count the dependencies of each segment and check the graph is acyclic,
+  /// so every segment can run.
+  ///
+  void finalizeDependencyGraph()
+  {
+    const int num_seg = static_cast<int>(m_dep_graph.size());
+    if (num_seg != static_cast<int>(segment_types.size())) {
+      RAJA_ABORT_OR_THROW("TypedIndexSet dependency graph not initialized");
+    }
+
+    for (DepGraphNode &node : m_dep_graph) {
+      node.semaphoreReloadValue() = 0;
+    }
+    for (DepGraphNode const &node : m_dep_graph) {
+      for (int ii = 0; ii < node.numDepTasks(); ++ii) {
+        ++m_dep_graph[node.depTaskNum(ii)].semaphoreReloadValue();
+      }
+    }
+
+    // visit segments in a dependency respecting order, segments left
+    // unvisited are on a cycle
+    std::vector<int> count(num_seg);
+    std::vector<int> ready;
+    for (int i = 0; i < num_seg; ++i) {
+      count[i] = m_dep_graph[i].semaphoreReloadValue();
+      if (count[i] == 0) {
+        ready.push_back(i);
+      }
+    }
+    int visited = 0;
+    while (!ready.empty()) {
+      DepGraphNode const &node = m_dep_graph[ready.back()];
+      ready.pop_back();
+      ++visited;
+      for (int ii = 0; ii < node.numDepTasks(); ++ii) {
+        if (--count[node.depTaskNum(ii)] == 0) {
+          ready.push_back(node.depTaskNum(ii));
+        }
+      }
+    }
+    if (visited != num_seg) {
+      RAJA_ABORT_OR_THROW("TypedIndexSet dependency graph has a cycle");
+    }
+
+    m_dep_graph_set = true;
+  }
+
+  //! Check a finalized dependency graph covers all segments
+  bool dependencyGraphSet() const
+  {
+    return m_dep_graph_set && m_dep_graph.size() == segment_types.size();
+  }
+
+  //! Get the dependency graph node of segment segid
+  DepGraphNode const &getDepGraphNode(int segid) const
+  {
+    return m_dep_graph[segid];
+  }
+
+  //! Get the dependency graph nodes of all segments
+  std::vector<DepGraphNode> const &getDependencyGraph() const
+  {
+    return m_dep_graph;
+  }
+
+  //@}
+
 protected:
   RAJA_INLINE static size_t getNumTypes() { return 0; }
 
@@ -754,6 +860,12 @@ private:
 
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
+
+  //! dependency graph node of each segment
+  std::vector<DepGraphNode> m_dep_graph;
+
+  //! true when m_dep_graph has been finalized
+  bool m_dep_graph_set;
 };
 
 
@@ -84,11 +84,20 @@ void RAJASHAREDDLL_API buildIndexSetAligned(
  *        The method chunks a fastDim x midDim x slowDim mesh into blocks that 
  *        can be dependency-scheduled, removing need for lock constructs.
  *
+ *        For a 3D mesh (slowDim > 0) the segments are slabs of whole
+ *        planes and the index set dependency graph is set so that slabs
+ *        sharing a node plane never run concurrently; run it with the
+ *        omp_taskgraph_segit segment iteration policy. Slab boundaries
+ *        balance the zone costs when zoneCost is given and the number of
+ *        planes otherwise.
+ *
  *  \param iset reference to index set generated with range segments.
  *         Method assumes index set is empty (no segments). 
  *  \param fastDim "fast" block dimension (see above).
  *  \param midDim  "mid" block dimension (see above).
  *  \param slowDim "slow" block dimension (see above).
+ *  \param zoneCost optional cost of each zone, indexed
+ *         fast + fastDim * (mid + midDim * slow). Only used for 3D meshes.
  *
  ******************************************************************************
  */
@@ -96,7 +105,8 @@ void buildLockFreeBlockIndexset(
     RAJA::TypedIndexSet<RAJA::RangeSegment>& iset,
     int fastDim,
     int midDim,
-    int slowDim);
+    int slowDim,
+    const double* zoneCost = nullptr);
 
 /*!
  ******************************************************************************
@@ -21,10 +21,8 @@
 
 #include "RAJA/config.hpp"
 
-#include <atomic>
-#include <cstdlib>
 #include <iosfwd>
-#include <thread>
+#include <vector>
 
 #include "RAJA/util/types.hpp"
 
@@ -34,37 +32,22 @@ namespace RAJA
 /*!
  ******************************************************************************
  *
- * \brief  Class defining a simple semephore-based data structure for
- *         managing a node in a dependency graph.
+ * \brief  Class defining a node in a dependency graph of index set segments.
+ *
+ * A node holds the segments that depend on it (its "forward-dependencies")
+ * and the number of segments it depends on. The node holds no execution
+ * state, so a graph may be run any number of times and concurrently; the
+ * task graph execution policies keep their own per-run counters.
  *
  ******************************************************************************
  */
-class RAJA_ALIGNED_ATTR(256) DepGraphNode
+class DepGraphNode
 {
 public:
-  ///
-  /// Constants for total number of allowable dependent tasks
-  /// and alignment of semaphore value (should match cache
-  /// coherence page size?).
-  ///
-  /// These values may need to be set differently for different
-  /// algorithms and platforms. We haven't determined the best defaults yet!
-  ///
-  static const int _MaxDepTasks_ = 8;
-
   ///
   /// Default ctor initializes node to default state.
   ///
-  DepGraphNode()
-      : m_num_dep_tasks(0), m_semaphore_reload_value(0), m_semaphore_value(0)
-  {
-  }
-
-  ///
-  /// Get/set semaphore value; i.e., the current number of (unsatisfied)
-  /// dependencies that must be satisfied before this task can execute.
-  ///
-  std::atomic<int>& semaphoreValue() { return m_semaphore_value; }
+  DepGraphNode() : m_semaphore_reload_value(0) {}
 
   ///
   /// Get/set semaphore "reload" value; i.e., the total number of external
@@ -72,45 +55,25 @@ public:
   ///
   int& semaphoreReloadValue() { return m_semaphore_reload_value; }
 
-  ///
-  /// Ready this task to be used again
-  ///
-  void reset() { m_semaphore_value.store(m_semaphore_reload_value); }
-
-  ///
-  /// Satisfy one incoming dependency
-  ///
-  void satisfyOne()
-  {
-    if (m_semaphore_value > 0) {
-      --m_semaphore_value;
-    }
-  }
+  int semaphoreReloadValue() const { return m_semaphore_reload_value; }
 
   ///
-  /// Wait for all dependencies to be satisfied
+  /// Add a "forward-dependency" for this task; i.e., an external task that
+  /// cannot execute until this task completes.
   ///
-  void wait()
-  {
-    while (m_semaphore_value > 0) {
-      // TODO: an efficient wait would be better here, but the standard
-      // promise/future is not good enough
-      std::this_thread::yield();
-    }
-  }
+  void addDepTask(int task_num) { m_dep_task.push_back(task_num); }
 
   ///
-  /// Get/set the number of "forward-dependencies" for this task; i.e., the
-  /// number of external tasks that cannot execute until this task completes.
+  /// Get the number of "forward-dependencies" for this task.
   ///
-  int& numDepTasks() { return m_num_dep_tasks; }
+  int numDepTasks() const { return static_cast<int>(m_dep_task.size()); }
 
   ///
-  /// Get/set the forward dependency task number associated with the given
+  /// Get the forward dependency task number associated with the given
   /// index for this task. This is used to notify the appropriate external
   /// dependencies when this task completes.
   ///
-  int& depTaskNum(int tidx) { return m_dep_task[tidx]; }
+  int depTaskNum(int tidx) const { return m_dep_task[tidx]; }
 
   ///
   /// Print task graph object node data to given output stream.
@@ -118,10 +81,8 @@ public:
   void print(std::ostream& os) const;
 
 private:
-  int m_dep_task[_MaxDepTasks_];
-  int m_num_dep_tasks;
+  std::vector<int> m_dep_task;
   int m_semaphore_reload_value;
-  std::atomic<int> m_semaphore_value;
 };
 
 }  // namespace RAJA
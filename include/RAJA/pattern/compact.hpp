@@ -0,0 +1,540 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA compaction, partition, and unique
+*          declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_HPP
+#define RAJA_compact_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+
+inline namespace policy_by_value_interface
+{
+
+/*!
+******************************************************************************
+*
+* \brief  copy if execution pattern, copies the items of in that satisfy pred
+*         to out keeping their order
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container of output data
+* \param[in] pred unary predicate
+*
+* \return the number of items copied
+*
+* \note{The range of in must be separate from the range of out}
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename OutContainer,
+          typename Pred>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::ContainerDiff<InContainer>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+copy_if(ExecPolicy&& p,
+        Res r,
+        InContainer&& in,
+        OutContainer&& out,
+        Pred pred)
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  static_assert(type_traits::is_unary_function<Pred, bool, T>::value,
+                "Pred must model UnaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return 0;
+  }
+  return impl::compact::copy_if(r, std::forward<ExecPolicy>(p),
+                                begin(in), end(in), begin(out), pred);
+}
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename OutContainer,
+          typename Pred,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::ContainerDiff<InContainer>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<OutContainer>>
+copy_if(ExecPolicy&& p,
+        InContainer&& in,
+        OutContainer&& out,
+        Pred pred)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::copy_if(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  partition execution pattern, moves the items that satisfy pred
+*         before the items that do not
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] pred unary predicate
+*
+* \return the number of items that satisfy pred
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Pred>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::ContainerDiff<Container>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>>
+partition(ExecPolicy&& p,
+          Res r,
+          Container&& c,
+          Pred pred)
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_unary_function<Pred, bool, T>::value,
+                "Pred must model UnaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  if (begin(c) == end(c)) {
+    return 0;
+  }
+  return impl::compact::partition(r, std::forward<ExecPolicy>(p),
+                                  begin(c), end(c), pred);
+}
+///
+template <typename ExecPolicy,
+          typename Container,
+          typename Pred,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::ContainerDiff<Container>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>>
+partition(ExecPolicy&& p,
+          Container&& c,
+          Pred pred)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::partition(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable partition execution pattern, moves the items that satisfy
+*         pred before the items that do not keeping the order of each group
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] pred unary predicate
+*
+* \return the number of items that satisfy pred
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Pred>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::ContainerDiff<Container>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>>
+stable_partition(ExecPolicy&& p,
+                 Res r,
+                 Container&& c,
+                 Pred pred)
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_unary_function<Pred, bool, T>::value,
+                "Pred must model UnaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  if (begin(c) == end(c)) {
+    return 0;
+  }
+  return impl::compact::stable_partition(r, std::forward<ExecPolicy>(p),
+                                         begin(c), end(c), pred);
+}
+///
+template <typename ExecPolicy,
+          typename Container,
+          typename Pred,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::ContainerDiff<Container>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>>
+stable_partition(ExecPolicy&& p,
+                 Container&& c,
+                 Pred pred)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::stable_partition(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  unique execution pattern, keeps the first item of each run of
+*         equal consecutive items at the front of the container
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] eq binary predicate that compares items for equality
+*
+* \return the number of items kept
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename BinPred = operators::equal_to<RAJA::detail::ContainerVal<Container>>>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::ContainerDiff<Container>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>>
+unique(ExecPolicy&& p,
+       Res r,
+       Container&& c,
+       BinPred eq = BinPred{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_binary_function<BinPred, bool, T, T>::value,
+                "BinPred must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  if (begin(c) == end(c)) {
+    return 0;
+  }
+  return impl::compact::unique(r, std::forward<ExecPolicy>(p),
+                               begin(c), end(c), eq);
+}
+///
+template <typename ExecPolicy,
+          typename Container,
+          typename BinPred = operators::equal_to<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::ContainerDiff<Container>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>>
+unique(ExecPolicy&& p,
+       Container&& c,
+       BinPred eq = BinPred{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::unique(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      eq);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  unique by key execution pattern, keeps the first key and value of
+*         each run of equal consecutive keys at the front of the containers
+*
+* \param[in] p Execution policy
+* \param[in,out] keys Random-Access Container of keys
+* \param[in,out] vals Random-Access Container of values
+* \param[in] eq binary predicate that compares keys for equality
+*
+* \return the number of keys and values kept
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename ValContainer,
+          typename BinPred = operators::equal_to<RAJA::detail::ContainerVal<KeyContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::ContainerDiff<KeyContainer>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValContainer>>
+unique_by_key(ExecPolicy&& p,
+              Res r,
+              KeyContainer&& keys,
+              ValContainer&& vals,
+              BinPred eq = BinPred{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<KeyContainer>;
+  static_assert(type_traits::is_binary_function<BinPred, bool, T, T>::value,
+                "BinPred must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+  if (begin(keys) == end(keys)) {
+    return 0;
+  }
+  return impl::compact::unique_by_key(r, std::forward<ExecPolicy>(p),
+                                      begin(keys), end(keys), begin(vals),
+                                      eq);
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename ValContainer,
+          typename BinPred = operators::equal_to<RAJA::detail::ContainerVal<KeyContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::ContainerDiff<KeyContainer>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>,
+                      type_traits::is_range<ValContainer>>
+unique_by_key(ExecPolicy&& p,
+              KeyContainer&& keys,
+              ValContainer&& vals,
+              BinPred eq = BinPred{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::unique_by_key(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<ValContainer>(vals),
+      eq);
+}
+
+}  // end inline namespace policy_by_value_interface
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * copy_if
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<
+    RAJA::detail::ContainerDiff<camp::at_v<camp::list<Args...>, 0>>,
+    type_traits::is_execution_policy<ExecPolicy>>
+copy_if(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::copy_if<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<
+    RAJA::detail::ContainerDiff<camp::at_v<camp::list<Args...>, 0>>,
+    type_traits::is_execution_policy<ExecPolicy>,
+    type_traits::is_resource<Res>>
+copy_if(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::copy_if(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * partition
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<
+    RAJA::detail::ContainerDiff<camp::at_v<camp::list<Args...>, 0>>,
+    type_traits::is_execution_policy<ExecPolicy>>
+partition(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::partition<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<
+    RAJA::detail::ContainerDiff<camp::at_v<camp::list<Args...>, 0>>,
+    type_traits::is_execution_policy<ExecPolicy>,
+    type_traits::is_resource<Res>>
+partition(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::partition(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * stable_partition
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<
+    RAJA::detail::ContainerDiff<camp::at_v<camp::list<Args...>, 0>>,
+    type_traits::is_execution_policy<ExecPolicy>>
+stable_partition(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::stable_partition<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<
+    RAJA::detail::ContainerDiff<camp::at_v<camp::list<Args...>, 0>>,
+    type_traits::is_execution_policy<ExecPolicy>,
+    type_traits::is_resource<Res>>
+stable_partition(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::stable_partition(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * unique
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<
+    RAJA::detail::ContainerDiff<camp::at_v<camp::list<Args...>, 0>>,
+    type_traits::is_execution_policy<ExecPolicy>>
+unique(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::unique<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<
+    RAJA::detail::ContainerDiff<camp::at_v<camp::list<Args...>, 0>>,
+    type_traits::is_execution_policy<ExecPolicy>,
+    type_traits::is_resource<Res>>
+unique(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::unique(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * unique_by_key
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<
+    RAJA::detail::ContainerDiff<camp::at_v<camp::list<Args...>, 0>>,
+    type_traits::is_execution_policy<ExecPolicy>>
+unique_by_key(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::unique_by_key<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<
+    RAJA::detail::ContainerDiff<camp::at_v<camp::list<Args...>, 0>>,
+    type_traits::is_execution_policy<ExecPolicy>,
+    type_traits::is_resource<Res>>
+unique_by_key(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::unique_by_key(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,138 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA copy_view, which copies the values
+ *          of one View into another View with a different layout.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_copy_view_HPP
+#define RAJA_pattern_copy_view_HPP
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Loop body of copy_view, called for each entry of the destination storage.
+ * Entries that are padding in the destination layout are left unchanged.
+ */
+template <typename DstLayout,
+          typename DstPtr,
+          typename SrcLayout,
+          typename SrcPtr,
+          typename Range>
+struct CopyViewBody;
+
+template <typename DstLayout,
+          typename DstPtr,
+          typename SrcLayout,
+          typename SrcPtr,
+          camp::idx_t... Dims>
+struct CopyViewBody<DstLayout, DstPtr, SrcLayout, SrcPtr,
+                    camp::idx_seq<Dims...>> {
+
+  using IdxLin = typename DstLayout::IndexLinear;
+
+  DstLayout dst_layout;
+  DstPtr dst_data;
+  SrcLayout src_layout;
+  SrcPtr src_data;
+
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(IdxLin lin) const
+  {
+    IdxLin idx[sizeof...(Dims)];
+    dst_layout.toIndices(lin, idx[Dims]...);
+
+    bool in_bounds = true;
+    int in_bounds_arr[] = {0, (in_bounds = in_bounds &&
+        (dst_layout.template get_dim_size<Dims>() == 0 ||
+         idx[Dims] < dst_layout.template get_dim_size<Dims>()), 0)...};
+    RAJA_UNUSED_VAR(in_bounds_arr);
+
+    if (in_bounds) {
+      dst_data[lin] = src_data[src_layout(idx[Dims]...)];
+    }
+  }
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Copy the values of src into dst, which have the same sizes but
+ *        may have different layouts.
+ *
+ * This converts data between strided storage and tiled or Morton storage,
+ * see RAJA::TiledLayout and RAJA::MortonLayout. The loop runs over the
+ * storage of dst with ExecPolicy, so each entry of dst is written once and
+ * in order, and the padding in dst is not written. The views must use
+ * layouts with untyped indices that start at 0.
+ *
+ * For example:
+ *
+ *     View<double, Layout<2>> a(a_data, N, N);
+ *     TiledLayout<2, 8> tiled(N, N);
+ *     View<double, TiledLayout<2, 8>> b(b_data, tiled);
+ *
+ *     copy_view<omp_parallel_for_exec>(b, a);
+ */
+template <typename ExecPolicy, typename Res, typename DstView, typename SrcView>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_resource<Res>>
+copy_view(Res r, DstView const& dst, SrcView const& src)
+{
+  using DstLayout = camp::decay<decltype(dst.get_layout())>;
+  using SrcLayout = camp::decay<decltype(src.get_layout())>;
+  using DstPtr = camp::decay<decltype(dst.get_data())>;
+  using SrcPtr = camp::decay<decltype(src.get_data())>;
+  using IdxLin = typename DstLayout::IndexLinear;
+
+  static_assert(DstLayout::n_dims == SrcLayout::n_dims,
+                "views must have the same number of dimensions");
+
+  detail::CopyViewBody<DstLayout, DstPtr, SrcLayout, SrcPtr,
+                       typename DstLayout::IndexRange>
+      body{dst.get_layout(), dst.get_data(), src.get_layout(), src.get_data()};
+
+  return forall<ExecPolicy>(
+      r, TypedRangeSegment<IdxLin>(0, dst.get_layout().size()), body);
+}
+///
+template <typename ExecPolicy,
+          typename DstView,
+          typename SrcView,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE resources::EventProxy<Res> copy_view(DstView const& dst,
+                                                 SrcView const& src)
+{
+  auto r = Res::get_default();
+  return copy_view<ExecPolicy>(r, dst, src);
+}
+
+}  // namespace RAJA
+
+#endif
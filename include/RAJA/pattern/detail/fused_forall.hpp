@@ -0,0 +1,381 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Internal header for RAJA fused forall bodies, barriers, and
+ *         stage execution shared by the fused forall policy
+ *         implementations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_FUSED_FORALL_HPP
+#define RAJA_PATTERN_DETAIL_FUSED_FORALL_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/params/forall.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+ * Fuse the bodies of a stage per iteration, each iteration runs every body
+ * of the stage in order before the next iteration.
+ */
+struct fuse_interleave {
+};
+
+/*!
+ * Fuse the bodies of a stage per tile, each tile of TileSize iterations
+ * runs each body of the stage over the whole tile in order before the next
+ * tile, so the data of a tile stays in cache between bodies.
+ */
+template <camp::idx_t TileSize>
+struct fuse_tile {
+  static_assert(TileSize > 0, "fuse_tile TileSize must be positive");
+  static constexpr camp::idx_t tile_size = TileSize;
+};
+
+/*!
+ * Dependency between the bodies before and after it in a fused forall,
+ * every iteration of the bodies before it finishes before any iteration of
+ * the bodies after it starts.
+ */
+struct FusedBarrier {
+  using params_type = ForallParamPack<>;
+};
+
+/*!
+ * A loop body of a fused forall with its forall params, such as
+ * expt::Reduce, made with expt::fused_body.
+ */
+template <typename ForallParams, typename LoopBody>
+struct FusedBody {
+  using params_type = ForallParams;
+  params_type f_params;
+  LoopBody body;
+};
+
+namespace detail
+{
+
+template <typename T>
+struct is_fused_item : std::false_type {
+};
+///
+template <>
+struct is_fused_item<FusedBarrier> : std::true_type {
+};
+///
+template <typename ForallParams, typename LoopBody>
+struct is_fused_item<FusedBody<ForallParams, LoopBody>> : std::true_type {
+};
+
+template <typename T>
+struct is_fused_barrier : std::false_type {
+};
+///
+template <>
+struct is_fused_barrier<FusedBarrier> : std::true_type {
+};
+
+/*!
+ * Barriers and bodies are used as they are, other loop bodies get an empty
+ * param pack.
+ */
+template <typename Item>
+RAJA_INLINE concepts::enable_if_t<camp::decay<Item>,
+                                  is_fused_item<camp::decay<Item>>>
+make_fused_item(Item&& item)
+{
+  return std::forward<Item>(item);
+}
+///
+template <typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    FusedBody<ForallParamPack<>, camp::decay<LoopBody>>,
+    concepts::negate<is_fused_item<camp::decay<LoopBody>>>>
+make_fused_item(LoopBody&& body)
+{
+  return FusedBody<ForallParamPack<>, camp::decay<LoopBody>>{
+      ForallParamPack<>{}, std::forward<LoopBody>(body)};
+}
+
+//! tuple of the params of each item of a fused forall
+template <typename... Items>
+using FusedParams = camp::tuple<typename Items::params_type...>;
+
+/*!
+ * Index of the first barrier in Items at or after begin, or the number of
+ * items if there is none.
+ */
+template <typename... Items>
+constexpr camp::idx_t next_fused_barrier(camp::idx_t begin)
+{
+  constexpr bool barriers[] = {is_fused_barrier<Items>::value..., true};
+  camp::idx_t i = begin;
+  while (i < static_cast<camp::idx_t>(sizeof...(Items)) && !barriers[i]) {
+    ++i;
+  }
+  return i;
+}
+
+template <camp::idx_t Begin, camp::idx_t... Is>
+constexpr camp::idx_seq<(Begin + Is)...> offset_idx_seq(camp::idx_seq<Is...>)
+{
+  return {};
+}
+
+//! run loop_body for the iterations in [lo, hi) in order
+struct FusedSeqLoop {
+  template <typename DiffT, typename Func>
+  RAJA_INLINE void operator()(DiffT lo, DiffT hi, Func&& loop_body) const
+  {
+    for (DiffT i = lo; i < hi; ++i) {
+      loop_body(i);
+    }
+  }
+};
+
+template <typename Item, typename Iterator, typename DiffT>
+RAJA_INLINE void invoke_fused_item(Item& item, Iterator begin, DiffT i)
+{
+  invoke_body(item.f_params, item.body, *(begin + i));
+}
+
+template <typename Loop, typename Iterator, typename DiffT, typename Item>
+RAJA_INLINE void run_fused_body(Loop const& loop,
+                                Iterator begin,
+                                DiffT lo,
+                                DiffT hi,
+                                Item& item)
+{
+  loop(lo, hi, [&](DiffT i) { invoke_fused_item(item, begin, i); });
+}
+
+/*!
+ * Run the bodies Js of items over the iterations in [lo, hi).
+ */
+template <typename Loop,
+          typename Iterator,
+          typename DiffT,
+          typename Items,
+          camp::idx_t... Js>
+RAJA_INLINE void run_fused_stage(fuse_interleave,
+                                 Loop const& loop,
+                                 Iterator begin,
+                                 DiffT lo,
+                                 DiffT hi,
+                                 Items& items,
+                                 camp::idx_seq<Js...>)
+{
+  RAJA_UNUSED_VAR(begin, items);
+  loop(lo, hi, [&](DiffT i) {
+    // braced init lists are evaluated in order
+    int seq_unused_array[] = {
+        0, (invoke_fused_item(camp::get<Js>(items), begin, i), 0)...};
+    RAJA_UNUSED_VAR(seq_unused_array, i);
+  });
+}
+///
+template <camp::idx_t TileSize,
+          typename Loop,
+          typename Iterator,
+          typename DiffT,
+          typename Items,
+          camp::idx_t... Js>
+RAJA_INLINE void run_fused_stage(fuse_tile<TileSize>,
+                                 Loop const& loop,
+                                 Iterator begin,
+                                 DiffT lo,
+                                 DiffT hi,
+                                 Items& items,
+                                 camp::idx_seq<Js...>)
+{
+  RAJA_UNUSED_VAR(loop, begin, items);
+  for (DiffT t = lo; t < hi; t += static_cast<DiffT>(TileSize)) {
+    const DiffT t_end = (hi - t < static_cast<DiffT>(TileSize))
+                            ? hi
+                            : t + static_cast<DiffT>(TileSize);
+    // braced init lists are evaluated in order
+    int seq_unused_array[] = {
+        0, (run_fused_body(loop, begin, t, t_end, camp::get<Js>(items)), 0)...};
+    RAJA_UNUSED_VAR(seq_unused_array, t_end);
+  }
+}
+
+/*!
+ * Run the stages of items from the item Begin over the iterations in
+ * [lo, hi), calling barrier between stages.
+ */
+template <camp::idx_t Begin,
+          typename FusePolicy,
+          typename Loop,
+          typename Iterator,
+          typename DiffT,
+          typename Barrier,
+          typename... Items>
+RAJA_INLINE void run_fused_stages(FusePolicy,
+                                  Loop const&,
+                                  Iterator,
+                                  DiffT,
+                                  DiffT,
+                                  camp::tuple<Items...>&,
+                                  Barrier&&,
+                                  std::true_type)
+{
+}
+///
+template <camp::idx_t Begin,
+          typename FusePolicy,
+          typename Loop,
+          typename Iterator,
+          typename DiffT,
+          typename Barrier,
+          typename... Items>
+RAJA_INLINE void run_fused_stages(FusePolicy fuse,
+                                  Loop const& loop,
+                                  Iterator begin,
+                                  DiffT lo,
+                                  DiffT hi,
+                                  camp::tuple<Items...>& items,
+                                  Barrier&& barrier,
+                                  std::false_type)
+{
+  constexpr camp::idx_t num_items = sizeof...(Items);
+  constexpr camp::idx_t End = next_fused_barrier<Items...>(Begin);
+
+  run_fused_stage(fuse, loop, begin, lo, hi, items,
+                  offset_idx_seq<Begin>(camp::make_idx_seq_t<End - Begin>{}));
+
+  if (End < num_items) {
+    barrier();
+  }
+
+  run_fused_stages<End + 1>(
+      fuse, loop, begin, lo, hi, items, std::forward<Barrier>(barrier),
+      std::integral_constant<bool, (End + 1 > num_items)>{});
+}
+///
+template <typename FusePolicy,
+          typename Loop,
+          typename Iterator,
+          typename DiffT,
+          typename Barrier,
+          typename... Items>
+RAJA_INLINE void run_fused_stages(FusePolicy fuse,
+                                  Loop const& loop,
+                                  Iterator begin,
+                                  DiffT lo,
+                                  DiffT hi,
+                                  camp::tuple<Items...>& items,
+                                  Barrier&& barrier)
+{
+  run_fused_stages<0>(fuse, loop, begin, lo, hi, items,
+                      std::forward<Barrier>(barrier),
+                      std::false_type{});
+}
+
+template <typename EXEC_POL, typename ForallParams, typename LoopBody>
+RAJA_INLINE void init_fused_item(FusedBody<ForallParams, LoopBody>& item)
+{
+  ParamMultiplexer::init<EXEC_POL>(item.f_params);
+}
+///
+template <typename EXEC_POL>
+RAJA_INLINE void init_fused_item(FusedBarrier&)
+{
+}
+
+template <typename EXEC_POL, typename ForallParams, typename LoopBody>
+RAJA_INLINE void combine_fused_item(FusedBody<ForallParams, LoopBody>& item,
+                                    ForallParams const& f_params)
+{
+  ParamMultiplexer::combine<EXEC_POL>(item.f_params, f_params);
+}
+///
+template <typename EXEC_POL>
+RAJA_INLINE void combine_fused_item(FusedBarrier&,
+                                    FusedBarrier::params_type const&)
+{
+}
+
+template <typename EXEC_POL, typename ForallParams, typename LoopBody>
+RAJA_INLINE void resolve_fused_item(FusedBody<ForallParams, LoopBody>& item)
+{
+  ParamMultiplexer::resolve<EXEC_POL>(item.f_params);
+}
+///
+template <typename EXEC_POL>
+RAJA_INLINE void resolve_fused_item(FusedBarrier&)
+{
+}
+
+template <typename ForallParams, typename LoopBody>
+RAJA_INLINE ForallParams const& get_fused_item_params(
+    FusedBody<ForallParams, LoopBody> const& item)
+{
+  return item.f_params;
+}
+///
+RAJA_INLINE FusedBarrier::params_type get_fused_item_params(FusedBarrier const&)
+{
+  return FusedBarrier::params_type{};
+}
+
+template <typename EXEC_POL, typename... Items, camp::idx_t... Is>
+RAJA_INLINE void init_fused_params(camp::tuple<Items...>& items,
+                                   camp::idx_seq<Is...>)
+{
+  CAMP_EXPAND(init_fused_item<EXEC_POL>(camp::get<Is>(items)));
+}
+
+template <typename EXEC_POL, typename... Items, camp::idx_t... Is>
+RAJA_INLINE void combine_fused_params(camp::tuple<Items...>& items,
+                                      FusedParams<Items...> const& params,
+                                      camp::idx_seq<Is...>)
+{
+  CAMP_EXPAND(combine_fused_item<EXEC_POL>(camp::get<Is>(items),
+                                           camp::get<Is>(params)));
+}
+
+template <typename EXEC_POL, typename... Items, camp::idx_t... Is>
+RAJA_INLINE void resolve_fused_params(camp::tuple<Items...>& items,
+                                      camp::idx_seq<Is...>)
+{
+  CAMP_EXPAND(resolve_fused_item<EXEC_POL>(camp::get<Is>(items)));
+}
+
+template <typename... Items, camp::idx_t... Is>
+RAJA_INLINE FusedParams<Items...> get_fused_params(
+    camp::tuple<Items...> const& items,
+    camp::idx_seq<Is...>)
+{
+  return FusedParams<Items...>(get_fused_item_params(camp::get<Is>(items))...);
+}
+
+}  // namespace detail
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_FUSED_FORALL_HPP */
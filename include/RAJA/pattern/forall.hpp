@@ -54,6 +54,7 @@
 
 #include "RAJA/config.hpp"
 
+#include <chrono>
 #include <functional>
 #include <iterator>
 #include <type_traits>
@@ -76,10 +77,13 @@
 #include "RAJA/policy/sequential/forall.hpp"
 
 #include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/detail/fused_forall.hpp"
 #include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/params/kernel_name.hpp"
 
 #include "RAJA/internal/get_platform.hpp"
 #include "RAJA/util/plugins.hpp"
+#include "RAJA/util/PolicyTuner.hpp"
 
 #include "RAJA/util/resource.hpp"
 
@@ -308,7 +312,10 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
   auto&& loop_body = expt::get_lambda(std::forward<Params>(params)...);
   //expt::check_forall_optional_args(loop_body, f_params);
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      expt::get_kernel_name(f_params),
+      util::pluginsRegistered() ? static_cast<Index_type>(c.getLength())
+                                : Index_type(-1))};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -363,7 +370,10 @@ forall(ExecutionPolicy&& p, Res r, IdxSet&& c, Params&&... params)
   auto&& loop_body = expt::get_lambda(std::forward<Params>(params)...);
   expt::check_forall_optional_args(loop_body, f_params);
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      expt::get_kernel_name(f_params),
+      util::pluginsRegistered() ? static_cast<Index_type>(c.getLength())
+                                : Index_type(-1))};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -456,7 +466,11 @@ forall_Icount(ExecutionPolicy&& p,
   auto&& loop_body = expt::get_lambda(std::forward<FirstParam>(first), std::forward<Params>(params)...);
   //expt::check_forall_optional_args(loop_body, f_params);
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      expt::get_kernel_name(f_params),
+      util::pluginsRegistered()
+          ? static_cast<Index_type>(std::distance(std::begin(c), std::end(c)))
+          : Index_type(-1))};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -524,7 +538,11 @@ forall(ExecutionPolicy&& p, Res r, Container&& c, Params&&... params)
   auto&& loop_body = expt::get_lambda(std::forward<Params>(params)...);
   expt::check_forall_optional_args(loop_body, f_params);
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      expt::get_kernel_name(f_params),
+      util::pluginsRegistered()
+          ? static_cast<Index_type>(std::distance(std::begin(c), std::end(c)))
+          : Index_type(-1))};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -744,6 +762,151 @@ namespace expt
     return dynamic_helper<N-1, POLICY_LIST>::invoke_forall(r, pol, seg, body);
   }
 
+  template<camp::idx_t IDX, typename POLICY_LIST>
+  struct tuned_helper
+  {
+    template<typename SEGMENT, typename BODY>
+    static void invoke_forall(const int pol, const bool wait, SEGMENT const &seg,
+                              detail::KernelName const &name, BODY const &body)
+    {
+      if(IDX==pol){
+        using t_pol = typename camp::at<POLICY_LIST,camp::num<IDX>>::type;
+        using resource_type = typename resources::get_resource<t_pol>::type;
+
+        resource_type r = resource_type::get_default();
+        RAJA::forall<t_pol>(r, seg, detail::KernelName(name), body);
+        if(wait) r.wait();
+        return;
+      }
+      tuned_helper<IDX-1, POLICY_LIST>::invoke_forall(pol, wait, seg, name, body);
+    }
+  };
+
+  template<typename POLICY_LIST>
+  struct tuned_helper<-1, POLICY_LIST>
+  {
+    template<typename SEGMENT, typename BODY>
+    static void invoke_forall(const int, const bool, SEGMENT const &,
+                              detail::KernelName const &, BODY const &)
+    {
+      RAJA_ABORT_OR_THROW("Policy value out of range");
+    }
+  };
+
+  /*!
+   * \brief Run a forall with the fastest policy in POLICY_LIST for this
+   *        kernel name and segment size.
+   *
+   * Calls with the same kernel name and a segment length in the same power
+   * of two bucket share a selection. The first calls time each policy in
+   * turn, waiting on the policy's default resource, and the fastest policy
+   * is used for all later calls. See RAJA/util/PolicyTuner.hpp for the
+   * tuning file and environment variables.
+   */
+  template<typename POLICY_LIST, typename SEGMENT, typename BODY>
+  void tuned_forall(SEGMENT const &seg, detail::KernelName const &name, BODY const &body)
+  {
+    constexpr int N = camp::size<POLICY_LIST>::value;
+    static_assert(N > 0, "RAJA policy list must not be empty");
+
+    using std::begin;
+    using std::distance;
+    using std::end;
+    PolicyTuningEntry* entry =
+        getPolicyTuningEntry(name.name, distance(begin(seg), end(seg)), N);
+
+    int pol = getTunedPolicy(entry);
+    if(pol >= 0) {
+      tuned_helper<N-1, POLICY_LIST>::invoke_forall(pol, false, seg, name, body);
+      return;
+    }
+
+    pol = beginPolicyTrial(entry);
+    const auto start = std::chrono::steady_clock::now();
+    tuned_helper<N-1, POLICY_LIST>::invoke_forall(pol, true, seg, name, body);
+    const auto stop = std::chrono::steady_clock::now();
+    endPolicyTrial(entry, pol, std::chrono::duration<double>(stop - start).count());
+  }
+
+  /*!
+   * \brief Make a fused forall loop body with forall params, such as
+   *        expt::Reduce, the loop body is the last argument as in forall.
+   */
+  template<typename... Params>
+  RAJA_INLINE auto fused_body(Params&&... params)
+  {
+    auto f_params = make_forall_param_pack(std::forward<Params>(params)...);
+    auto&& loop_body = get_lambda(std::forward<Params>(params)...);
+    check_forall_optional_args(loop_body, f_params);
+
+    return FusedBody<decltype(f_params), camp::decay<decltype(loop_body)>>{
+        f_params, loop_body};
+  }
+
+  /*!
+   * \brief Dependency between the bodies before and after it in a
+   *        fused_forall.
+   */
+  constexpr FusedBarrier fused_barrier{};
+
+  /*!
+   * \brief Run several loop bodies over the same segment in one loop.
+   *
+   * The bodies are run in the order given for each iteration with
+   * fuse_interleave, or for each tile of iterations with fuse_tile. A
+   * fused_barrier splits the bodies into stages, all iterations of a stage
+   * finish before the next stage starts. Bodies may be lambdas or
+   * fused_body with forall params.
+   *
+   * OpenMP policies run all stages in one parallel region with a barrier
+   * between stages, each thread takes the same contiguous part of the
+   * segment in every stage so it works on the same data.
+   */
+  template<typename ExecPolicy, typename FusePolicy = fuse_interleave,
+           typename Res, typename Container, typename... Bodies>
+  RAJA_INLINE concepts::enable_if_t<
+      resources::EventProxy<Res>,
+      type_traits::is_resource<Res>,
+      type_traits::is_range<Container>>
+  fused_forall(Res r, Container&& c, Bodies&&... bodies)
+  {
+    static_assert(type_traits::is_random_access_range<Container>::value,
+                  "Container does not model RandomAccessIterator");
+
+    util::PluginContext context{util::make_context<camp::decay<ExecPolicy>>(
+        nullptr,
+        util::pluginsRegistered()
+            ? static_cast<Index_type>(std::distance(std::begin(c), std::end(c)))
+            : Index_type(-1))};
+    util::callPreCapturePlugins(context);
+
+    auto items = camp::make_tuple(
+        detail::make_fused_item(std::forward<Bodies>(bodies))...);
+
+    util::callPostCapturePlugins(context);
+
+    util::callPreLaunchPlugins(context);
+
+    resources::EventProxy<Res> e = fused_forall_impl(
+        r, ExecPolicy{}, FusePolicy{}, std::forward<Container>(c), items);
+
+    util::callPostLaunchPlugins(context);
+    return e;
+  }
+  ///
+  template<typename ExecPolicy, typename FusePolicy = fuse_interleave,
+           typename Container, typename... Bodies,
+           typename Res = typename resources::get_resource<ExecPolicy>::type>
+  RAJA_INLINE concepts::enable_if_t<
+      resources::EventProxy<Res>,
+      type_traits::is_range<Container>>
+  fused_forall(Container&& c, Bodies&&... bodies)
+  {
+    auto r = Res::get_default();
+    return fused_forall<ExecPolicy, FusePolicy>(
+        r, std::forward<Container>(c), std::forward<Bodies>(bodies)...);
+  }
+
 }  // namespace expt
 
 
@@ -0,0 +1,406 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA histogram and reduce by key
+*          declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_HPP
+#define RAJA_histogram_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+        \brief bin of item i of a histogram, the key of item i
+*/
+template <typename KeyIter, typename DiffT>
+struct HistogramKeys
+{
+  KeyIter keys;
+
+  DiffT operator()(DiffT i) const { return static_cast<DiffT>(keys[i]); }
+};
+
+/*!
+        \brief value of item i of a histogram
+*/
+template <typename ValIter, typename DiffT>
+struct HistogramValues
+{
+  ValIter vals;
+
+  IterVal<ValIter> operator()(DiffT i) const { return vals[i]; }
+};
+
+/*!
+        \brief value of each item of a counting histogram
+*/
+template <typename T, typename DiffT>
+struct HistogramCount
+{
+  T operator()(DiffT) const { return T(1); }
+};
+
+}  // namespace detail
+
+inline namespace policy_by_value_interface
+{
+
+/*!
+******************************************************************************
+*
+* \brief  histogram execution pattern, combines values[i] into bins[keys[i]]
+*         for each i with op
+*
+* \param[in] p Execution policy
+* \param[in] keys Random-Access Container of bin indices
+* \param[in] values Random-Access Container of input data
+* \param[in,out] bins Random-Access Container of bins
+* \param[in] op binary function to combine values into bins
+*
+* \note{Each key must be in [0, size of bins). The bins are combined into,
+*       not overwritten. Parallel policies privatize the bins by thread so
+*       op must provide identity(), as the RAJA operators do.}
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename ValContainer,
+          typename BinContainer,
+          typename BinFn = operators::plus<RAJA::detail::ContainerVal<BinContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValContainer>,
+                      type_traits::is_range<BinContainer>>
+histogram(ExecPolicy&& p,
+          Res r,
+          KeyContainer&& keys,
+          ValContainer&& values,
+          BinContainer&& bins,
+          BinFn op = BinFn{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<BinContainer>;
+  using DiffT = RAJA::detail::ContainerDiff<KeyContainer>;
+  static_assert(type_traits::is_binary_function<BinFn, T, T, T>::value,
+                "BinFn must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<BinContainer>::value,
+                "BinContainer must model RandomAccessRange");
+  const DiffT n = distance(begin(keys), end(keys));
+  if (n == 0) {
+    return resources::EventProxy<Res>(r);
+  }
+  using KeyFn = RAJA::detail::HistogramKeys<RAJA::detail::ContainerIter<KeyContainer>, DiffT>;
+  using ValFn = RAJA::detail::HistogramValues<RAJA::detail::ContainerIter<ValContainer>, DiffT>;
+  return impl::histogram::histogram(r, std::forward<ExecPolicy>(p), n,
+                                    KeyFn{begin(keys)}, ValFn{begin(values)},
+                                    begin(bins),
+                                    distance(begin(bins), end(bins)), op);
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename ValContainer,
+          typename BinContainer,
+          typename BinFn = operators::plus<RAJA::detail::ContainerVal<BinContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>,
+                      type_traits::is_range<ValContainer>,
+                      type_traits::is_range<BinContainer>>
+histogram(ExecPolicy&& p,
+          KeyContainer&& keys,
+          ValContainer&& values,
+          BinContainer&& bins,
+          BinFn op = BinFn{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::histogram(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<ValContainer>(values),
+      std::forward<BinContainer>(bins),
+      op);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  counting histogram execution pattern, adds one to bins[keys[i]]
+*         for each i
+*
+* \param[in] p Execution policy
+* \param[in] keys Random-Access Container of bin indices
+* \param[in,out] bins Random-Access Container of counts
+*
+* \note{Each key must be in [0, size of bins). The counts are added to the
+*       bins, not overwritten.}
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename BinContainer>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<BinContainer>>
+histogram(ExecPolicy&& p,
+          Res r,
+          KeyContainer&& keys,
+          BinContainer&& bins)
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<BinContainer>;
+  using DiffT = RAJA::detail::ContainerDiff<KeyContainer>;
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<BinContainer>::value,
+                "BinContainer must model RandomAccessRange");
+  const DiffT n = distance(begin(keys), end(keys));
+  if (n == 0) {
+    return resources::EventProxy<Res>(r);
+  }
+  using KeyFn = RAJA::detail::HistogramKeys<RAJA::detail::ContainerIter<KeyContainer>, DiffT>;
+  using ValFn = RAJA::detail::HistogramCount<T, DiffT>;
+  return impl::histogram::histogram(r, std::forward<ExecPolicy>(p), n,
+                                    KeyFn{begin(keys)}, ValFn{},
+                                    begin(bins),
+                                    distance(begin(bins), end(bins)),
+                                    operators::plus<T>{});
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename BinContainer,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>,
+                      type_traits::is_range<BinContainer>>
+histogram(ExecPolicy&& p,
+          KeyContainer&& keys,
+          BinContainer&& bins)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::histogram(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<BinContainer>(bins));
+}
+
+/*!
+******************************************************************************
+*
+* \brief  reduce by key execution pattern, combines the values of equal keys
+*         with op and writes each distinct key and its reduced value
+*
+* \param[in] p Execution policy
+* \param[in] keys Random-Access Container of keys
+* \param[in] values Random-Access Container of input data
+* \param[out] keys_out Random-Access Container of distinct keys
+* \param[out] values_out Random-Access Container of reduced values
+* \param[in] op binary function to combine values
+*
+* \return the number of distinct keys
+*
+* \note{The distinct keys are written in increasing order and the values of
+*       each key are combined in input order. Integer keys that span a small
+*       range are reduced in bins indexed by key, other keys are sorted.}
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename ValContainer,
+          typename KeyOutContainer,
+          typename ValOutContainer,
+          typename BinFn = operators::plus<RAJA::detail::ContainerVal<ValContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::ContainerDiff<KeyContainer>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValContainer>,
+                      type_traits::is_range<KeyOutContainer>,
+                      type_traits::is_range<ValOutContainer>>
+reduce_by_key(ExecPolicy&& p,
+              Res r,
+              KeyContainer&& keys,
+              ValContainer&& values,
+              KeyOutContainer&& keys_out,
+              ValOutContainer&& values_out,
+              BinFn op = BinFn{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<ValContainer>;
+  static_assert(type_traits::is_binary_function<BinFn, T, T, T>::value,
+                "BinFn must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<KeyOutContainer>::value,
+                "KeyOutContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValOutContainer>::value,
+                "ValOutContainer must model RandomAccessRange");
+  if (begin(keys) == end(keys)) {
+    return 0;
+  }
+  return impl::histogram::reduce_by_key(r, std::forward<ExecPolicy>(p),
+                                        begin(keys), end(keys),
+                                        begin(values), begin(keys_out),
+                                        begin(values_out), op);
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename ValContainer,
+          typename KeyOutContainer,
+          typename ValOutContainer,
+          typename BinFn = operators::plus<RAJA::detail::ContainerVal<ValContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::ContainerDiff<KeyContainer>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>,
+                      type_traits::is_range<ValContainer>,
+                      type_traits::is_range<KeyOutContainer>,
+                      type_traits::is_range<ValOutContainer>>
+reduce_by_key(ExecPolicy&& p,
+              KeyContainer&& keys,
+              ValContainer&& values,
+              KeyOutContainer&& keys_out,
+              ValOutContainer&& values_out,
+              BinFn op = BinFn{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::reduce_by_key(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<ValContainer>(values),
+      std::forward<KeyOutContainer>(keys_out),
+      std::forward<ValOutContainer>(values_out),
+      op);
+}
+
+}  // end inline namespace policy_by_value_interface
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * histogram
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+histogram(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::histogram<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+histogram(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::histogram(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * reduce_by_key
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<
+    RAJA::detail::ContainerDiff<camp::at_v<camp::list<Args...>, 0>>,
+    type_traits::is_execution_policy<ExecPolicy>>
+reduce_by_key(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::reduce_by_key<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<
+    RAJA::detail::ContainerDiff<camp::at_v<camp::list<Args...>, 0>>,
+    type_traits::is_execution_policy<ExecPolicy>,
+    type_traits::is_resource<Res>>
+reduce_by_key(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::reduce_by_key(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -42,7 +42,7 @@ namespace statement
  * Given segments S0, S1, ...
  * and iterates i0, i1, ... that range from 0 to Ni, where Ni = length(Si),
  * hyperplanes are defined as h = i0 + i1 + i2 + ...
- * For h = 0 ... sum(Ni)
+ * For h = 0 ... sum(Ni - 1)
  *
  * The iteration is advanced for
  *
@@ -51,27 +51,28 @@ namespace statement
  * Where HpArg is the argument id for i0, and Args define the arguments ids for
  * i1, i2, ...
  *
- *
- *
+ * Only the points on each hyperplane are visited. The bounds of each of
+ * i1, i2, ... are computed from h and the iterates before it, so that the
+ * iterates after it and i0 can still reach h.
  *
  * The implemented loop pattern looks like:
  *
  *  RAJA::forall<HpExecPolicy>(RangeSegment(0, Nh), [=](RAJA::Index_type h){
  *
- *     RAJA::kernel::forall<Collapse<ExecPolicy, ArgList<1,2,...>, Lambda<0>>>(
- *        RAJA::make_tuple(S1, S2, ...),
- *        [=](RAJA::Index_type i1, RAJA::Index_type i2, ...){
+ *     RAJA::forall<ExecPolicy>(RangeSegment(lo1(h), hi1(h)),
+ *        [=](RAJA::Index_type i1){
  *
- *          // Compute i0
- *          RAJA::Index_type i0 = h - sum(i1, i2, ...);
+ *       for (i2 = lo2(h, i1); i2 < hi2(h, i1); ++i2) {
+ *         ...
  *
- *          // Check if h is in bounds
- *          if(h >= 0 && h < Nh){
+ *           // Compute i0, which is always in bounds
+ *           RAJA::Index_type i0 = h - sum(i1, i2, ...);
  *
-              loop_body(i0, i1, i2, ...);
- *          }
+ *           loop_body(i0, i1, i2, ...);
+ *         ...
+ *       }
  *
- *        });
+ *     });
  *
  *  });
  *
@@ -92,9 +93,34 @@ namespace internal
 {
 
 
-template <camp::idx_t HpArgumentId, typename ArgList, typename... EnclosedStmts>
+/*!
+ * Range [lo, hi] of an iterate of length len on a hyperplane, where rem is
+ * what is left of h for this iterate and the iterates after it, and rest is
+ * the largest sum of the iterates after it.
+ */
+template <typename idx_t>
+RAJA_HOST_DEVICE RAJA_INLINE void hyperplane_bounds(idx_t rem,
+                                                    idx_t len,
+                                                    idx_t rest,
+                                                    idx_t &lo,
+                                                    idx_t &hi)
+{
+  lo = (rem > rest) ? static_cast<idx_t>(rem - rest) : static_cast<idx_t>(0);
+  hi = (rem < len - 1) ? rem : static_cast<idx_t>(len - 1);
+}
+
+
+/*!
+ * Loops over the iterates in Args on the hyperplane stored in HpArgumentId,
+ * DoneArgs are the iterates that are already set.
+ */
+template <camp::idx_t HpArgumentId,
+          typename DoneArgs,
+          typename Args,
+          typename ExecPolicy,
+          typename... EnclosedStmts>
 struct HyperplaneInner
-    : public internal::Statement<camp::nil, EnclosedStmts...> {
+    : public internal::Statement<ExecPolicy, EnclosedStmts...> {
 };
 
 
@@ -123,27 +149,32 @@ struct StatementExecutor<statement::Hyperplane<HpArgumentId,
     // Set the argument type for this loop
     using NewTypes = setSegmentTypeFromData<Types, HpArgumentId, Data>;
 
-    // Add a Collapse policy around our enclosed statements that will handle
-    // the inner hyperplane loop's execution
-    using kernel_policy = statement::Collapse<
-        ExecPolicy,
-        ArgList<Args...>,
-        HyperplaneInner<HpArgumentId, ArgList<Args...>, EnclosedStmts...>>;
+    // The inner hyperplane loops over the points of each hyperplane
+    using kernel_policy = HyperplaneInner<HpArgumentId,
+                                          ArgList<>,
+                                          ArgList<Args...>,
+                                          ExecPolicy,
+                                          EnclosedStmts...>;
 
     // Create a For-loop wrapper for the outer loop
     ForWrapper<HpArgumentId, Data, NewTypes, kernel_policy> outer_wrapper(data);
 
-    // compute manhattan distance of iteration space to determine
-    // as:  hp_len = l0 + l1 + l2 + ...
-    idx_t hp_len = segment_length<HpArgumentId>(data) +
-                   foldl(RAJA::operators::plus<idx_t>(),
-                                 segment_length<Args>(data)...);
+    // there are no points if any segment is empty
+    idx_t const lens[] = {static_cast<idx_t>(segment_length<HpArgumentId>(data)),
+                          static_cast<idx_t>(segment_length<Args>(data))...};
+    idx_t hp_len = 1;
+    for (idx_t len : lens) {
+      if (len == 0) {
+        return;
+      }
+      hp_len += len - 1;
+    }
 
     /* Execute the outer loop over hyperplanes
      *
      * This will store h in the index_tuple as argument HpArgumentId, so that
-     * later, the HyperplaneInner executor can pull it out, and calculate that
-     * arguments actual value (and restrict to valid hyperplane indices)
+     * later, the HyperplaneInner executors can pull it out, and calculate
+     * that arguments actual value
      */
     auto r = resources::get_resource<HpExecPolicy>::type::get_default();
     forall_impl(r, HpExecPolicy{},
@@ -154,12 +185,140 @@ struct StatementExecutor<statement::Hyperplane<HpArgumentId,
 };
 
 
+/*!
+ * Compute what is left of h for the iterate after DoneArgs, and the bounds
+ * of that iterate Arg on the hyperplane.
+ */
 template <camp::idx_t HpArgumentId,
-          camp::idx_t... Args,
+          camp::idx_t... DoneArgs,
+          camp::idx_t Arg,
+          camp::idx_t... RestArgs,
+          typename Data,
+          typename idx_t>
+RAJA_INLINE void hyperplane_inner_bounds(Data &data,
+                                         ArgList<DoneArgs...>,
+                                         ArgList<Arg, RestArgs...>,
+                                         idx_t &lo,
+                                         idx_t &hi)
+{
+  idx_t h = camp::get<HpArgumentId>(data.offset_tuple);
+  idx_t rem = h - foldl(RAJA::operators::plus<idx_t>(),
+                        static_cast<idx_t>(0),
+                        static_cast<idx_t>(
+                            camp::get<DoneArgs>(data.offset_tuple))...);
+  idx_t rest = foldl(RAJA::operators::plus<idx_t>(),
+                     static_cast<idx_t>(segment_length<HpArgumentId>(data) - 1),
+                     static_cast<idx_t>(segment_length<RestArgs>(data) - 1)...);
+
+  hyperplane_bounds(rem,
+                    static_cast<idx_t>(segment_length<Arg>(data)),
+                    rest,
+                    lo,
+                    hi);
+}
+
+
+template <camp::idx_t HpArgumentId,
+          camp::idx_t... DoneArgs,
+          camp::idx_t Arg,
+          camp::idx_t... RestArgs,
+          typename ExecPolicy,
           typename... EnclosedStmts,
           typename Types>
-struct StatementExecutor<
-    HyperplaneInner<HpArgumentId, ArgList<Args...>, EnclosedStmts...>, Types> {
+struct StatementExecutor<HyperplaneInner<HpArgumentId,
+                                         ArgList<DoneArgs...>,
+                                         ArgList<Arg, RestArgs...>,
+                                         ExecPolicy,
+                                         EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    using idx_t = camp::decay<decltype(camp::get<HpArgumentId>(data.offset_tuple))>;
+
+    idx_t lo, hi;
+    hyperplane_inner_bounds<HpArgumentId>(data,
+                                          ArgList<DoneArgs...>{},
+                                          ArgList<Arg, RestArgs...>{},
+                                          lo,
+                                          hi);
+
+    // Set the argument type for this loop
+    using NewTypes = setSegmentTypeFromData<Types, Arg, Data>;
+
+    // the loops after this one are sequential
+    using next_policy = HyperplaneInner<HpArgumentId,
+                                        ArgList<DoneArgs..., Arg>,
+                                        ArgList<RestArgs...>,
+                                        seq_exec,
+                                        EnclosedStmts...>;
+
+    ForWrapper<Arg, Data, NewTypes, next_policy> for_wrapper(data);
+
+    auto r = resources::get_resource<ExecPolicy>::type::get_default();
+    forall_impl(r, ExecPolicy{},
+                TypedRangeSegment<idx_t>(lo, hi + 1),
+                for_wrapper,
+                RAJA::expt::get_empty_forall_param_pack());
+  }
+};
+
+
+template <camp::idx_t HpArgumentId,
+          camp::idx_t... DoneArgs,
+          camp::idx_t Arg,
+          camp::idx_t... RestArgs,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<HyperplaneInner<HpArgumentId,
+                                         ArgList<DoneArgs...>,
+                                         ArgList<Arg, RestArgs...>,
+                                         seq_exec,
+                                         EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    using idx_t = camp::decay<decltype(camp::get<HpArgumentId>(data.offset_tuple))>;
+
+    idx_t lo, hi;
+    hyperplane_inner_bounds<HpArgumentId>(data,
+                                          ArgList<DoneArgs...>{},
+                                          ArgList<Arg, RestArgs...>{},
+                                          lo,
+                                          hi);
+
+    // Set the argument type for this loop
+    using NewTypes = setSegmentTypeFromData<Types, Arg, Data>;
+
+    using next_loop_t = StatementExecutor<HyperplaneInner<HpArgumentId,
+                                                          ArgList<DoneArgs..., Arg>,
+                                                          ArgList<RestArgs...>,
+                                                          seq_exec,
+                                                          EnclosedStmts...>,
+                                          NewTypes>;
+
+    for (idx_t i = lo; i <= hi; ++i) {
+      data.template assign_offset<Arg>(i);
+
+      next_loop_t::exec(data);
+    }
+  }
+};
+
+
+template <camp::idx_t HpArgumentId,
+          camp::idx_t... DoneArgs,
+          typename ExecPolicy,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<HyperplaneInner<HpArgumentId,
+                                         ArgList<DoneArgs...>,
+                                         ArgList<>,
+                                         ExecPolicy,
+                                         EnclosedStmts...>, Types> {
 
 
   template <typename Data>
@@ -172,24 +331,20 @@ struct StatementExecutor<
 
     // compute actual iterate for HpArgumentId
     // as:  i0 = h - (i1 + i2 + i3 + ...)
+    // which is in bounds by the bounds of i1, i2, i3, ...
     idx_t i = h - foldl(RAJA::operators::plus<idx_t>(),
-                                camp::get<Args>(data.offset_tuple)...);
+                        static_cast<idx_t>(0),
+                        static_cast<idx_t>(
+                            camp::get<DoneArgs>(data.offset_tuple))...);
 
-    // get length of Hp indexed argument
-    auto len = segment_length<HpArgumentId>(data);
+    // store in tuple
+    data.template assign_offset<HpArgumentId>(i);
 
-    // check bounds
-    if (i >= 0 && i < len) {
+    // execute enclosed statements
+    execute_statement_list<StatementList<EnclosedStmts...>, Types>(data);
 
-      // store in tuple
-      data.template assign_offset<HpArgumentId>(i);
-
-      // execute enclosed statements
-      execute_statement_list<StatementList<EnclosedStmts...>, Types>(data);
-
-      // reset h for next iteration
-      data.template assign_offset<HpArgumentId>(h);
-    }
+    // reset h for next iteration
+    data.template assign_offset<HpArgumentId>(h);
   }
 };
 
@@ -19,6 +19,10 @@
 #define RAJA_pattern_launch_core_HPP
 
 #include "RAJA/config.hpp"
+
+#include <atomic>
+#include <thread>
+
 #include "RAJA/internal/get_platform.hpp"
 #include "RAJA/util/StaticLayout.hpp"
 #include "RAJA/util/macros.hpp"
@@ -151,6 +155,64 @@ private:
   Threads apply(Threads const &a) { return (threads = a); }
 };
 
+namespace detail
+{
+
+/*!
+ * Barrier for the threads of a team of host threads. The last thread to
+ * arrive resets the count and starts the next generation, the other threads
+ * spin until the generation changes.
+ */
+class LaunchHostTeamBarrier
+{
+public:
+  void init(int num_threads)
+  {
+    m_num_threads = num_threads;
+    m_count.store(0, std::memory_order_relaxed);
+    m_generation.store(0, std::memory_order_relaxed);
+  }
+
+  void wait()
+  {
+    const int generation = m_generation.load(std::memory_order_acquire);
+    if (m_count.fetch_add(1, std::memory_order_acq_rel) + 1 == m_num_threads) {
+      m_count.store(0, std::memory_order_relaxed);
+      m_generation.store(generation + 1, std::memory_order_release);
+    } else {
+      while (m_generation.load(std::memory_order_acquire) == generation) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+private:
+  std::atomic<int> m_count{0};
+  std::atomic<int> m_generation{0};
+  int m_num_threads{1};
+
+  static constexpr size_t s_used_bytes =
+      2 * sizeof(std::atomic<int>) + sizeof(int);
+  // keep the barriers of different teams in different cache lines
+  char m_pad[RAJA_DIVIDE_CEILING_INT(s_used_bytes + 1, RAJA::DATA_ALIGN) *
+                 RAJA::DATA_ALIGN -
+             s_used_bytes];
+};
+
+}  // namespace detail
+
+/*!
+ * Place of a host thread in the teams of a launch that runs teams of host
+ * threads.
+ */
+struct LaunchHostTeam {
+  int team;
+  int num_teams;
+  int thread;
+  int num_threads;
+  detail::LaunchHostTeamBarrier *barrier;
+};
+
 class LaunchContext
 {
 public:
@@ -161,20 +223,26 @@ public:
 
   void *shared_mem_ptr;
 
+  //Team of this thread for launches that run
+  //teams of host threads, null otherwise
+  LaunchHostTeam const *host_team;
+
 #if defined(RAJA_ENABLE_SYCL)
   mutable cl::sycl::nd_item<3> *itm;
 #endif
 
   RAJA_HOST_DEVICE LaunchContext()
-    : shared_mem_offset(0), shared_mem_ptr(nullptr)
+    : shared_mem_offset(0), shared_mem_ptr(nullptr), host_team(nullptr)
   {
   }
 
-  //TODO handle alignment
   template<typename T>
   RAJA_HOST_DEVICE T* getSharedMemory(size_t bytes)
   {
 
+    //Align the offset for T, the pool is aligned
+    shared_mem_offset = RAJA_DIVIDE_CEILING_INT(shared_mem_offset, alignof(T)) * alignof(T);
+
     //Calculate offset in bytes with a char pointer
     void* mem_ptr = static_cast<char *>(shared_mem_ptr) + shared_mem_offset;
 
@@ -212,6 +280,12 @@ public:
 #if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && !defined(RAJA_ENABLE_SYCL)
     __syncthreads();
 #endif
+
+#if !defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+    if (host_team != nullptr) {
+      host_team->barrier->wait();
+    }
+#endif
   }
 };
 
@@ -230,7 +304,7 @@ void launch(LaunchParams const &launch_params, const char *kernel_name, ReducePa
 
   //Take the first policy as we assume the second policy is not user defined.
   //We rely on the user to pair launch and loop policies correctly.
-  util::PluginContext context{util::make_context<typename LAUNCH_POLICY::host_policy_t>()};
+  util::PluginContext context{util::make_context<typename LAUNCH_POLICY::host_policy_t>(kernel_name)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -264,7 +338,7 @@ void launch(LaunchParams const &launch_params, ReduceParams&&... rest_of_launch_
 
   //Take the first policy as we assume the second policy is not user defined.
   //We rely on the user to pair launch and loop policies correctly.
-  util::PluginContext context{util::make_context<typename LAUNCH_POLICY::host_policy_t>()};
+  util::PluginContext context{util::make_context<typename LAUNCH_POLICY::host_policy_t>(kernel_name)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -414,10 +488,10 @@ launch(RAJA::resources::Resource res, LaunchParams const &launch_params,
   //
 #if defined(RAJA_GPU_ACTIVE)
   util::PluginContext context{place == ExecPlace::HOST ?
-      util::make_context<typename POLICY_LIST::host_policy_t>() :
-      util::make_context<typename POLICY_LIST::device_policy_t>()};
+      util::make_context<typename POLICY_LIST::host_policy_t>(kernel_name) :
+      util::make_context<typename POLICY_LIST::device_policy_t>(kernel_name)};
 #else
-  util::PluginContext context{util::make_context<typename POLICY_LIST::host_policy_t>()};
+  util::PluginContext context{util::make_context<typename POLICY_LIST::host_policy_t>(kernel_name)};
 #endif
 
   util::callPreCapturePlugins(context);
@@ -482,10 +556,10 @@ launch(RAJA::resources::Resource res, LaunchParams const &launch_params,
   //
 #if defined(RAJA_GPU_ACTIVE)
   util::PluginContext context{place == ExecPlace::HOST ?
-      util::make_context<typename POLICY_LIST::host_policy_t>() :
-      util::make_context<typename POLICY_LIST::device_policy_t>()};
+      util::make_context<typename POLICY_LIST::host_policy_t>(kernel_name) :
+      util::make_context<typename POLICY_LIST::device_policy_t>(kernel_name)};
 #else
-  util::PluginContext context{util::make_context<typename POLICY_LIST::host_policy_t>()};
+  util::PluginContext context{util::make_context<typename POLICY_LIST::host_policy_t>(kernel_name)};
 #endif
 
   util::callPreCapturePlugins(context);
@@ -0,0 +1,108 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the shared memory reused by the host
+ *          back-ends of RAJA::launch
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_host_scratch_HPP
+#define RAJA_pattern_launch_host_scratch_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Aligned shared memory for host launches. Each host thread keeps its
+ * memory and reuses it in later launches, growing it when a launch needs
+ * more. A nested launch that finds the memory in use gets its own.
+ */
+class LaunchHostScratch
+{
+public:
+  explicit LaunchHostScratch(size_t bytes)
+  {
+    Pool& pool = get_pool();
+    if (!pool.in_use) {
+      if (bytes > pool.size) {
+        RAJA::free_aligned(pool.ptr);
+        pool.ptr = allocate(bytes);
+        pool.size = bytes;
+      }
+      pool.in_use = true;
+      m_pool = &pool;
+      m_ptr = pool.ptr;
+    } else {
+      m_ptr = allocate(bytes);
+    }
+  }
+
+  LaunchHostScratch(LaunchHostScratch const&) = delete;
+  LaunchHostScratch& operator=(LaunchHostScratch const&) = delete;
+
+  ~LaunchHostScratch()
+  {
+    if (m_pool != nullptr) {
+      m_pool->in_use = false;
+    } else {
+      RAJA::free_aligned(m_ptr);
+    }
+  }
+
+  char* get() const { return m_ptr; }
+
+private:
+  struct Pool {
+    char* ptr = nullptr;
+    size_t size = 0;
+    bool in_use = false;
+
+    ~Pool() { RAJA::free_aligned(ptr); }
+  };
+
+  static Pool& get_pool()
+  {
+    static thread_local Pool pool;
+    return pool;
+  }
+
+  static char* allocate(size_t bytes)
+  {
+    char* ptr = RAJA::allocate_aligned_type<char>(
+        RAJA::DATA_ALIGN,
+        RAJA_DIVIDE_CEILING_INT(bytes, RAJA::DATA_ALIGN) * RAJA::DATA_ALIGN);
+    if (ptr == nullptr) {
+      RAJA_ABORT_OR_THROW("LaunchHostScratch failed to allocate memory");
+    }
+    return ptr;
+  }
+
+  Pool* m_pool = nullptr;
+  char* m_ptr = nullptr;
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif
@@ -13,6 +13,8 @@
 #include "RAJA/policy/hip/params/kernel_name.hpp"
 #include "RAJA/policy/sycl/params/reduce.hpp"
 #include "RAJA/policy/sycl/params/kernel_name.hpp"
+#include "RAJA/policy/threads/params/reduce.hpp"
+#include "RAJA/policy/threads/params/kernel_name.hpp"
 
 #include "RAJA/util/CombiningAdapter.hpp"
 
@@ -187,7 +189,41 @@ namespace expt
   template<typename... Args>
   constexpr auto&& get_lambda(Args&&... args){
     return camp::get<sizeof...(Args)-1>( camp::forward_as_tuple(std::forward<Args>(args)...) );
-  } 
+  }
+  //===========================================================================
+
+
+
+  //===========================================================================
+  //
+  //
+  // Find the name given with KernelName in a param pack, used to label the
+  // kernel for plugins. Returns nullptr when the kernel is not named.
+  //
+  //
+  namespace detail {
+    RAJA_INLINE const char* get_kernel_name_impl() { return nullptr; }
+
+    template<typename... Rest>
+    RAJA_INLINE const char* get_kernel_name_impl(const KernelName& kn, const Rest&...) {
+      return kn.name;
+    }
+
+    template<typename First, typename... Rest>
+    RAJA_INLINE const char* get_kernel_name_impl(const First&, const Rest&... rest) {
+      return get_kernel_name_impl(rest...);
+    }
+
+    template<typename... Params, camp::idx_t... Seq>
+    RAJA_INLINE const char* get_kernel_name(const ForallParamPack<Params...>& f_params, camp::idx_seq<Seq...>) {
+      return get_kernel_name_impl(camp::get<Seq>(f_params.param_tup)...);
+    }
+  } // namespace detail
+
+  template<typename... Params>
+  RAJA_INLINE const char* get_kernel_name(const ForallParamPack<Params...>& f_params) {
+    return detail::get_kernel_name(f_params, typename ForallParamPack<Params...>::params_seq());
+  }
   //===========================================================================
 
 
@@ -26,6 +26,7 @@
 #include "RAJA/pattern/tensor/ScalarRegister.hpp"
 #include "RAJA/pattern/tensor/VectorRegister.hpp"
 #include "RAJA/pattern/tensor/MatrixRegister.hpp"
+#include "RAJA/pattern/tensor/SimdIndex.hpp"
 
 #include "RAJA/pattern/tensor/internal/ExpressionTemplate.hpp"
 #include "RAJA/pattern/tensor/internal/MatrixRegisterImpl.hpp"
@@ -33,5 +34,6 @@
 
 
 #include "RAJA/pattern/tensor/TensorBlock.hpp"
+#include "RAJA/pattern/tensor/MatrixMultiply.hpp"
 
 #endif
@@ -0,0 +1,411 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining cache blocked matrix multiplication of
+ *          View matrices built on the tensor register types.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_MatrixMultiply_HPP
+#define RAJA_pattern_tensor_MatrixMultiply_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/internal/foldl.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/tensor/MatrixRegister.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * Block sizes of the packed matrix multiply.
+   *
+   * The micro kernel keeps an s_mr x s_nr block of C in registers, s_nr is
+   * two registers wide. A is packed in s_mc x s_kc blocks, sized to stay in
+   * L2, and B in s_kc x s_nr panels, sized to stay in L1. Each thread
+   * computes s_mc x s_nc tiles of C.
+   */
+  template<typename T, typename REGISTER_POLICY>
+  struct MatrixMultiplyBlocking
+  {
+    using register_type = RAJA::expt::Register<T, REGISTER_POLICY>;
+
+    static constexpr camp::idx_t s_width =
+        RegisterTraits<REGISTER_POLICY, T>::s_num_elem;
+
+    static constexpr camp::idx_t s_nr_registers = 2;
+
+    static constexpr camp::idx_t s_mr = 4;
+    static constexpr camp::idx_t s_nr = s_nr_registers * s_width;
+
+    static constexpr camp::idx_t s_mc = 64;
+    static constexpr camp::idx_t s_kc = 256;
+    static constexpr camp::idx_t s_nc = 128;
+
+    // block of C held by the micro kernel
+    using accumulator_type =
+        RAJA::expt::RectMatrixRegister<T, RAJA::expt::RowMajorLayout,
+                                       s_mr, s_nr, REGISTER_POLICY>;
+
+    static_assert(s_mc % s_mr == 0, "s_mc must be a multiple of s_mr");
+    static_assert(s_nc % s_nr == 0, "s_nc must be a multiple of s_nr");
+  };
+
+
+  /*!
+   * Packing buffer owned by one thread, grown as needed and reused by all
+   * multiplies run on that thread.
+   */
+  template<typename T>
+  class MatrixMultiplyBuffer
+  {
+    public:
+      MatrixMultiplyBuffer() = default;
+
+      MatrixMultiplyBuffer(MatrixMultiplyBuffer const &) = delete;
+      MatrixMultiplyBuffer &operator=(MatrixMultiplyBuffer const &) = delete;
+
+      ~MatrixMultiplyBuffer()
+      {
+        if (m_data != nullptr) {
+          RAJA::free_aligned(m_data);
+        }
+      }
+
+      T *get(std::size_t size)
+      {
+        if (size > m_size) {
+          if (m_data != nullptr) {
+            RAJA::free_aligned(m_data);
+          }
+          m_data = RAJA::allocate_aligned_type<T>(RAJA::DATA_ALIGN,
+                                                  size * sizeof(T));
+          m_size = m_data != nullptr ? size : 0;
+          if (m_data == nullptr) {
+            RAJA_ABORT_OR_THROW("matrix_multiply failed to allocate packing buffer");
+          }
+        }
+        return m_data;
+      }
+
+    private:
+      T *m_data = nullptr;
+      std::size_t m_size = 0;
+  };
+
+
+  /*!
+   * Compute the s_mr x s_nr block Ap * Bp of packed panels over kc
+   * columns of A, and store it row-major in tile.
+   *
+   * A is broadcast one element at a time against rows of B, the same
+   * fused multiply-add as the row-major MatrixMatrixMultiplyHelper, but
+   * reading from the packed panels instead of from registers.
+   */
+  template<typename T, typename REGISTER_POLICY>
+  RAJA_INLINE
+  void matrix_multiply_micro_kernel(camp::idx_t kc,
+                                    T const * RAJA_RESTRICT Ap,
+                                    T const * RAJA_RESTRICT Bp,
+                                    T * RAJA_RESTRICT tile)
+  {
+    using blocking = MatrixMultiplyBlocking<T, REGISTER_POLICY>;
+    using register_type = typename blocking::register_type;
+    using accumulator_type = typename blocking::accumulator_type;
+
+    constexpr camp::idx_t mr = blocking::s_mr;
+    constexpr camp::idx_t nr = blocking::s_nr;
+    constexpr camp::idx_t nr_registers = blocking::s_nr_registers;
+    constexpr camp::idx_t width = blocking::s_width;
+
+    accumulator_type C(T(0));
+
+    for(camp::idx_t k = 0;k < kc;++ k){
+      register_type b[nr_registers];
+
+      RAJA_UNROLL
+      for(camp::idx_t j = 0;j < nr_registers;++ j){
+        b[j].load_packed(Bp + k*nr + j*width);
+      }
+
+      RAJA_UNROLL
+      for(camp::idx_t r = 0;r < mr;++ r){
+        register_type a(Ap[k*mr + r]);
+
+        RAJA_UNROLL
+        for(camp::idx_t j = 0;j < nr_registers;++ j){
+          camp::idx_t c_reg = r*nr_registers + j;
+          C.get_register(c_reg) = a.multiply_add(b[j], C.get_register(c_reg));
+        }
+      }
+    }
+
+    C.store_packed(tile, nr, 1);
+  }
+
+
+  /*!
+   * Multiply the M x N block of C starting at (row0, col0), for one
+   * matrix of a batch selected by idx... (empty for a single matrix).
+   *
+   * C = alpha*A*B + beta*C, where alpha is applied while packing A. Must
+   * only be called with K > 0.
+   */
+  template<typename REGISTER_POLICY, typename ViewA, typename ViewB, typename ViewC, typename T, typename ... IDX>
+  RAJA_INLINE
+  void matrix_multiply_block(Index_type row0, Index_type M,
+                             Index_type col0, Index_type N,
+                             Index_type K,
+                             ViewA const &A, ViewB const &B, ViewC const &C,
+                             T alpha, T beta, IDX ... idx)
+  {
+    using blocking = MatrixMultiplyBlocking<T, REGISTER_POLICY>;
+
+    constexpr camp::idx_t mr = blocking::s_mr;
+    constexpr camp::idx_t nr = blocking::s_nr;
+    constexpr camp::idx_t kc_max = blocking::s_kc;
+
+    static thread_local MatrixMultiplyBuffer<T> a_buffer;
+    static thread_local MatrixMultiplyBuffer<T> b_buffer;
+
+    Index_type const m_panels = (M + mr - 1) / mr;
+    Index_type const n_panels = (N + nr - 1) / nr;
+
+    T * RAJA_RESTRICT Ap = a_buffer.get(m_panels * mr * kc_max);
+    T * RAJA_RESTRICT Bp = b_buffer.get(n_panels * nr * kc_max);
+
+    alignas(RAJA::DATA_ALIGN) T tile[mr*nr];
+
+    for(Index_type pc = 0;pc < K;pc += kc_max){
+      Index_type const kc = RAJA::min<Index_type>(kc_max, K - pc);
+
+      // pack A in mr row panels, each stored column by column, padding the
+      // last panel with zeros
+      for(Index_type ip = 0;ip < m_panels;++ ip){
+        T *panel = Ap + ip*mr*kc;
+        for(Index_type k = 0;k < kc;++ k){
+          for(Index_type r = 0;r < mr;++ r){
+            Index_type const i = ip*mr + r;
+            panel[k*mr + r] =
+                i < M ? alpha * A(idx..., row0 + i, pc + k) : T(0);
+          }
+        }
+      }
+
+      // pack B in nr column panels, each stored row by row, padding the
+      // last panel with zeros
+      for(Index_type jp = 0;jp < n_panels;++ jp){
+        T *panel = Bp + jp*nr*kc;
+        for(Index_type k = 0;k < kc;++ k){
+          for(Index_type c = 0;c < nr;++ c){
+            Index_type const j = jp*nr + c;
+            panel[k*nr + c] = j < N ? B(idx..., pc + k, col0 + j) : T(0);
+          }
+        }
+      }
+
+      bool const first = pc == 0;
+
+      // each B panel is reused by every A panel while it stays in L1
+      for(Index_type jp = 0;jp < n_panels;++ jp){
+        Index_type const nb = RAJA::min<Index_type>(nr, N - jp*nr);
+
+        for(Index_type ip = 0;ip < m_panels;++ ip){
+          Index_type const mb = RAJA::min<Index_type>(mr, M - ip*mr);
+
+          matrix_multiply_micro_kernel<T, REGISTER_POLICY>(
+              kc, Ap + ip*mr*kc, Bp + jp*nr*kc, tile);
+
+          for(Index_type r = 0;r < mb;++ r){
+            for(Index_type c = 0;c < nb;++ c){
+              T &Cij = C(idx..., row0 + ip*mr + r, col0 + jp*nr + c);
+              T const value = tile[r*nr + c];
+              if(!first){
+                Cij += value;
+              }
+              else if(beta == T(0)){
+                // C is not read, so it may hold anything (even NaN)
+                Cij = value;
+              }
+              else{
+                Cij = beta*Cij + value;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+
+  /*!
+   * Scale the M x N block of C starting at (row0, col0) by beta, used when
+   * K == 0 and nothing is accumulated.
+   */
+  template<typename ViewC, typename T, typename ... IDX>
+  RAJA_INLINE
+  void matrix_multiply_scale(Index_type row0, Index_type M,
+                             Index_type col0, Index_type N,
+                             ViewC const &C, T beta, IDX ... idx)
+  {
+    for(Index_type i = 0;i < M;++ i){
+      for(Index_type j = 0;j < N;++ j){
+        T &Cij = C(idx..., row0 + i, col0 + j);
+        Cij = beta == T(0) ? T(0) : beta*Cij;
+      }
+    }
+  }
+
+} // namespace expt
+} // namespace internal
+
+
+namespace expt
+{
+
+  /*!
+   ******************************************************************************
+   *
+   * \brief  Compute C = alpha*A*B + beta*C for M x K matrix A, K x N matrix B
+   *         and M x N matrix C, held in Views indexed (row, column) from 0.
+   *
+   * Any layout can be used for the Views, the blocks of A and B are packed
+   * into contiguous panels before they are multiplied. C is split into
+   * tiles that are computed in parallel with RAJA::forall<ExecPolicy>, so
+   * ExecPolicy must be a host policy (seq_exec, omp_parallel_for_exec, ...).
+   * Each tile's inner products are computed with REGISTER_POLICY registers.
+   *
+   * When beta is zero C is not read.
+   *
+   ******************************************************************************
+   */
+  template<typename ExecPolicy, typename REGISTER_POLICY = default_register,
+           typename ViewA, typename ViewB, typename ViewC>
+  RAJA_INLINE
+  void matrix_multiply(Index_type M, Index_type N, Index_type K,
+                       ViewA const &A, ViewB const &B, ViewC const &C,
+                       camp::decay<typename ViewC::value_type> alpha = 1,
+                       camp::decay<typename ViewC::value_type> beta = 0)
+  {
+    using element_type = camp::decay<typename ViewC::value_type>;
+    using blocking = RAJA::internal::expt::MatrixMultiplyBlocking<element_type, REGISTER_POLICY>;
+
+    if(M <= 0 || N <= 0){
+      return;
+    }
+
+    constexpr Index_type mc = blocking::s_mc;
+    constexpr Index_type nc = blocking::s_nc;
+
+    Index_type const m_tiles = (M + mc - 1) / mc;
+    Index_type const n_tiles = (N + nc - 1) / nc;
+
+    RAJA::forall<ExecPolicy>(
+        RAJA::TypedRangeSegment<Index_type>(0, m_tiles*n_tiles),
+        [=](Index_type tile) {
+          Index_type const row0 = (tile % m_tiles) * mc;
+          Index_type const col0 = (tile / m_tiles) * nc;
+          Index_type const mb = RAJA::min<Index_type>(mc, M - row0);
+          Index_type const nb = RAJA::min<Index_type>(nc, N - col0);
+
+          if(K <= 0){
+            RAJA::internal::expt::matrix_multiply_scale(
+                row0, mb, col0, nb, C, beta);
+          }
+          else{
+            RAJA::internal::expt::matrix_multiply_block<REGISTER_POLICY>(
+                row0, mb, col0, nb, K, A, B, C, alpha, beta);
+          }
+        });
+  }
+
+
+  /*!
+   ******************************************************************************
+   *
+   * \brief  Compute C(b) = alpha*A(b)*B(b) + beta*C(b) for each of batch
+   *         matrices, with A, B and C held in Views indexed
+   *         (matrix, row, column) from 0.
+   *
+   * Meant for many small matrices, the tiles of all the matrices are
+   * computed in parallel with RAJA::forall<ExecPolicy>, and a matrix that
+   * fits in one tile (64 x 128) is multiplied by a single thread.
+   * ExecPolicy must be a host policy.
+   *
+   * When beta is zero C is not read.
+   *
+   ******************************************************************************
+   */
+  template<typename ExecPolicy, typename REGISTER_POLICY = default_register,
+           typename ViewA, typename ViewB, typename ViewC>
+  RAJA_INLINE
+  void batched_matrix_multiply(Index_type batch,
+                               Index_type M, Index_type N, Index_type K,
+                               ViewA const &A, ViewB const &B, ViewC const &C,
+                               camp::decay<typename ViewC::value_type> alpha = 1,
+                               camp::decay<typename ViewC::value_type> beta = 0)
+  {
+    using element_type = camp::decay<typename ViewC::value_type>;
+    using blocking = RAJA::internal::expt::MatrixMultiplyBlocking<element_type, REGISTER_POLICY>;
+
+    if(batch <= 0 || M <= 0 || N <= 0){
+      return;
+    }
+
+    constexpr Index_type mc = blocking::s_mc;
+    constexpr Index_type nc = blocking::s_nc;
+
+    Index_type const m_tiles = (M + mc - 1) / mc;
+    Index_type const n_tiles = (N + nc - 1) / nc;
+    Index_type const num_tiles = m_tiles*n_tiles;
+
+    RAJA::forall<ExecPolicy>(
+        RAJA::TypedRangeSegment<Index_type>(0, batch*num_tiles),
+        [=](Index_type i) {
+          Index_type const b = i / num_tiles;
+          Index_type const tile = i % num_tiles;
+          Index_type const row0 = (tile % m_tiles) * mc;
+          Index_type const col0 = (tile / m_tiles) * nc;
+          Index_type const mb = RAJA::min<Index_type>(mc, M - row0);
+          Index_type const nb = RAJA::min<Index_type>(nc, N - col0);
+
+          if(K <= 0){
+            RAJA::internal::expt::matrix_multiply_scale(
+                row0, mb, col0, nb, C, beta, b);
+          }
+          else{
+            RAJA::internal::expt::matrix_multiply_block<REGISTER_POLICY>(
+                row0, mb, col0, nb, K, A, B, C, alpha, beta, b);
+          }
+        });
+  }
+
+} // namespace expt
+}  // namespace RAJA
+
+
+#endif
@@ -0,0 +1,197 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the register width chunk of loop
+ *          indices passed to simd_register_exec loop bodies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_SimdIndex_HPP
+#define RAJA_pattern_tensor_SimdIndex_HPP
+
+#include "camp/camp.hpp"
+#include "RAJA/config.hpp"
+#include "RAJA/pattern/tensor/internal/RegisterBase.hpp"
+#include "RAJA/policy/tensor/arch.hpp"
+
+
+namespace RAJA
+{
+namespace expt
+{
+
+  /*!
+   * A chunk of up to one register of loop indices, passed to the body of a
+   * RAJA::forall run with simd_register_exec<T, REGISTER_POLICY>.
+   *
+   * The chunk holds as many indices as a Register<T, REGISTER_POLICY> has
+   * lanes, fewer for the last chunk of a segment. Indices of a range
+   * segment are contiguous and are loaded and stored with packed (masked
+   * for the last chunk) loads and stores, other indices are held in an
+   * integer register and loaded and stored with gathers and scatters.
+   *
+   * Loads and stores may use any element type with the same size as T, so
+   * that the lanes line up, for example int64_t with double.
+   */
+  template<typename T, typename REGISTER_POLICY = default_register>
+  class SimdIndex
+  {
+    public:
+      using self_type = SimdIndex<T, REGISTER_POLICY>;
+      using register_policy = REGISTER_POLICY;
+      using element_type = T;
+      using register_type = Register<T, REGISTER_POLICY>;
+
+      using index_register_type = typename register_type::int_vector_type;
+      using index_type = typename index_register_type::element_type;
+
+      static constexpr camp::idx_t s_num_elem = register_type::s_num_elem;
+
+      /*!
+       * @brief Contiguous chunk of size indices starting at begin
+       */
+      RAJA_INLINE
+      static
+      self_type range(index_type begin, camp::idx_t size){
+        self_type chunk;
+        chunk.m_begin = begin;
+        chunk.m_size = size;
+        chunk.m_contiguous = true;
+        return chunk;
+      }
+
+      /*!
+       * @brief Chunk of the size indices held in the first lanes of indices
+       */
+      RAJA_INLINE
+      static
+      self_type list(index_register_type const &indices, camp::idx_t size){
+        self_type chunk;
+        chunk.m_indices = indices;
+        chunk.m_size = size;
+        chunk.m_contiguous = false;
+        return chunk;
+      }
+
+      //! number of indices in the chunk
+      RAJA_INLINE
+      camp::idx_t size() const {
+        return m_size;
+      }
+
+      //! true if every lane holds an index
+      RAJA_INLINE
+      bool is_full() const {
+        return m_size == s_num_elem;
+      }
+
+      //! true if the indices are consecutive
+      RAJA_INLINE
+      bool is_contiguous() const {
+        return m_contiguous;
+      }
+
+      //! index held in lane
+      RAJA_INLINE
+      index_type get(camp::idx_t lane) const {
+        return m_contiguous ? index_type(m_begin + lane) : m_indices.get(lane);
+      }
+
+      /*!
+       * @brief The indices as a register, lanes past size() are unspecified
+       */
+      RAJA_INLINE
+      index_register_type get_indices() const {
+        if(!m_contiguous){
+          return m_indices;
+        }
+        index_register_type indices;
+        for(camp::idx_t lane = 0;lane < s_num_elem;++ lane){
+          indices.set(index_type(m_begin + lane), lane);
+        }
+        return indices;
+      }
+
+      /*!
+       * @brief Load ptr[i] for each index i of the chunk, lanes past size()
+       *        are zero
+       */
+      template<typename U>
+      RAJA_INLINE
+      Register<U, REGISTER_POLICY> load(U const *ptr) const {
+        static_assert(Register<U, REGISTER_POLICY>::s_num_elem == s_num_elem,
+            "SimdIndex can only load elements the size of its element type");
+
+        Register<U, REGISTER_POLICY> value;
+        if(m_contiguous){
+          if(is_full()){
+            value.load_packed(ptr + m_begin);
+          }
+          else{
+            value.load_packed_n(ptr + m_begin, m_size);
+          }
+        }
+        else{
+          if(is_full()){
+            value.gather(ptr, m_indices);
+          }
+          else{
+            value.gather_n(ptr, m_indices, m_size);
+          }
+        }
+        return value;
+      }
+
+      /*!
+       * @brief Store the first size() lanes of value to ptr[i] for each
+       *        index i of the chunk
+       *
+       * Lanes with the same index are stored in lane order, so the last
+       * one is kept as in a sequential loop.
+       */
+      template<typename U>
+      RAJA_INLINE
+      void store(U *ptr, Register<U, REGISTER_POLICY> const &value) const {
+        static_assert(Register<U, REGISTER_POLICY>::s_num_elem == s_num_elem,
+            "SimdIndex can only store elements the size of its element type");
+
+        if(m_contiguous){
+          if(is_full()){
+            value.store_packed(ptr + m_begin);
+          }
+          else{
+            value.store_packed_n(ptr + m_begin, m_size);
+          }
+        }
+        else{
+          if(is_full()){
+            value.scatter(ptr, m_indices);
+          }
+          else{
+            value.scatter_n(ptr, m_indices, m_size);
+          }
+        }
+      }
+
+    private:
+      index_register_type m_indices;
+      index_type m_begin = 0;
+      camp::idx_t m_size = 0;
+      bool m_contiguous = true;
+  };
+
+} // namespace expt
+}  // namespace RAJA
+
+
+#endif
@@ -34,7 +34,8 @@ enum class Policy {
   target_openmp,
   cuda,
   hip,
-  sycl
+  sycl,
+  threads
 };
 
 enum class Pattern {
@@ -215,6 +216,9 @@ struct is_hip_policy : RAJA::policy_is<Pol, RAJA::Policy::hip> {
 template <typename Pol>
 struct is_sycl_policy : RAJA::policy_is<Pol, RAJA::Policy::sycl> {
 };
+template <typename Pol>
+struct is_threads_policy : RAJA::policy_is<Pol, RAJA::Policy::threads> {
+};
 
 template <typename Pol>
 struct is_device_exec_policy
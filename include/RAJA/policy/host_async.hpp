@@ -0,0 +1,37 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA headers for asynchronous host
+ *          execution on HostAsync resources.
+ *
+ *          Work given a HostAsync resource runs in order on a worker thread
+ *          owned by the resource and returns events that can be waited on.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_host_async_HPP
+#define RAJA_host_async_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/policy/host_async/policy.hpp"
+#include "RAJA/policy/host_async/resource.hpp"
+#include "RAJA/policy/host_async/forall.hpp"
+#include "RAJA/policy/host_async/scan.hpp"
+#include "RAJA/policy/host_async/sort.hpp"
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,82 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA forall dispatch for the asynchronous
+ *          host resource.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_host_async_HPP
+#define RAJA_forall_host_async_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/policy/sequential/forall.hpp"
+#include "RAJA/policy/host_async/policy.hpp"
+#include "RAJA/policy/host_async/resource.hpp"
+
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+namespace resources
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Enqueue a forall with a host execution policy on a HostAsync resource.
+// The policy, segment, body, and params are copied into the task, which
+// runs the host implementation of the policy on the resource's worker
+// thread. This overload is found by argument dependent lookup on the
+// resource type.
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+template <typename ExecPol, typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE resources::EventProxy<resources::HostAsync>
+forall_impl(resources::HostAsync host_async_res,
+            ExecPol&& pol,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  static_assert(RAJA::type_traits::is_host_async_policy<camp::decay<ExecPol>>::value,
+                "HostAsync resources only run host execution policies");
+
+  camp::decay<ExecPol> task_pol(pol);
+  camp::decay<Iterable> task_iter(iter);
+  camp::decay<Func> task_body(loop_body);
+
+  host_async_res.enqueue([=]() mutable {
+    using RAJA::policy::sequential::forall_impl;
+    forall_impl(resources::Host::get_default(),
+                task_pol,
+                task_iter,
+                task_body,
+                f_params);
+  });
+
+  return resources::EventProxy<resources::HostAsync>(host_async_res);
+}
+
+}  // namespace resources
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
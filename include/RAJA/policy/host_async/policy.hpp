@@ -0,0 +1,43 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the traits used to dispatch work to the
+ *          asynchronous host resource.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_host_async_HPP
+#define policy_host_async_HPP
+
+#include <type_traits>
+
+#include "RAJA/internal/get_platform.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+
+namespace RAJA
+{
+namespace type_traits
+{
+
+//! execution policies that can run on a HostAsync resource
+template <typename Pol>
+struct is_host_async_policy
+    : std::integral_constant<bool,
+                             RAJA::detail::get_platform<Pol>::value ==
+                                 RAJA::Platform::host> {
+};
+
+}  // namespace type_traits
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,428 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the asynchronous host resource.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_host_async_resource_HPP
+#define RAJA_host_async_resource_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "camp/resource.hpp"
+
+namespace RAJA
+{
+namespace resources
+{
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Move only host task that stores small callables inline.
+ *
+ * Callables up to inline_bytes are stored in the task itself, so enqueueing
+ * a kernel or memory operation does not allocate. Larger callables are
+ * allocated on the heap.
+ *
+ ******************************************************************************
+ */
+class HostAsyncTask
+{
+public:
+  static constexpr size_t inline_bytes = 64;
+
+  template <typename Task,
+            typename F = typename std::decay<Task>::type,
+            typename = typename std::enable_if<
+                !std::is_same<F, HostAsyncTask>::value>::type>
+  explicit HostAsyncTask(Task&& task)
+  {
+    construct<F>(std::forward<Task>(task), fits_inline<F>{});
+  }
+
+  HostAsyncTask(HostAsyncTask&& other) noexcept : m_ops(other.m_ops)
+  {
+    m_ops->move(&m_storage, &other.m_storage);
+  }
+
+  HostAsyncTask(HostAsyncTask const&) = delete;
+  HostAsyncTask& operator=(HostAsyncTask const&) = delete;
+  HostAsyncTask& operator=(HostAsyncTask&&) = delete;
+
+  ~HostAsyncTask() { m_ops->destroy(&m_storage); }
+
+  void operator()() { m_ops->invoke(&m_storage); }
+
+private:
+  using storage_type =
+      typename std::aligned_storage<inline_bytes, alignof(std::max_align_t)>::type;
+
+  struct operations {
+    void (*invoke)(void*);
+    void (*move)(void*, void*);
+    void (*destroy)(void*);
+  };
+
+  template <typename F>
+  using fits_inline = std::integral_constant<
+      bool,
+      sizeof(F) <= inline_bytes && alignof(F) <= alignof(std::max_align_t) &&
+          std::is_nothrow_move_constructible<F>::value>;
+
+  template <typename F>
+  struct inline_operations {
+    static void invoke(void* s) { (*static_cast<F*>(s))(); }
+    static void move(void* dst, void* src)
+    {
+      new (dst) F(std::move(*static_cast<F*>(src)));
+    }
+    static void destroy(void* s) { static_cast<F*>(s)->~F(); }
+    static constexpr operations ops{&invoke, &move, &destroy};
+  };
+
+  template <typename F>
+  struct heap_operations {
+    static F*& get(void* s) { return *static_cast<F**>(s); }
+    static void invoke(void* s) { (*get(s))(); }
+    static void move(void* dst, void* src)
+    {
+      new (dst) F*(get(src));
+      get(src) = nullptr;
+    }
+    static void destroy(void* s) { delete get(s); }
+    static constexpr operations ops{&invoke, &move, &destroy};
+  };
+
+  template <typename F, typename Task>
+  void construct(Task&& task, std::true_type)
+  {
+    new (&m_storage) F(std::forward<Task>(task));
+    m_ops = &inline_operations<F>::ops;
+  }
+
+  template <typename F, typename Task>
+  void construct(Task&& task, std::false_type)
+  {
+    new (&m_storage) F*(new F(std::forward<Task>(task)));
+    m_ops = &heap_operations<F>::ops;
+  }
+
+  storage_type m_storage;
+  const operations* m_ops;
+};
+
+template <typename F>
+constexpr HostAsyncTask::operations HostAsyncTask::inline_operations<F>::ops;
+
+template <typename F>
+constexpr HostAsyncTask::operations HostAsyncTask::heap_operations<F>::ops;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  In order queue of host tasks run by a dedicated worker thread.
+ *
+ * Each task gets a ticket, tickets are handed out and completed in order so
+ * the work enqueued up to a ticket is complete when the completed count
+ * reaches it.
+ *
+ ******************************************************************************
+ */
+class HostAsyncStream
+{
+public:
+  using ticket_type = unsigned long long;
+
+  HostAsyncStream()
+      : m_state(std::make_shared<State>()),
+        m_worker([state = m_state]() { worker_loop(*state); }),
+        m_worker_id(m_worker.get_id())
+  { }
+
+  HostAsyncStream(HostAsyncStream const&) = delete;
+  HostAsyncStream& operator=(HostAsyncStream const&) = delete;
+
+  //! finish the enqueued tasks and stop the worker
+  ~HostAsyncStream()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_state->mutex);
+      m_state->stop = true;
+    }
+    m_state->task_cv.notify_one();
+    if (std::this_thread::get_id() == m_worker_id) {
+      // the last reference was released by one of the stream's own tasks,
+      // the worker keeps the state alive until it drains the queue
+      m_worker.detach();
+    } else {
+      m_worker.join();
+    }
+  }
+
+  //! add a task to the queue and return its ticket
+  ticket_type enqueue(HostAsyncTask&& task)
+  {
+    ticket_type ticket;
+    {
+      std::lock_guard<std::mutex> lock(m_state->mutex);
+      m_state->tasks.push_back(std::move(task));
+      ticket = ++m_state->enqueued;
+    }
+    m_state->task_cv.notify_one();
+    return ticket;
+  }
+
+  //! ticket of the last task added to the queue
+  ticket_type last_ticket() const
+  {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->enqueued;
+  }
+
+  bool is_complete(ticket_type ticket) const
+  {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->completed >= ticket;
+  }
+
+  //! block until the task with the given ticket and all before it finish
+  void wait_until(ticket_type ticket) const
+  {
+    // a task waiting on its own stream only depends on the tasks before it,
+    // which are complete
+    if (std::this_thread::get_id() == m_worker_id) {
+      return;
+    }
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+    m_state->done_cv.wait(lock,
+                          [&]() { return m_state->completed >= ticket; });
+  }
+
+private:
+  //! queue state, shared with the worker so it outlives a detached worker
+  struct State {
+    std::mutex mutex;
+    std::condition_variable task_cv;
+    std::condition_variable done_cv;
+    std::deque<HostAsyncTask> tasks;
+    ticket_type enqueued = 0;
+    ticket_type completed = 0;
+    bool stop = false;
+  };
+
+  std::shared_ptr<State> m_state;
+  std::thread m_worker;
+  std::thread::id m_worker_id;
+
+  static void worker_loop(State& state)
+  {
+    std::unique_lock<std::mutex> lock(state.mutex);
+    for (;;) {
+      state.task_cv.wait(lock,
+                         [&]() { return state.stop || !state.tasks.empty(); });
+      if (state.tasks.empty()) {
+        return;
+      }
+      {
+        HostAsyncTask task = std::move(state.tasks.front());
+        state.tasks.pop_front();
+
+        lock.unlock();
+        task();
+      }
+      lock.lock();
+
+      ++state.completed;
+      state.done_cv.notify_all();
+    }
+  }
+};
+
+/*!
+ * \brief  Stream shared by the resources of the given group, streams of
+ *         groups are started on first use and live until the end of the
+ *         program.
+ */
+inline std::shared_ptr<HostAsyncStream> get_host_async_group_stream(int group)
+{
+  static std::mutex streams_mutex;
+  static std::map<int, std::shared_ptr<HostAsyncStream>> streams;
+
+  std::lock_guard<std::mutex> lock(streams_mutex);
+  std::shared_ptr<HostAsyncStream>& stream = streams[group];
+  if (!stream) {
+    stream = std::make_shared<HostAsyncStream>();
+  }
+  return stream;
+}
+
+}  // namespace detail
+
+/*!
+ * \brief  Event marking the completion of the work enqueued on a HostAsync
+ *         resource before the event was created.
+ */
+class HostAsyncEvent
+{
+public:
+  HostAsyncEvent(std::shared_ptr<detail::HostAsyncStream> stream,
+                 detail::HostAsyncStream::ticket_type ticket)
+      : m_stream(std::move(stream)), m_ticket(ticket)
+  { }
+
+  bool check() const { return m_stream->is_complete(m_ticket); }
+
+  void wait() const { m_stream->wait_until(m_ticket); }
+
+  detail::HostAsyncStream* get_stream() const { return m_stream.get(); }
+
+private:
+  std::shared_ptr<detail::HostAsyncStream> m_stream;
+  detail::HostAsyncStream::ticket_type m_ticket;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Host resource that runs work asynchronously in order on a worker
+ *         thread, like a cuda or hip stream.
+ *
+ * Kernels and memory operations given a HostAsync resource are enqueued and
+ * return right away, the returned events and wait can be used to wait for
+ * them. wait_for enqueues a dependency on an event from another resource.
+ * Arbitrary host work, for example I/O, can be added with enqueue.
+ *
+ * Each default constructed resource starts its own worker thread, shared by
+ * its copies and stopped when the last copy and event are destroyed.
+ * Resources constructed with the same group share one worker and run their
+ * work in order with each other, get_default uses group 0.
+ *
+ * Kernel bodies and segments are copied when the work is enqueued, data they
+ * point to must stay valid until the work completes.
+ *
+ ******************************************************************************
+ */
+class HostAsync
+{
+public:
+  //! use a new stream, or the stream of the given group when group >= 0
+  HostAsync(int group = -1)
+      : m_stream((group < 0) ? std::make_shared<detail::HostAsyncStream>()
+                             : detail::get_host_async_group_stream(group))
+  { }
+
+  static HostAsync get_default()
+  {
+    static HostAsync h(0);
+    return h;
+  }
+
+  camp::resources::Platform get_platform() const
+  {
+    return camp::resources::Platform::host;
+  }
+
+  //! enqueue a host task on this resource
+  template <typename Task>
+  void enqueue(Task&& task)
+  {
+    m_stream->enqueue(detail::HostAsyncTask(std::forward<Task>(task)));
+  }
+
+  HostAsyncEvent get_event()
+  {
+    return HostAsyncEvent(m_stream, m_stream->last_ticket());
+  }
+
+  camp::resources::Event get_event_erased()
+  {
+    return camp::resources::Event{get_event()};
+  }
+
+  //! block until all the work enqueued on this resource completes
+  void wait() { m_stream->wait_until(m_stream->last_ticket()); }
+
+  //! make work enqueued on this resource after this call wait for e
+  void wait_for(camp::resources::Event* e)
+  {
+    if (!e->check()) {
+      camp::resources::Event event = *e;
+      enqueue([event]() mutable { event.wait(); });
+    }
+  }
+
+  template <typename T>
+  T* allocate(size_t size,
+              camp::resources::MemoryAccess = camp::resources::MemoryAccess::Device)
+  {
+    return static_cast<T*>(std::malloc(sizeof(T) * size));
+  }
+
+  void* calloc(size_t size,
+               camp::resources::MemoryAccess = camp::resources::MemoryAccess::Device)
+  {
+    return std::calloc(size, 1);
+  }
+
+  //! waits for the enqueued work before freeing, like cudaFree
+  void deallocate(void* p,
+                  camp::resources::MemoryAccess = camp::resources::MemoryAccess::Device)
+  {
+    wait();
+    std::free(p);
+  }
+
+  void memcpy(void* dst, const void* src, size_t size)
+  {
+    enqueue([=]() { std::memcpy(dst, src, size); });
+  }
+
+  void memset(void* p, int val, size_t size)
+  {
+    enqueue([=]() { std::memset(p, val, size); });
+  }
+
+  detail::HostAsyncStream* get_stream() const { return m_stream.get(); }
+
+  bool operator==(HostAsync const& h) const { return m_stream == h.m_stream; }
+  bool operator!=(HostAsync const& h) const { return m_stream != h.m_stream; }
+
+private:
+  std::shared_ptr<detail::HostAsyncStream> m_stream;
+};
+
+}  // namespace resources
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,147 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA scan dispatch for the asynchronous
+ *          host resource.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scan_host_async_HPP
+#define RAJA_scan_host_async_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/policy/host_async/policy.hpp"
+#include "RAJA/policy/host_async/resource.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace scan
+{
+
+/*!
+        \brief enqueue an inclusive inplace scan on a HostAsync resource
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::HostAsync>,
+                      type_traits::is_host_async_policy<ExecPolicy>>
+inclusive_inplace(
+    resources::HostAsync host_async_res,
+    const ExecPolicy& exec,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  host_async_res.enqueue([=]() {
+    scan::inclusive_inplace(resources::Host::get_default(), exec, begin, end, f);
+  });
+
+  return resources::EventProxy<resources::HostAsync>(host_async_res);
+}
+
+/*!
+        \brief enqueue an exclusive inplace scan on a HostAsync resource
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename BinFn,
+          typename ValueT>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::HostAsync>,
+                      type_traits::is_host_async_policy<ExecPolicy>>
+exclusive_inplace(
+    resources::HostAsync host_async_res,
+    const ExecPolicy& exec,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  host_async_res.enqueue([=]() {
+    scan::exclusive_inplace(resources::Host::get_default(), exec, begin, end, f, v);
+  });
+
+  return resources::EventProxy<resources::HostAsync>(host_async_res);
+}
+
+/*!
+        \brief enqueue an inclusive scan on a HostAsync resource
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::HostAsync>,
+                      type_traits::is_host_async_policy<ExecPolicy>>
+inclusive(
+    resources::HostAsync host_async_res,
+    const ExecPolicy& exec,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  host_async_res.enqueue([=]() {
+    scan::inclusive(resources::Host::get_default(), exec, begin, end, out, f);
+  });
+
+  return resources::EventProxy<resources::HostAsync>(host_async_res);
+}
+
+/*!
+        \brief enqueue an exclusive scan on a HostAsync resource
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::HostAsync>,
+                      type_traits::is_host_async_policy<ExecPolicy>>
+exclusive(
+    resources::HostAsync host_async_res,
+    const ExecPolicy& exec,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  host_async_res.enqueue([=]() {
+    scan::exclusive(resources::Host::get_default(), exec, begin, end, out, f, v);
+  });
+
+  return resources::EventProxy<resources::HostAsync>(host_async_res);
+}
+
+}  // namespace scan
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,143 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA sort dispatch for the asynchronous
+ *          host resource.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_host_async_HPP
+#define RAJA_sort_host_async_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/policy/host_async/policy.hpp"
+#include "RAJA/policy/host_async/resource.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+/*!
+        \brief enqueue an unstable sort on a HostAsync resource
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::HostAsync>,
+                      type_traits::is_host_async_policy<ExecPolicy>>
+unstable(
+    resources::HostAsync host_async_res,
+    const ExecPolicy& exec,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  host_async_res.enqueue([=]() {
+    sort::unstable(resources::Host::get_default(), exec, begin, end, comp);
+  });
+
+  return resources::EventProxy<resources::HostAsync>(host_async_res);
+}
+
+/*!
+        \brief enqueue a stable sort on a HostAsync resource
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::HostAsync>,
+                      type_traits::is_host_async_policy<ExecPolicy>>
+stable(
+    resources::HostAsync host_async_res,
+    const ExecPolicy& exec,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  host_async_res.enqueue([=]() {
+    sort::stable(resources::Host::get_default(), exec, begin, end, comp);
+  });
+
+  return resources::EventProxy<resources::HostAsync>(host_async_res);
+}
+
+/*!
+        \brief enqueue an unstable pairs sort on a HostAsync resource
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::HostAsync>,
+                      type_traits::is_host_async_policy<ExecPolicy>>
+unstable_pairs(
+    resources::HostAsync host_async_res,
+    const ExecPolicy& exec,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  host_async_res.enqueue([=]() {
+    sort::unstable_pairs(resources::Host::get_default(), exec, keys_begin, keys_end, vals_begin, comp);
+  });
+
+  return resources::EventProxy<resources::HostAsync>(host_async_res);
+}
+
+/*!
+        \brief enqueue a stable pairs sort on a HostAsync resource
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::HostAsync>,
+                      type_traits::is_host_async_policy<ExecPolicy>>
+stable_pairs(
+    resources::HostAsync host_async_res,
+    const ExecPolicy& exec,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  host_async_res.enqueue([=]() {
+    sort::stable_pairs(resources::Host::get_default(), exec, keys_begin, keys_end, vals_begin, comp);
+  });
+
+  return resources::EventProxy<resources::HostAsync>(host_async_res);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
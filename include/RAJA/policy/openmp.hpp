@@ -34,6 +34,7 @@
 #endif
 
 #include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/fused_forall.hpp"
 #include "RAJA/policy/openmp/kernel.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/openmp/reduce.hpp"
@@ -41,6 +42,8 @@
 #include "RAJA/policy/openmp/region.hpp"
 #include "RAJA/policy/openmp/scan.hpp"
 #include "RAJA/policy/openmp/sort.hpp"
+#include "RAJA/policy/openmp/compact.hpp"
+#include "RAJA/policy/openmp/histogram.hpp"
 #include "RAJA/policy/openmp/synchronize.hpp"
 #include "RAJA/policy/openmp/launch.hpp"
 #include "RAJA/policy/openmp/WorkGroup.hpp"
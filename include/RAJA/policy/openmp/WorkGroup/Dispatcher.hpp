@@ -40,6 +40,15 @@ inline const Dispatcher_T* get_Dispatcher(omp_work const&)
   return get_Dispatcher<T, Dispatcher_T>(seq_work{});
 }
 
+/*!
+* Populate and return a Dispatcher object
+*/
+template < typename T, typename Dispatcher_T, int Grain >
+inline const Dispatcher_T* get_Dispatcher(omp_ws_work<Grain> const&)
+{
+  return get_Dispatcher<T, Dispatcher_T>(seq_work{});
+}
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -20,8 +20,17 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <omp.h>
+
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/work_stealing.hpp"
 
+#include "RAJA/pattern/detail/privatizer.hpp"
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
 
 
@@ -81,6 +90,328 @@ struct WorkRunner<
         Args...>
 { };
 
+/*!
+ * Runs work in a storage container in order using work stealing loops
+ * and returns any per run resources
+ */
+template <int Grain,
+          typename DISPATCH_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_ws_work<Grain>,
+        RAJA::ordered,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerForallOrdered<
+        RAJA::omp_parallel_ws_exec<Grain>,
+        RAJA::omp_ws_work<Grain>,
+        RAJA::ordered,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{ };
+
+/*!
+ * Runs work in a storage container in reverse order using work stealing
+ * loops and returns any per run resources
+ */
+template <int Grain,
+          typename DISPATCH_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_ws_work<Grain>,
+        RAJA::reverse_ordered,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerForallReverse<
+        RAJA::omp_parallel_ws_exec<Grain>,
+        RAJA::omp_ws_work<Grain>,
+        RAJA::reverse_ordered,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{ };
+
+
+/*!
+ * A body and segment holder for storing loops that will be executed
+ * a range of iterations at a time by the threads of a parallel region
+ */
+template <typename Segment_type, typename LoopBody,
+          typename index_type, typename ... Args>
+struct HoldOmpFlattenedLoop
+{
+  template < typename segment_in, typename body_in >
+  HoldOmpFlattenedLoop(segment_in&& segment, body_in&& body)
+    : m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  // run iterations [i_begin, i_end) of the segment
+  RAJA_INLINE void operator()(index_type i_begin, index_type i_end,
+                              Args... args) const
+  {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(m_body);
+    auto& body = privatizer.get_priv();
+    const auto begin = m_segment.begin();
+    for ( index_type i = i_begin; i < i_end; ++i ) {
+      body(begin[i], args...);
+    }
+  }
+
+private:
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+/*!
+ * Split the flattened iteration space [0, len) among the threads of the
+ * current parallel region, called by every thread in the region
+ */
+template < typename Func >
+RAJA_INLINE void omp_flattened_for(RAJA::omp_work const&,
+                                   std::ptrdiff_t len, Func&& func)
+{
+  const std::ptrdiff_t num_threads = omp_get_num_threads();
+  const std::ptrdiff_t tid = omp_get_thread_num();
+  const std::ptrdiff_t per_thread = len / num_threads;
+  const std::ptrdiff_t extra = len % num_threads;
+  const std::ptrdiff_t begin = tid * per_thread + ((tid < extra) ? tid : extra);
+  const std::ptrdiff_t end = begin + per_thread + ((tid < extra) ? 1 : 0);
+  if (begin < end) {
+    func(begin, end);
+  }
+}
+///
+template < int Grain, typename Func >
+RAJA_INLINE void omp_flattened_for(RAJA::omp_ws_work<Grain> const&,
+                                   std::ptrdiff_t len, Func&& func)
+{
+  RAJA::detail::openmp::work_stealing_for(Grain, len,
+                                          std::forward<Func>(func));
+}
+
+/*!
+ * Runs work in a storage container out of order by flattening the iterations
+ * of all the loops into a single iteration space that is split among the
+ * threads of one parallel region, so small loops do not each pay for a
+ * parallel region and a barrier
+ */
+template <typename EXEC_POLICY_T,
+          typename DISPATCH_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunnerOmpFlattened
+{
+  using exec_policy = EXEC_POLICY_T;
+  using order_policy = RAJA::policy::omp::unordered_omp_flattened_loop_iter;
+  using dispatch_policy = DISPATCH_POLICY_T;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+  using resource_type = resources::Host;
+
+  // The type that will hold the segment and loop body in work storage
+  struct holder_type {
+    template < typename T >
+    using type = HoldOmpFlattenedLoop<
+        typename camp::at<T, camp::num<0>>::type, // ITERABLE
+        typename camp::at<T, camp::num<1>>::type, // LOOP_BODY
+        index_type, Args...>;
+  };
+  ///
+  template < typename T >
+  using holder_type_t = typename holder_type::template type<T>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the host in a parallel region
+  using dispatcher_exec_policy = exec_policy;
+
+  // The Dispatcher policy with holder_types used internally to handle the
+  // ranges and callables passed in by the user.
+  using dispatcher_holder_policy = dispatcher_transform_types_t<dispatch_policy, holder_type>;
+
+  using dispatcher_type = Dispatcher<Platform::host, dispatcher_holder_policy, void, index_type, index_type, Args...>;
+
+  WorkRunnerOmpFlattened() = default;
+
+  WorkRunnerOmpFlattened(WorkRunnerOmpFlattened const&) = delete;
+  WorkRunnerOmpFlattened& operator=(WorkRunnerOmpFlattened const&) = delete;
+
+  WorkRunnerOmpFlattened(WorkRunnerOmpFlattened && o)
+    : m_loop_offsets(std::move(o.m_loop_offsets))
+    , m_total_iterations(o.m_total_iterations)
+  {
+    o.m_loop_offsets.clear();
+    o.m_total_iterations = 0;
+  }
+  WorkRunnerOmpFlattened& operator=(WorkRunnerOmpFlattened && o)
+  {
+    m_loop_offsets = std::move(o.m_loop_offsets);
+    m_total_iterations = o.m_total_iterations;
+
+    o.m_loop_offsets.clear();
+    o.m_total_iterations = 0;
+    return *this;
+  }
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename Iterable, typename LoopBody >
+  inline void enqueue(WorkContainer& storage, Iterable&& iter, LoopBody&& loop_body)
+  {
+    using LOOP_BODY = camp::decay<LoopBody>;
+    using ITERABLE  = camp::decay<Iterable>;
+
+    using holder = holder_type_t<camp::list<ITERABLE, LOOP_BODY>>;
+
+    const std::ptrdiff_t len = std::distance(std::begin(iter), std::end(iter));
+
+    // Only store loops that have something to iterate over so the offsets
+    // of the stored loops are strictly increasing
+    if (len > 0) {
+
+      m_loop_offsets.push_back(m_total_iterations);
+      m_total_iterations += len;
+
+      storage.template emplace<holder>(
+          get_Dispatcher<holder, dispatcher_type>(dispatcher_exec_policy{}),
+          std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+    }
+  }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, resource_type, Args... args) const
+  {
+    using Iterator  = camp::decay<decltype(std::begin(storage))>;
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    Iterator begin = std::begin(storage);
+    const std::ptrdiff_t num_loops = std::distance(begin, std::end(storage));
+    const std::ptrdiff_t total_iterations = m_total_iterations;
+    const std::ptrdiff_t* offsets = m_loop_offsets.data();
+
+    // Only open a parallel region if we have something to iterate over
+    if (num_loops > 0 && total_iterations > 0) {
+
+#pragma omp parallel
+      {
+        omp_flattened_for(exec_policy{}, total_iterations,
+            [&](std::ptrdiff_t i_begin, std::ptrdiff_t i_end) {
+          // find the loop containing the first iteration of the range,
+          // then walk forward across loop boundaries
+          std::ptrdiff_t i_loop =
+              std::upper_bound(offsets, offsets + num_loops, i_begin) - offsets - 1;
+          while (i_begin < i_end) {
+            const std::ptrdiff_t loop_end = (i_loop + 1 < num_loops)
+                                                ? offsets[i_loop + 1]
+                                                : total_iterations;
+            const std::ptrdiff_t stop = (i_end < loop_end) ? i_end : loop_end;
+            value_type::host_call(&begin[i_loop],
+                                  static_cast<index_type>(i_begin - offsets[i_loop]),
+                                  static_cast<index_type>(stop - offsets[i_loop]),
+                                  args...);
+            i_begin = stop;
+            ++i_loop;
+          }
+        });
+      }
+    }
+
+    return run_storage;
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_loop_offsets.clear();
+    m_total_iterations = 0;
+  }
+
+private:
+  std::vector<std::ptrdiff_t> m_loop_offsets;
+  std::ptrdiff_t m_total_iterations = 0;
+};
+
+/*!
+ * Runs work in a storage container out of order with the iterations of all
+ * the loops split statically among the threads of one parallel region
+ */
+template <typename DISPATCH_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work,
+        RAJA::policy::omp::unordered_omp_flattened_loop_iter,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerOmpFlattened<
+        RAJA::omp_work,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using base = WorkRunnerOmpFlattened<
+        RAJA::omp_work,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>;
+  using base::base;
+};
+
+/*!
+ * Runs work in a storage container out of order with the iterations of all
+ * the loops split among the threads of one parallel region using work stealing
+ */
+template <int Grain,
+          typename DISPATCH_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_ws_work<Grain>,
+        RAJA::policy::omp::unordered_omp_flattened_loop_iter,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerOmpFlattened<
+        RAJA::omp_ws_work<Grain>,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using base = WorkRunnerOmpFlattened<
+        RAJA::omp_ws_work<Grain>,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>;
+  using base::base;
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -0,0 +1,349 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_openmp_HPP
+#define RAJA_compact_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/util/Operators.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/scan.hpp"
+#include "RAJA/policy/sequential/compact.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+namespace detail
+{
+namespace openmp
+{
+
+using ::RAJA::impl::scan::detail::openmp::ScanTileStatus;
+using ::RAJA::impl::scan::detail::openmp::get_scan_tile_iterates;
+using ::RAJA::impl::scan::detail::openmp::scan_tile_look_back;
+
+/*!
+        \brief single pass compaction of n items, calls write(i, selected,
+   dst) for each item i in order within each tile where selected is
+   select(i) and dst is the number of selected items before i, returns the
+   number of selected items
+
+   Threads take cache sized tiles in order. Each thread evaluates select
+   for its tile, publishes the count, looks back at earlier tiles for the
+   number selected before the tile as in the single pass scan, and then
+   writes the tile while it is still in cache.
+*/
+template <typename Item,
+          typename DistanceT,
+          typename SelectFn,
+          typename WriteFn>
+RAJA_INLINE
+DistanceT
+single_pass_compact(
+    DistanceT n,
+    SelectFn select,
+    WriteFn write)
+{
+  using TileStatus = ScanTileStatus<DistanceT>;
+  const DistanceT tile_size = get_scan_tile_iterates<Item>();
+  const DistanceT num_tiles = (n + tile_size - 1) / tile_size;
+  const int p0 = std::min(num_tiles, static_cast<DistanceT>(omp_get_max_threads()));
+
+  std::unique_ptr<TileStatus[]> status(new TileStatus[num_tiles]);
+  std::atomic<DistanceT> next_tile{0};
+
+#pragma omp parallel num_threads(p0)
+  {
+    ::std::vector<char> selected(tile_size);
+
+    for (DistanceT tile = next_tile.fetch_add(1, std::memory_order_relaxed);
+         tile < num_tiles;
+         tile = next_tile.fetch_add(1, std::memory_order_relaxed)) {
+
+      const DistanceT idx_begin = tile * tile_size;
+      const DistanceT idx_end = std::min(idx_begin + tile_size, n);
+      TileStatus& tile_status = status[tile];
+
+      DistanceT count = 0;
+      for (DistanceT i = idx_begin; i < idx_end; ++i) {
+        const bool s = select(i);
+        selected[i - idx_begin] = s;
+        count += s ? 1 : 0;
+      }
+
+      DistanceT dst = 0;
+      if (tile == 0) {
+        tile_status.prefix = count;
+        tile_status.flag.store(TileStatus::prefix_available,
+                               std::memory_order_release);
+      } else {
+        tile_status.aggregate = count;
+        tile_status.flag.store(TileStatus::aggregate_available,
+                               std::memory_order_release);
+        dst = scan_tile_look_back(status.get(), tile,
+                                  RAJA::operators::plus<DistanceT>{});
+        tile_status.prefix = dst + count;
+        tile_status.flag.store(TileStatus::prefix_available,
+                               std::memory_order_release);
+      }
+
+      for (DistanceT i = idx_begin; i < idx_end; ++i) {
+        const bool s = selected[i - idx_begin];
+        write(i, s, dst);
+        dst += s ? 1 : 0;
+      }
+    }
+  }
+
+  return status[num_tiles - 1].prefix;
+}
+
+/*!
+        \brief copy the first n items of from to to in parallel
+*/
+template <typename FromIter, typename ToIter, typename DistanceT>
+RAJA_INLINE
+void
+parallel_copy(
+    FromIter from,
+    ToIter to,
+    DistanceT n)
+{
+#pragma omp parallel for
+  for (DistanceT i = 0; i < n; ++i) {
+    to[i] = from[i];
+  }
+}
+
+}  // namespace openmp
+
+}  // namespace detail
+
+/*!
+        \brief copy the items of the input range that satisfy pred to out,
+   returns the number of items copied
+*/
+template <typename Policy, typename Iter, typename OutIter, typename Pred>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                      type_traits::is_openmp_policy<Policy>>
+copy_if(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    Pred pred)
+{
+  using std::distance;
+  using Value = RAJA::detail::IterVal<Iter>;
+  const auto n = distance(begin, end);
+  if (n <= scan::detail::openmp::get_scan_tile_iterates<Value>()) {
+    return compact::copy_if(host_res, ::RAJA::seq_exec{}, begin, end, out,
+                            pred);
+  }
+
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  return detail::openmp::single_pass_compact<Value>(
+      n,
+      [=](DistanceT i) { return static_cast<bool>(pred(begin[i])); },
+      [=](DistanceT i, bool selected, DistanceT dst) {
+        if (selected) {
+          out[dst] = begin[i];
+        }
+      });
+}
+
+/*!
+        \brief move the items that satisfy pred before the items that do
+   not keeping the order of each group, returns the number of items that
+   satisfy pred
+*/
+template <typename Policy, typename Iter, typename Pred>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                      type_traits::is_openmp_policy<Policy>>
+stable_partition(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    Pred pred)
+{
+  using std::distance;
+  using Value = RAJA::detail::IterVal<Iter>;
+  const auto n = distance(begin, end);
+  if (n <= scan::detail::openmp::get_scan_tile_iterates<Value>()) {
+    return compact::stable_partition(host_res, ::RAJA::seq_exec{}, begin, end,
+                                     pred);
+  }
+
+  // the items that satisfy pred are written to the front of tmp in order
+  // and the others to the back in reverse order, then both are copied back
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  std::unique_ptr<Value[]> tmp(new Value[n]);
+  Value* tmp_ptr = tmp.get();
+  const DistanceT count = detail::openmp::single_pass_compact<Value>(
+      n,
+      [=](DistanceT i) { return static_cast<bool>(pred(begin[i])); },
+      [=](DistanceT i, bool selected, DistanceT dst) {
+        if (selected) {
+          tmp_ptr[dst] = begin[i];
+        } else {
+          tmp_ptr[n - 1 - (i - dst)] = begin[i];
+        }
+      });
+
+#pragma omp parallel for
+  for (DistanceT i = 0; i < n; ++i) {
+    begin[i] = (i < count) ? tmp_ptr[i] : tmp_ptr[n - 1 - (i - count)];
+  }
+
+  return count;
+}
+
+/*!
+        \brief move the items that satisfy pred before the items that do
+   not, returns the number of items that satisfy pred
+*/
+template <typename Policy, typename Iter, typename Pred>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                      type_traits::is_openmp_policy<Policy>>
+partition(
+    resources::Host host_res,
+    const Policy& p,
+    Iter begin,
+    Iter end,
+    Pred pred)
+{
+  return compact::stable_partition(host_res, p, begin, end, pred);
+}
+
+/*!
+        \brief keep the first item of each run of equal consecutive items,
+   returns the number of items kept
+*/
+template <typename Policy, typename Iter, typename BinPred>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                      type_traits::is_openmp_policy<Policy>>
+unique(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    BinPred eq)
+{
+  using std::distance;
+  using Value = RAJA::detail::IterVal<Iter>;
+  const auto n = distance(begin, end);
+  if (n <= scan::detail::openmp::get_scan_tile_iterates<Value>()) {
+    return compact::unique(host_res, ::RAJA::seq_exec{}, begin, end, eq);
+  }
+
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  std::unique_ptr<Value[]> tmp(new Value[n]);
+  Value* tmp_ptr = tmp.get();
+  const DistanceT count = detail::openmp::single_pass_compact<Value>(
+      n,
+      [=](DistanceT i) { return i == 0 || !eq(begin[i - 1], begin[i]); },
+      [=](DistanceT i, bool selected, DistanceT dst) {
+        if (selected) {
+          tmp_ptr[dst] = begin[i];
+        }
+      });
+
+  detail::openmp::parallel_copy(tmp_ptr, begin, count);
+
+  return count;
+}
+
+/*!
+        \brief keep the first key and value of each run of equal consecutive
+   keys, returns the number of pairs kept
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename BinPred>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::IterDiff<KeyIter>,
+                      type_traits::is_openmp_policy<Policy>>
+unique_by_key(
+    resources::Host host_res,
+    const Policy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    BinPred eq)
+{
+  using std::distance;
+  using Key = RAJA::detail::IterVal<KeyIter>;
+  using Val = RAJA::detail::IterVal<ValIter>;
+  const auto n = distance(keys_begin, keys_end);
+  if (n <= scan::detail::openmp::get_scan_tile_iterates<Key>()) {
+    return compact::unique_by_key(host_res, ::RAJA::seq_exec{}, keys_begin,
+                                  keys_end, vals_begin, eq);
+  }
+
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  std::unique_ptr<Key[]> tmp_keys(new Key[n]);
+  std::unique_ptr<Val[]> tmp_vals(new Val[n]);
+  Key* tmp_keys_ptr = tmp_keys.get();
+  Val* tmp_vals_ptr = tmp_vals.get();
+  const DistanceT count = detail::openmp::single_pass_compact<Key>(
+      n,
+      [=](DistanceT i) {
+        return i == 0 || !eq(keys_begin[i - 1], keys_begin[i]);
+      },
+      [=](DistanceT i, bool selected, DistanceT dst) {
+        if (selected) {
+          tmp_keys_ptr[dst] = keys_begin[i];
+          tmp_vals_ptr[dst] = vals_begin[i];
+        }
+      });
+
+  detail::openmp::parallel_copy(tmp_keys_ptr, keys_begin, count);
+  detail::openmp::parallel_copy(tmp_vals_ptr, vals_begin, count);
+
+  return count;
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
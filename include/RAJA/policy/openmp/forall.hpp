@@ -39,6 +39,8 @@
 #include "RAJA/index/RangeSegment.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/task_graph.hpp"
+#include "RAJA/policy/openmp/work_stealing.hpp"
 
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
@@ -132,6 +134,26 @@ namespace internal
     }
   }
 
+  //
+  // omp for with a fixed static split, the iterations of each thread do
+  // not depend on the OpenMP implementation
+  //
+  template <typename Iterable, typename Func>
+  RAJA_INLINE void forall_impl(const ::RAJA::policy::omp::FixedStatic&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    using ::RAJA::policy::omp::FixedStatic;
+    RAJA_EXTRACT_BED_IT(iter);
+    const int num_threads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+    const auto i_end = FixedStatic::end(distance_it, num_threads, tid);
+    for (auto i = FixedStatic::begin(distance_it, num_threads, tid); i < i_end; ++i) {
+      loop_body(begin_it[i]);
+    }
+    #pragma omp barrier
+  }
+
   //
   // omp for schedule(dynamic)
   //
@@ -278,6 +300,24 @@ namespace internal
     }
   }
 
+  //
+  // omp for with a fixed static split nowait
+  //
+  template <typename Iterable, typename Func>
+  RAJA_INLINE void forall_impl_nowait(const ::RAJA::policy::omp::FixedStatic&,
+                                      Iterable&& iter,
+                                      Func&& loop_body)
+  {
+    using ::RAJA::policy::omp::FixedStatic;
+    RAJA_EXTRACT_BED_IT(iter);
+    const int num_threads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+    const auto i_end = FixedStatic::end(distance_it, num_threads, tid);
+    for (auto i = FixedStatic::begin(distance_it, num_threads, tid); i < i_end; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
   //TODO :: not implemented in param interface...
   #if !defined(RAJA_COMPILER_MSVC)
   // dynamic & guided
@@ -329,6 +369,31 @@ forall_impl(resources::Host host_res,
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// OpenMP work stealing policy implementation
+///
+template <int Grain, typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_ws_exec<Grain>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  RAJA::detail::openmp::work_stealing_for(Grain, distance_it,
+      [&](std::ptrdiff_t chunk_begin, std::ptrdiff_t chunk_end) {
+    for (std::ptrdiff_t i = chunk_begin; i < chunk_end; ++i) {
+      loop_body(begin_it[i]);
+    }
+  });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -342,64 +407,40 @@ forall_impl(resources::Host host_res,
 /*!
  ******************************************************************************
  *
- * \brief  Iterate over index set segments using an omp parallel loop and
- *         segment dependency graph. Individual segment execution will use
- *         execution policy template parameter.
+ * \brief  Iterate over index set segments in an omp parallel region using
+ *         the index set's segment dependency graph. Individual segment
+ *         execution will use execution policy template parameter.
  *
- *         This method assumes that a task dependency graph has been
- *         properly set up for each segment in the index set.
+ *         A segment is queued when its last dependency completes, idle
+ *         threads take ready segments from the queues of other threads.
+ *         The index set dependency graph must be finalized before calling
+ *         this method.
  *
  ******************************************************************************
  */
-
-/*
- * TODO: Fix this!!!
- */
-
-/*
-template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename ...
-SEG_TYPES>
-RAJA_INLINE void forall(
-    ExecPolicy<omp_taskgraph_segit, SEG_EXEC_POLICY_T>,
-    const IndexSet<SEG_TYPES ...>& iset,
-    LOOP_BODY loop_body)
+template <typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::type_traits::is_index_set<Iterable>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_taskgraph_segit&,
+            Iterable&& iset,
+            Func&& loop_body,
+            ForallParam)
 {
   if (!iset.dependencyGraphSet()) {
-    std::cerr << "\n RAJA IndexSet dependency graph not set , "
-              << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
-    RAJA_ABORT_OR_THROW("IndexSet dependency graph");
+    RAJA_ABORT_OR_THROW("IndexSet dependency graph not set");
   }
 
-  IndexSet& ncis = (*const_cast<IndexSet*>(&iset));
-
-  int num_seg = ncis.getNumSegments();
+  auto const& graph = iset.getDependencyGraph();
+  RAJA::detail::openmp::task_graph_for(
+      graph.data(), static_cast<int>(graph.size()), loop_body);
 
-#pragma omp parallel for schedule(static, 1)
-  for (int isi = 0; isi < num_seg; ++isi) {
-    IndexSetSegInfo* seg_info = ncis.getSegmentInfo(isi);
-    DepGraphNode* task = seg_info->getDepGraphNode();
-
-    task->wait();
-
-    executeRangeList_forall<SEG_EXEC_POLICY_T>(seg_info, loop_body);
-
-    task->reset();
-
-    if (task->numDepTasks() != 0) {
-      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
-        // Alternateively, we could get the return value of this call
-        // and actively launch the task if we are the last depedent
-        // task. In that case, we would not need the semaphore spin
-        // loop above.
-        int seg = task->depTaskNum(ii);
-        DepGraphNode* dep = ncis.getSegmentInfo(seg)->getDepGraphNode();
-        dep->satisfyOne();
-      }
-    }
-
-  }  // iterate over segments of index set
+  return resources::EventProxy<resources::Host>(host_res);
 }
-*/
 
 }  // namespace omp
 
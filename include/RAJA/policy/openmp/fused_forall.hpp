@@ -0,0 +1,118 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA fused forall template methods for
+ *          OpenMP execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_fused_forall_openmp_HPP
+#define RAJA_fused_forall_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/detail/fused_forall.hpp"
+
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace omp
+{
+
+/*!
+ * All stages run in one parallel region with a barrier between stages.
+ * The iterations are split evenly into contiguous parts, whatever the
+ * schedule of the policy, and each thread runs the same part in every stage
+ * so it reuses the data it touched in the previous stage. Each thread runs
+ * a private copy of the bodies and params, and the params of the threads
+ * are combined in thread order after the parallel region.
+ */
+template <typename ExecPolicy,
+          typename FusePolicy,
+          typename Iterable,
+          typename... Items>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                                  type_traits::is_openmp_policy<ExecPolicy>>
+fused_forall_impl(resources::Host host_res,
+                  const ExecPolicy&,
+                  FusePolicy fuse,
+                  Iterable&& iter,
+                  camp::tuple<Items...>& items)
+{
+  using EXEC_POL = camp::decay<ExecPolicy>;
+  using item_seq = camp::make_idx_seq_t<sizeof...(Items)>;
+  using Params = ::RAJA::expt::detail::FusedParams<Items...>;
+  ::RAJA::expt::detail::init_fused_params<EXEC_POL>(items, item_seq{});
+
+  RAJA_EXTRACT_BED_IT(iter);
+  using DistanceT = decltype(distance_it);
+
+  ::std::vector<Params> thread_params(omp_get_max_threads());
+  int num_threads = 0;
+
+#pragma omp parallel
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT lo = RAJA::detail::firstIndex(distance_it, p, pid);
+    const DistanceT hi = RAJA::detail::firstIndex(distance_it, p, pid + 1);
+
+    camp::tuple<Items...> thread_items = items;
+
+    ::RAJA::expt::detail::run_fused_stages(
+        fuse, ::RAJA::expt::detail::FusedSeqLoop{}, begin_it, lo, hi,
+        thread_items, [] {
+#pragma omp barrier
+        });
+
+    thread_params[pid] =
+        ::RAJA::expt::detail::get_fused_params(thread_items, item_seq{});
+    if (pid == 0) {
+      num_threads = p;
+    }
+  }
+
+  for (int t = 0; t < num_threads; ++t) {
+    ::RAJA::expt::detail::combine_fused_params<EXEC_POL>(items,
+                                                         thread_params[t],
+                                                         item_seq{});
+  }
+
+  ::RAJA::expt::detail::resolve_fused_params<EXEC_POL>(items, item_seq{});
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace omp
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
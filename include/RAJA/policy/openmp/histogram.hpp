@@ -0,0 +1,506 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA histogram and reduce by key
+*          declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_openmp_HPP
+#define RAJA_histogram_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/util/Operators.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/compact.hpp"
+#include "RAJA/policy/openmp/sort.hpp"
+#include "RAJA/policy/sequential/histogram.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+
+namespace detail
+{
+namespace openmp
+{
+
+/*!
+        \brief histogram with a private copy of the bins per thread
+
+   Each thread sets its bins to the identity of f, combines the values of
+   its part of the items into them, and after a barrier combines one part
+   of the bins over all threads in thread order into the shared bins, so
+   no atomics or critical sections are needed.
+*/
+template <typename DistanceT,
+          typename KeyFn,
+          typename ValFn,
+          typename BinIter,
+          typename BinDiff,
+          typename BinFn>
+RAJA_INLINE
+void
+private_bins_histogram(
+    DistanceT n,
+    KeyFn key,
+    ValFn value,
+    BinIter bins,
+    BinDiff num_bins,
+    BinFn f)
+{
+  using RAJA::detail::firstIndex;
+  using Bin = RAJA::detail::IterVal<BinIter>;
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  std::unique_ptr<Bin[]> priv_bins(new Bin[p0 * num_bins]);
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+
+    Bin* my_bins = priv_bins.get() + pid * num_bins;
+    for (BinDiff b = 0; b < num_bins; ++b) {
+      my_bins[b] = BinFn::identity();
+    }
+
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+    for (DistanceT i = idx_begin; i < idx_end; ++i) {
+      auto b = key(i);
+      my_bins[b] = f(my_bins[b], value(i));
+    }
+
+#pragma omp barrier
+
+    const BinDiff bin_begin = firstIndex(num_bins, p, pid);
+    const BinDiff bin_end = firstIndex(num_bins, p, pid + 1);
+    for (BinDiff b = bin_begin; b < bin_end; ++b) {
+      Bin agg = bins[b];
+      for (int t = 0; t < p; ++t) {
+        agg = f(agg, priv_bins[t * num_bins + b]);
+      }
+      bins[b] = agg;
+    }
+  }
+}
+
+/*!
+        \brief histogram of sparse keys with sorted partial aggregates
+
+   Each thread sorts the (bin, value) pairs of its part of the items by bin
+   and combines the values of each bin, so the partial aggregates take
+   space proportional to the number of items instead of the number of
+   bins. After a barrier each thread merges the partial aggregates of one
+   part of the bins from every thread in thread order.
+*/
+template <typename DistanceT,
+          typename KeyFn,
+          typename ValFn,
+          typename BinIter,
+          typename BinDiff,
+          typename BinFn>
+RAJA_INLINE
+void
+sorted_partials_histogram(
+    DistanceT n,
+    KeyFn key,
+    ValFn value,
+    BinIter bins,
+    BinDiff num_bins,
+    BinFn f)
+{
+  using RAJA::detail::firstIndex;
+  using Bin = RAJA::detail::IterVal<BinIter>;
+  using Partial = std::pair<BinDiff, Bin>;
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  ::std::vector<::std::vector<Partial>> partials(p0);
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+    ::std::vector<Partial>& my_partials = partials[pid];
+    my_partials.reserve(idx_end - idx_begin);
+    for (DistanceT i = idx_begin; i < idx_end; ++i) {
+      my_partials.emplace_back(static_cast<BinDiff>(key(i)), Bin(value(i)));
+    }
+    std::stable_sort(my_partials.begin(), my_partials.end(),
+                     [](Partial const& lhs, Partial const& rhs) {
+                       return lhs.first < rhs.first;
+                     });
+
+    size_t num_partials = 0;
+    for (size_t i = 0; i < my_partials.size(); ++i) {
+      if (num_partials > 0 &&
+          my_partials[num_partials - 1].first == my_partials[i].first) {
+        my_partials[num_partials - 1].second =
+            f(my_partials[num_partials - 1].second, my_partials[i].second);
+      } else {
+        my_partials[num_partials++] = my_partials[i];
+      }
+    }
+    my_partials.resize(num_partials);
+
+#pragma omp barrier
+
+    const BinDiff bin_begin = firstIndex(num_bins, p, pid);
+    const BinDiff bin_end = firstIndex(num_bins, p, pid + 1);
+    for (int t = 0; t < p; ++t) {
+      auto it = std::lower_bound(partials[t].begin(), partials[t].end(),
+                                 bin_begin,
+                                 [](Partial const& lhs, BinDiff b) {
+                                   return lhs.first < b;
+                                 });
+      for (; it != partials[t].end() && it->first < bin_end; ++it) {
+        bins[it->first] = f(bins[it->first], it->second);
+      }
+    }
+  }
+}
+
+/*!
+        \brief histogram with privatized bins
+
+   Uses a private copy of the bins per thread when there are few bins or
+   enough items per bin to amortize combining the copies, otherwise sorted
+   partial aggregates per thread. Both require f to provide identity().
+*/
+template <typename DistanceT,
+          typename KeyFn,
+          typename ValFn,
+          typename BinIter,
+          typename BinDiff,
+          typename BinFn>
+RAJA_INLINE
+void
+privatized_histogram(
+    DistanceT n,
+    KeyFn key,
+    ValFn value,
+    BinIter bins,
+    BinDiff num_bins,
+    BinFn f)
+{
+  if (n <= 0 || num_bins <= 0) {
+    return;
+  }
+  const DistanceT max_threads = static_cast<DistanceT>(omp_get_max_threads());
+  if (static_cast<size_t>(num_bins) <= get_histogram_cache_bins() ||
+      static_cast<DistanceT>(num_bins) <= n / max_threads) {
+    private_bins_histogram(n, key, value, bins, num_bins, f);
+  } else {
+    sorted_partials_histogram(n, key, value, bins, num_bins, f);
+  }
+}
+
+/*!
+        \brief reduce the runs of equal keys of sorted keys and values
+
+   Each thread reduces the runs that start in its part of the items,
+   finishing the last one past the end of its part, after counting the
+   runs of every part to find where to write them.
+*/
+template <typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+RAJA_INLINE
+RAJA::detail::IterDiff<KeyIter>
+reduce_sorted_by_key(
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    KeyOutIter keys_out,
+    ValOutIter vals_out,
+    BinFn f)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  using Val = RAJA::detail::IterVal<ValIter>;
+  const auto n = distance(keys_begin, keys_end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  auto is_head = [=](DistanceT i) {
+    return i == 0 || !(keys_begin[i] == keys_begin[i - 1]);
+  };
+
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  ::std::vector<DistanceT> offsets(p0 + 1, 0);
+  // the team may be smaller than requested, for example when nested
+  int p_used = p0;
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+
+    DistanceT count = 0;
+    for (DistanceT i = idx_begin; i < idx_end; ++i) {
+      count += is_head(i) ? 1 : 0;
+    }
+    offsets[pid + 1] = count;
+
+#pragma omp barrier
+#pragma omp single
+    {
+      p_used = p;
+      for (int t = 0; t < p; ++t) {
+        offsets[t + 1] += offsets[t];
+      }
+    }
+
+    DistanceT dst = offsets[pid];
+    DistanceT i = idx_begin;
+    while (i < idx_end && !is_head(i)) {
+      ++i;
+    }
+    while (i < idx_end) {
+      Val agg = vals_begin[i];
+      keys_out[dst] = keys_begin[i];
+      for (++i; i < n && !is_head(i); ++i) {
+        agg = f(agg, vals_begin[i]);
+      }
+      vals_out[dst] = agg;
+      ++dst;
+    }
+  }
+
+  return offsets[p_used];
+}
+
+/*!
+        \brief reduce by key using a parallel sort of the keys and values
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+RAJA_INLINE
+RAJA::detail::IterDiff<KeyIter>
+openmp_sorted_reduce_by_key(
+    resources::Host host_res,
+    const Policy& p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    KeyOutIter keys_out,
+    ValOutIter vals_out,
+    BinFn f)
+{
+  using std::distance;
+  using Key = RAJA::detail::IterVal<KeyIter>;
+  using Val = RAJA::detail::IterVal<ValIter>;
+  const auto n = distance(keys_begin, keys_end);
+
+  std::unique_ptr<Key[]> keys(new Key[n]);
+  std::unique_ptr<Val[]> vals(new Val[n]);
+  compact::detail::openmp::parallel_copy(keys_begin, keys.get(), n);
+  compact::detail::openmp::parallel_copy(vals_begin, vals.get(), n);
+
+  sort::stable_pairs(host_res, p, keys.get(), keys.get() + n, vals.get(),
+                     ::RAJA::operators::less<Key>{});
+
+  return reduce_sorted_by_key(keys.get(), keys.get() + n, vals.get(),
+                              keys_out, vals_out, f);
+}
+
+/*!
+        \brief reduce by key of integer keys, uses privatized dense bins
+   when the range of the keys is small enough
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+RAJA_INLINE
+RAJA::detail::IterDiff<KeyIter>
+openmp_reduce_by_key(
+    resources::Host host_res,
+    const Policy& p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    KeyOutIter keys_out,
+    ValOutIter vals_out,
+    BinFn f,
+    std::true_type)
+{
+  using std::distance;
+  using Key = RAJA::detail::IterVal<KeyIter>;
+  using Val = RAJA::detail::IterVal<ValIter>;
+  using Bin = ::RAJA::impl::histogram::detail::ReduceByKeyBin<Val>;
+  using BinOp = ::RAJA::impl::histogram::detail::ReduceByKeyBinFn<Val, BinFn>;
+  const auto n = distance(keys_begin, keys_end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  Key kmin = keys_begin[0];
+  Key kmax = keys_begin[0];
+#pragma omp parallel for reduction(min : kmin) reduction(max : kmax)
+  for (DistanceT i = 0; i < n; ++i) {
+    kmin = std::min(kmin, Key(keys_begin[i]));
+    kmax = std::max(kmax, Key(keys_begin[i]));
+  }
+
+  const DistanceT num_bins = get_dense_key_bins(kmin, kmax, n);
+  if (num_bins == 0) {
+    return openmp_sorted_reduce_by_key(host_res, p, keys_begin, keys_end,
+                                       vals_begin, keys_out, vals_out, f);
+  }
+
+  std::unique_ptr<Bin[]> bins(new Bin[num_bins]);
+  Bin* bins_ptr = bins.get();
+#pragma omp parallel for
+  for (DistanceT b = 0; b < num_bins; ++b) {
+    bins_ptr[b] = BinOp::identity();
+  }
+
+  auto key = [=](DistanceT i) {
+    return static_cast<DistanceT>(keys_begin[i] - kmin);
+  };
+  auto value = [=](DistanceT i) { return Bin{vals_begin[i], true}; };
+  privatized_histogram(n, key, value, bins_ptr, num_bins, BinOp{f});
+
+  return compact::detail::openmp::single_pass_compact<Bin>(
+      num_bins,
+      [=](DistanceT b) { return bins_ptr[b].used; },
+      [=](DistanceT b, bool selected, DistanceT dst) {
+        if (selected) {
+          keys_out[dst] = static_cast<Key>(kmin + b);
+          vals_out[dst] = bins_ptr[b].value;
+        }
+      });
+}
+///
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+RAJA_INLINE
+RAJA::detail::IterDiff<KeyIter>
+openmp_reduce_by_key(
+    resources::Host host_res,
+    const Policy& p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    KeyOutIter keys_out,
+    ValOutIter vals_out,
+    BinFn f,
+    std::false_type)
+{
+  return openmp_sorted_reduce_by_key(host_res, p, keys_begin, keys_end,
+                                     vals_begin, keys_out, vals_out, f);
+}
+
+}  // namespace openmp
+
+}  // namespace detail
+
+/*!
+        \brief combine value(i) into bins[key(i)] for each of the n items
+*/
+template <typename Policy,
+          typename DistanceT,
+          typename KeyFn,
+          typename ValFn,
+          typename BinIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<Policy>>
+histogram(
+    resources::Host host_res,
+    const Policy&,
+    DistanceT n,
+    KeyFn key,
+    ValFn value,
+    BinIter bins,
+    RAJA::detail::IterDiff<BinIter> num_bins,
+    BinFn f)
+{
+  detail::openmp::privatized_histogram(n, key, value, bins, num_bins, f);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief reduce the values of equal keys, writes the distinct keys in
+   increasing order and their reduced values, returns the number of
+   distinct keys
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::IterDiff<KeyIter>,
+                      type_traits::is_openmp_policy<Policy>>
+reduce_by_key(
+    resources::Host host_res,
+    const Policy& p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    KeyOutIter keys_out,
+    ValOutIter vals_out,
+    BinFn f)
+{
+  using std::distance;
+  using Key = RAJA::detail::IterVal<KeyIter>;
+  using Val = RAJA::detail::IterVal<ValIter>;
+  const auto n = distance(keys_begin, keys_end);
+  if (n <= scan::detail::openmp::get_scan_tile_iterates<Val>()) {
+    return histogram::reduce_by_key(host_res, ::RAJA::seq_exec{}, keys_begin,
+                                    keys_end, vals_begin, keys_out, vals_out,
+                                    f);
+  }
+
+  return detail::openmp::openmp_reduce_by_key(
+      host_res, p, keys_begin, keys_end, vals_begin, keys_out, vals_out, f,
+      detail::is_dense_key<Key>{});
+}
+
+}  // namespace histogram
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
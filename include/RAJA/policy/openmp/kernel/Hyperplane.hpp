@@ -0,0 +1,287 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for OpenMP hyperplane executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_Hyperplane_HPP
+#define RAJA_policy_openmp_kernel_Hyperplane_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <algorithm>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/pattern/kernel/Hyperplane.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/kernel/Collapse.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Hyperplane ExecPolicy that splits the iteration space into tiles of
+ * TileSize in every index, including the hyperplane index, and runs the
+ * tiles in hyperplanes of tiles. The tiles of a hyperplane of tiles run in
+ * parallel, and the points of a tile run in order with the last index
+ * fastest, so that a tile stays in cache.
+ *
+ * The HpExecPolicy of the Hyperplane statement is not used, the hyperplanes
+ * of tiles run in order.
+ */
+template <camp::idx_t TileSize>
+struct omp_parallel_hyperplane_tile_exec
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For> {
+  static_assert(TileSize > 0,
+                "omp_parallel_hyperplane_tile_exec TileSize must be positive");
+};
+
+namespace internal
+{
+
+/*!
+ * The first loop over the points of a hyperplane runs in parallel, the
+ * loops inside it are sequential.
+ */
+template <camp::idx_t HpArgumentId,
+          camp::idx_t... DoneArgs,
+          camp::idx_t Arg,
+          camp::idx_t... RestArgs,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<HyperplaneInner<HpArgumentId,
+                                         ArgList<DoneArgs...>,
+                                         ArgList<Arg, RestArgs...>,
+                                         omp_parallel_collapse_exec,
+                                         EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    using idx_t = camp::decay<decltype(camp::get<HpArgumentId>(data.offset_tuple))>;
+
+    idx_t lo, hi;
+    hyperplane_inner_bounds<HpArgumentId>(data,
+                                          ArgList<DoneArgs...>{},
+                                          ArgList<Arg, RestArgs...>{},
+                                          lo,
+                                          hi);
+
+    // Set the argument type for this loop
+    using NewTypes = setSegmentTypeFromData<Types, Arg, Data>;
+
+    using next_loop_t = StatementExecutor<HyperplaneInner<HpArgumentId,
+                                                          ArgList<DoneArgs..., Arg>,
+                                                          ArgList<RestArgs...>,
+                                                          seq_exec,
+                                                          EnclosedStmts...>,
+                                          NewTypes>;
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel for firstprivate(privatizer)
+    for (idx_t i = lo; i < hi + 1; ++i) {
+      auto &private_data = privatizer.get_priv();
+      private_data.template assign_offset<Arg>(i);
+
+      next_loop_t::exec(private_data);
+    }
+  }
+};
+
+
+template <typename Types, typename Data, camp::idx_t... Args>
+struct HyperplaneTileTypes;
+///
+template <typename Types, typename Data>
+struct HyperplaneTileTypes<Types, Data> {
+  using type = Types;
+};
+///
+template <typename Types, typename Data, camp::idx_t Arg, camp::idx_t... Args>
+struct HyperplaneTileTypes<Types, Data, Arg, Args...> {
+  using type = typename HyperplaneTileTypes<
+      setSegmentTypeFromData<Types, Arg, Data>, Data, Args...>::type;
+};
+
+
+template <camp::idx_t HpArgumentId,
+          typename HpExecPolicy,
+          camp::idx_t... Args,
+          camp::idx_t TileSize,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Hyperplane<HpArgumentId,
+                          HpExecPolicy,
+                          ArgList<Args...>,
+                          omp_parallel_hyperplane_tile_exec<TileSize>,
+                          EnclosedStmts...>, Types> {
+
+  static_assert(sizeof...(Args) > 0,
+                "omp_parallel_hyperplane_tile_exec requires a non-empty "
+                "ArgList");
+
+  // dimensions of the iteration space, the hyperplane index is dimension 0
+  static constexpr camp::idx_t num_dims = 1 + sizeof...(Args);
+
+
+  /*!
+   * Run the points of the tile in order with the last dimension fastest.
+   */
+  template <typename NewTypes, typename Data, typename idx_t>
+  static RAJA_INLINE void exec_tile(Data &data,
+                                    idx_t const *lens,
+                                    idx_t const *tile)
+  {
+    const idx_t tile_size = static_cast<idx_t>(TileSize);
+
+    idx_t begin[num_dims];
+    idx_t end[num_dims];
+    idx_t point[num_dims];
+    for (camp::idx_t d = 0; d < num_dims; ++d) {
+      begin[d] = tile[d] * tile_size;
+      end[d] = std::min(static_cast<idx_t>(begin[d] + tile_size), lens[d]);
+      point[d] = begin[d];
+    }
+
+    for (;;) {
+      data.template assign_offset<HpArgumentId>(point[0]);
+      camp::idx_t d = 1;
+      // braced init lists are evaluated in order
+      int seq_unused_array[] = {
+          0, (data.template assign_offset<Args>(point[d++]), 0)...};
+      RAJA_UNUSED_VAR(seq_unused_array);
+
+      execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(data);
+
+      for (d = num_dims - 1; d >= 0; --d) {
+        if (++point[d] < end[d]) {
+          break;
+        }
+        point[d] = begin[d];
+      }
+      if (d < 0) {
+        break;
+      }
+    }
+  }
+
+  /*!
+   * Run the tiles of the hyperplane of tiles from dimension d on, where rem
+   * is what is left of the hyperplane for dimensions d and later and for
+   * dimension 0.
+   */
+  template <typename NewTypes, typename Data, typename idx_t>
+  static RAJA_INLINE void exec_tiles(Data &data,
+                                     idx_t const *lens,
+                                     idx_t const *num_tiles,
+                                     idx_t const *rest,
+                                     idx_t *tile,
+                                     camp::idx_t d,
+                                     idx_t rem)
+  {
+    if (d == num_dims) {
+      tile[0] = rem;
+      exec_tile<NewTypes>(data, lens, tile);
+      return;
+    }
+
+    idx_t lo, hi;
+    hyperplane_bounds(rem, num_tiles[d], rest[d], lo, hi);
+    for (idx_t t = lo; t <= hi; ++t) {
+      tile[d] = t;
+      exec_tiles<NewTypes>(data, lens, num_tiles, rest, tile, d + 1, rem - t);
+    }
+  }
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    using data_t = camp::decay<Data>;
+    using idx_t =
+        camp::tuple_element_t<HpArgumentId, typename data_t::offset_tuple_t>;
+
+    // Set the argument types for all of the loops
+    using NewTypes = typename HyperplaneTileTypes<Types,
+                                                  Data,
+                                                  HpArgumentId,
+                                                  Args...>::type;
+
+    const idx_t tile_size = static_cast<idx_t>(TileSize);
+
+    const idx_t lens[num_dims] = {
+        static_cast<idx_t>(segment_length<HpArgumentId>(data)),
+        static_cast<idx_t>(segment_length<Args>(data))...};
+
+    // number of tiles in each dimension and number of hyperplanes of tiles
+    idx_t num_tiles[num_dims];
+    idx_t num_planes = 1;
+    for (camp::idx_t d = 0; d < num_dims; ++d) {
+      if (lens[d] == 0) {
+        return;
+      }
+      num_tiles[d] = (lens[d] + tile_size - 1) / tile_size;
+      num_planes += num_tiles[d] - 1;
+    }
+
+    // largest sum of the tile indices after each dimension and dimension 0
+    idx_t rest[num_dims];
+    rest[num_dims - 1] = num_tiles[0] - 1;
+    for (camp::idx_t d = num_dims - 2; d >= 1; --d) {
+      rest[d] = rest[d + 1] + num_tiles[d + 1] - 1;
+    }
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel firstprivate(privatizer)
+    {
+      auto &private_data = privatizer.get_priv();
+      idx_t tile[num_dims];
+
+      for (idx_t h = 0; h < num_planes; ++h) {
+        idx_t lo, hi;
+        hyperplane_bounds(h, num_tiles[1], rest[1], lo, hi);
+
+        // the implicit barrier at the end finishes the hyperplane of tiles
+#pragma omp for schedule(dynamic, 1)
+        for (idx_t t = lo; t < hi + 1; ++t) {
+          tile[1] = t;
+          exec_tiles<NewTypes>(private_data, lens, num_tiles, rest, tile, 2,
+                               static_cast<idx_t>(h - t));
+        }
+      }
+    }
+  }
+};
+
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
@@ -18,12 +18,315 @@
 #ifndef RAJA_pattern_launch_openmp_HPP
 #define RAJA_pattern_launch_openmp_HPP
 
+#include <algorithm>
+#include <memory>
+
+#include <omp.h>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/pattern/launch/launch_host_scratch.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/util/FastDivisor.hpp"
+#include "RAJA/policy/openmp/work_stealing.hpp"
 
 namespace RAJA
 {
 
+namespace detail
+{
+
+/*!
+ * Teams of host threads for a launch, with the shared memory and barrier
+ * of each team.
+ */
+class LaunchHostTeams
+{
+public:
+  LaunchHostTeams(int threads_per_team, size_t shared_mem_size)
+      : m_team_size(get_team_size(threads_per_team)),
+        m_max_teams(std::max(1, omp_get_max_threads() / m_team_size)),
+        m_team_mem_size(RAJA_DIVIDE_CEILING_INT(shared_mem_size,
+                                                RAJA::DATA_ALIGN) *
+                        RAJA::DATA_ALIGN),
+        m_scratch(m_team_mem_size * m_max_teams),
+        m_barriers(new LaunchHostTeamBarrier[m_max_teams])
+  {
+  }
+
+  //! number of threads to run the teams with
+  int num_threads() const { return m_max_teams * m_team_size; }
+
+  /*!
+   * Set the team of this thread in team and ctx, must be called by every
+   * thread of the parallel region before running the body.
+   */
+  void enter(LaunchHostTeam& team, LaunchContext& ctx)
+  {
+    const int p = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+
+    // the last team takes the threads left over
+    team.num_teams = std::max(1, p / m_team_size);
+    team.team = std::min(tid / m_team_size, team.num_teams - 1);
+    team.thread = tid - team.team * m_team_size;
+    team.num_threads = (team.team == team.num_teams - 1)
+                           ? p - team.team * m_team_size
+                           : m_team_size;
+    team.barrier = &m_barriers[team.team];
+
+    if (team.thread == 0) {
+      team.barrier->init(team.num_threads);
+    }
+#pragma omp barrier
+
+    ctx.host_team = &team;
+    ctx.shared_mem_ptr = m_scratch.get() + team.team * m_team_mem_size;
+  }
+
+private:
+  static int get_team_size(int threads_per_team)
+  {
+    const int max_threads = omp_get_max_threads();
+    if (threads_per_team > 0) {
+      return std::min(threads_per_team, max_threads);
+    }
+#if _OPENMP >= 201511
+    const int num_places = omp_get_num_places();
+    if (num_places > 0) {
+      return std::max(1, max_threads / num_places);
+    }
+#endif
+    return max_threads;
+  }
+
+  int m_team_size;
+  int m_max_teams;
+  size_t m_team_mem_size;
+  LaunchHostScratch m_scratch;
+  std::unique_ptr<LaunchHostTeamBarrier[]> m_barriers;
+};
+
+//! first iteration and stride of the iterations of a team
+RAJA_INLINE void get_launch_team_range(LaunchContext const& ctx,
+                                       int& begin,
+                                       int& stride)
+{
+  begin = (ctx.host_team != nullptr) ? ctx.host_team->team : 0;
+  stride = (ctx.host_team != nullptr) ? ctx.host_team->num_teams : 1;
+}
+
+//! first iteration and stride of the iterations of a thread in its team
+RAJA_INLINE void get_launch_thread_range(LaunchContext const& ctx,
+                                         int& begin,
+                                         int& stride)
+{
+  begin = (ctx.host_team != nullptr) ? ctx.host_team->thread : 0;
+  stride = (ctx.host_team != nullptr) ? ctx.host_team->num_threads : 1;
+}
+
+struct LaunchTeamRange {
+  static RAJA_INLINE void get(LaunchContext const& ctx, int& begin, int& stride)
+  {
+    get_launch_team_range(ctx, begin, stride);
+  }
+};
+
+struct LaunchThreadRange {
+  static RAJA_INLINE void get(LaunchContext const& ctx, int& begin, int& stride)
+  {
+    get_launch_thread_range(ctx, begin, stride);
+  }
+};
+
+/*!
+ * Loops of omp_launch_team_loop and omp_launch_thread_loop, the iterations
+ * from begin with stride of Range run in this thread. Multiple segments
+ * are flattened with the first segment fastest.
+ */
+template <typename Range, typename SEGMENT>
+struct LaunchHostTeamLoopExecute {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const &ctx,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    int begin, stride;
+    Range::get(ctx, begin, stride);
+
+    for (int i = begin; i < len; i += stride) {
+      body(*(segment.begin() + i));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const &ctx,
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+    const int len0 = segment0.end() - segment0.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    int begin, stride;
+    Range::get(ctx, begin, stride);
+
+    const FastDivisor<int> div0(len0 > 0 ? len0 : 1);
+
+    for (int n = begin; n < len0 * len1; n += stride) {
+      const int j = n / div0;
+      const int i = n - j * len0;
+      body(*(segment0.begin() + i), *(segment1.begin() + j));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const &ctx,
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+    const int len0 = segment0.end() - segment0.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len2 = segment2.end() - segment2.begin();
+    int begin, stride;
+    Range::get(ctx, begin, stride);
+
+    const FastDivisor<int> div0(len0 > 0 ? len0 : 1);
+    const FastDivisor<int> div1(len1 > 0 ? len1 : 1);
+
+    for (int n = begin; n < len0 * len1 * len2; n += stride) {
+      const int n1 = n / div0;
+      const int k = n1 / div1;
+      const int i = n - n1 * len0;
+      const int j = n1 - k * len1;
+      body(*(segment0.begin() + i),
+           *(segment1.begin() + j),
+           *(segment2.begin() + k));
+    }
+  }
+};
+
+template <typename Range, typename SEGMENT>
+struct LaunchHostTeamLoopICountExecute {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const &ctx,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    int begin, stride;
+    Range::get(ctx, begin, stride);
+
+    for (int i = begin; i < len; i += stride) {
+      body(*(segment.begin() + i), i);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const &ctx,
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+    const int len0 = segment0.end() - segment0.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    int begin, stride;
+    Range::get(ctx, begin, stride);
+
+    const FastDivisor<int> div0(len0 > 0 ? len0 : 1);
+
+    for (int n = begin; n < len0 * len1; n += stride) {
+      const int j = n / div0;
+      const int i = n - j * len0;
+      body(*(segment0.begin() + i), *(segment1.begin() + j), i, j);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const &ctx,
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+    const int len0 = segment0.end() - segment0.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len2 = segment2.end() - segment2.begin();
+    int begin, stride;
+    Range::get(ctx, begin, stride);
+
+    const FastDivisor<int> div0(len0 > 0 ? len0 : 1);
+    const FastDivisor<int> div1(len1 > 0 ? len1 : 1);
+
+    for (int n = begin; n < len0 * len1 * len2; n += stride) {
+      const int n1 = n / div0;
+      const int k = n1 / div1;
+      const int i = n - n1 * len0;
+      const int j = n1 - k * len1;
+      body(*(segment0.begin() + i),
+           *(segment1.begin() + j),
+           *(segment2.begin() + k),
+           i,
+           j,
+           k);
+    }
+  }
+};
+
+template <typename Range, typename SEGMENT>
+struct LaunchHostTeamTileExecute {
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const &ctx,
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len - 1) / tile_size + 1;
+    int begin, stride;
+    Range::get(ctx, begin, stride);
+
+    for (int t = begin; t < numTiles; t += stride) {
+      body(segment.slice(t * tile_size, tile_size));
+    }
+  }
+};
+
+template <typename Range, typename SEGMENT>
+struct LaunchHostTeamTileTCountExecute {
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const &ctx,
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len - 1) / tile_size + 1;
+    int begin, stride;
+    Range::get(ctx, begin, stride);
+
+    for (int t = begin; t < numTiles; t += stride) {
+      body(segment.slice(t * tile_size, tile_size), t);
+    }
+  }
+};
+
+}  // namespace detail
+
 template <>
 struct LaunchExecute<RAJA::omp_launch_t> {
 
@@ -40,12 +343,10 @@ struct LaunchExecute<RAJA::omp_launch_t> {
         using RAJA::internal::thread_privatize;
         auto loop_body = thread_privatize(body);
 
-        ctx.shared_mem_ptr = (char*) malloc(params.shared_mem_size);
+        detail::LaunchHostScratch scratch(params.shared_mem_size);
+        ctx.shared_mem_ptr = scratch.get();
 
         loop_body.get_priv()(ctx);
-
-        free(ctx.shared_mem_ptr);
-        ctx.shared_mem_ptr = nullptr;
     });
 
     return resources::EventProxy<resources::Resource>(res);
@@ -74,12 +375,77 @@ struct LaunchExecute<RAJA::omp_launch_t> {
       using RAJA::internal::thread_privatize;
       auto loop_body = thread_privatize(body);
 
-      ctx.shared_mem_ptr = (char*) malloc(launch_params.shared_mem_size);
+      detail::LaunchHostScratch scratch(launch_params.shared_mem_size);
+      ctx.shared_mem_ptr = scratch.get();
 
       expt::invoke_body(f_params, loop_body.get_priv(), ctx);
+    }
+
+    expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+};
+
+
+/*!
+ * Launch with teams of host threads, the teams and threads of the launch
+ * params are not used, the team and thread loops cover their segments.
+ */
+template <int ThreadsPerTeam>
+struct LaunchExecute<RAJA::omp_launch_teams_t<ThreadsPerTeam>> {
+
+  template <typename BODY, typename ReduceParams>
+  static concepts::enable_if_t<resources::EventProxy<resources::Resource>,
+                               RAJA::expt::type_traits::is_ForallParamPack<ReduceParams>,
+                               RAJA::expt::type_traits::is_ForallParamPack_empty<ReduceParams>>
+  exec(RAJA::resources::Resource res, LaunchParams const &params, const char *, BODY const &body, ReduceParams &RAJA_UNUSED_ARG(launch_reducers))
+  {
+    detail::LaunchHostTeams teams(ThreadsPerTeam, params.shared_mem_size);
+
+#pragma omp parallel num_threads(teams.num_threads())
+    {
+      LaunchContext ctx;
+      LaunchHostTeam team;
+      teams.enter(team, ctx);
+
+      using RAJA::internal::thread_privatize;
+      auto loop_body = thread_privatize(body);
+
+      loop_body.get_priv()(ctx);
+    }
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+  template<typename ReduceParams, typename BODY>
+    static concepts::enable_if_t<resources::EventProxy<resources::Resource>,
+                                 RAJA::expt::type_traits::is_ForallParamPack<ReduceParams>,
+                                 concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ReduceParams>>>
+  exec(RAJA::resources::Resource res, LaunchParams const &launch_params,
+       const char *RAJA_UNUSED_ARG(kernel_name),  BODY const &body, ReduceParams &f_params)
+  {
+
+    using EXEC_POL = RAJA::omp_launch_t;
+
+    expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+
+    detail::LaunchHostTeams teams(ThreadsPerTeam, launch_params.shared_mem_size);
 
-      free(ctx.shared_mem_ptr);
-      ctx.shared_mem_ptr = nullptr;
+    //reducer object must be named f_params as expected by macro below
+    RAJA_OMP_DECLARE_REDUCTION_COMBINE;
+
+   #pragma omp parallel num_threads(teams.num_threads()) reduction(combine : f_params)
+    {
+      LaunchContext ctx;
+      LaunchHostTeam team;
+      teams.enter(team, ctx);
+
+      using RAJA::internal::thread_privatize;
+      auto loop_body = thread_privatize(body);
+
+      expt::invoke_body(f_params, loop_body.get_priv(), ctx);
     }
 
     expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
@@ -305,6 +671,46 @@ struct LoopICountExecute<omp_for_exec, SEGMENT> {
   }
 };
 
+template <int Grain, typename SEGMENT>
+struct LoopExecute<omp_ws_exec<Grain>, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    RAJA::detail::openmp::work_stealing_for(Grain, len,
+        [&](std::ptrdiff_t chunk_begin, std::ptrdiff_t chunk_end) {
+      for (std::ptrdiff_t i = chunk_begin; i < chunk_end; i++) {
+        body(*(segment.begin() + i));
+      }
+    });
+  }
+};
+
+template <int Grain, typename SEGMENT>
+struct LoopICountExecute<omp_ws_exec<Grain>, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    RAJA::detail::openmp::work_stealing_for(Grain, len,
+        [&](std::ptrdiff_t chunk_begin, std::ptrdiff_t chunk_end) {
+      for (std::ptrdiff_t i = chunk_begin; i < chunk_end; i++) {
+        body(*(segment.begin() + i), static_cast<int>(i));
+      }
+    });
+  }
+};
+
 // policy for perfectly nested loops
 struct omp_parallel_nested_for_exec;
 
@@ -528,5 +934,49 @@ struct TileTCountExecute<omp_for_exec, SEGMENT> {
   }
 };
 
+template <typename SEGMENT>
+struct LoopExecute<omp_launch_team_loop, SEGMENT>
+    : detail::LaunchHostTeamLoopExecute<detail::LaunchTeamRange, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct LoopExecute<omp_launch_thread_loop, SEGMENT>
+    : detail::LaunchHostTeamLoopExecute<detail::LaunchThreadRange, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<omp_launch_team_loop, SEGMENT>
+    : detail::LaunchHostTeamLoopICountExecute<detail::LaunchTeamRange,
+                                              SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<omp_launch_thread_loop, SEGMENT>
+    : detail::LaunchHostTeamLoopICountExecute<detail::LaunchThreadRange,
+                                              SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct TileExecute<omp_launch_team_loop, SEGMENT>
+    : detail::LaunchHostTeamTileExecute<detail::LaunchTeamRange, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct TileExecute<omp_launch_thread_loop, SEGMENT>
+    : detail::LaunchHostTeamTileExecute<detail::LaunchThreadRange, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct TileTCountExecute<omp_launch_team_loop, SEGMENT>
+    : detail::LaunchHostTeamTileTCountExecute<detail::LaunchTeamRange,
+                                              SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct TileTCountExecute<omp_launch_thread_loop, SEGMENT>
+    : detail::LaunchHostTeamTileTCountExecute<detail::LaunchThreadRange,
+                                              SEGMENT> {
+};
+
 }  // namespace RAJA
 #endif
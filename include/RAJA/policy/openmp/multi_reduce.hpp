@@ -25,6 +25,7 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -36,6 +37,7 @@
 
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
+#include "RAJA/pattern/detail/algorithm.hpp"
 #include "RAJA/pattern/detail/multi_reduce.hpp"
 #include "RAJA/pattern/multi_reduce.hpp"
 
@@ -349,6 +351,267 @@ private:
   }
 };
 
+/*!
+ **************************************************************************
+ *
+ * \brief  OMP multi-reduce data class template using combine in parallel.
+ *
+ * In this class memory is owned by the parent object, each thread's values
+ * are allocated by that thread when it first combines into them so they are
+ * local to it, and are combined into the parent's values by bin ranges in
+ * parallel when get is called. Inside a parallel region get folds the
+ * threads' values for the bin without combining them into the parent.
+ *
+ **************************************************************************
+ */
+template < typename T, typename t_MultiReduceOp >
+struct MultiReduceDataOMP<T, t_MultiReduceOp,
+    RAJA::omp::MultiReduceTuning<RAJA::omp::multi_reduce_algorithm::combine_in_parallel>>
+{
+  using value_type = T;
+  using MultiReduceOp = t_MultiReduceOp;
+
+  MultiReduceDataOMP() = delete;
+
+  template < typename Container,
+             std::enable_if_t<!std::is_same<Container, MultiReduceDataOMP>::value>* = nullptr >
+  MultiReduceDataOMP(Container const& container, T identity)
+      : m_parent(nullptr)
+      , m_max_threads(omp_get_max_threads())
+      , m_num_bins(container.size())
+      , m_padded_bins(pad_bins(m_num_bins))
+      , m_identity(identity)
+      , m_data(nullptr)
+      , m_thread_data(nullptr)
+      , m_num_thread_data(0)
+  {
+    m_data = create_data(container, m_num_bins);
+    m_thread_data = create_thread_data_ptrs(m_max_threads);
+  }
+
+  MultiReduceDataOMP(MultiReduceDataOMP const &other)
+      : m_parent(other.m_parent ? other.m_parent : &other)
+      , m_max_threads(other.m_max_threads)
+      , m_num_bins(other.m_num_bins)
+      , m_padded_bins(other.m_padded_bins)
+      , m_identity(other.m_identity)
+      , m_data(other.m_data)
+      , m_thread_data(other.m_thread_data)
+      , m_num_thread_data(0)
+  { }
+
+  MultiReduceDataOMP(MultiReduceDataOMP &&) = delete;
+  MultiReduceDataOMP& operator=(MultiReduceDataOMP const&) = delete;
+  MultiReduceDataOMP& operator=(MultiReduceDataOMP &&) = delete;
+
+  ~MultiReduceDataOMP()
+  {
+    if (!m_parent) {
+      destroy_thread_data();
+      destroy_thread_data_ptrs(m_thread_data);
+      destroy_data(m_data, m_num_bins);
+    }
+  }
+
+  template < typename Container >
+  void reset(Container const& container, T identity)
+  {
+    destroy_thread_data();
+    m_identity = identity;
+    size_t new_num_bins = container.size();
+    if (new_num_bins != m_num_bins) {
+      destroy_data(m_data, m_num_bins);
+      m_num_bins = new_num_bins;
+      m_padded_bins = pad_bins(m_num_bins);
+      m_data = create_data(container, m_num_bins);
+    } else {
+      size_t bin = 0;
+      for (auto const& value : container) {
+        m_data[bin] = value;
+        ++bin;
+      }
+    }
+  }
+
+  size_t num_bins() const { return m_num_bins; }
+
+  T identity() const { return m_identity; }
+
+  void combine(size_t bin, T const &val)
+  {
+    T*& thread_data = m_thread_data[omp_get_thread_num()];
+    if (!thread_data) {
+      thread_data = create_thread_data(m_identity, m_num_bins, m_padded_bins);
+      size_t& num_thread_data = get_parent().m_num_thread_data;
+#pragma omp atomic
+      num_thread_data += 1;
+    }
+    MultiReduceOp{}(thread_data[bin], val);
+  }
+
+  T get(size_t bin) const
+  {
+    MultiReduceDataOMP const& parent = get_parent();
+    if (omp_in_parallel()) {
+      // other threads may be reading bins too, so leave the threads' values
+      return parent.fold_thread_data(bin);
+    }
+    if (parent.m_num_thread_data != size_t(0)) {
+#pragma omp critical(ompMultiReduceCritical)
+      {
+        if (parent.m_num_thread_data != size_t(0)) {
+          parent.combine_thread_data();
+        }
+      }
+    }
+    return m_data[bin];
+  }
+
+private:
+  MultiReduceDataOMP const *m_parent;
+  size_t m_max_threads;
+  size_t m_num_bins;
+  size_t m_padded_bins;
+  T m_identity;
+  T* m_data;
+  T** m_thread_data;
+  mutable size_t m_num_thread_data;
+
+  // this number is arbitrary, below it a parallel region costs more than
+  // the combine
+  static constexpr size_t min_parallel_combine_values = 32*1024;
+
+  static constexpr size_t bins_per_cache_line()
+  {
+    return (sizeof(T) < RAJA::DATA_ALIGN) ? RAJA::DATA_ALIGN / sizeof(T)
+                                          : size_t(1);
+  }
+
+  static constexpr size_t pad_bins(size_t num_bins)
+  {
+    size_t num_cache_lines = RAJA_DIVIDE_CEILING_INT(num_bins*sizeof(T), RAJA::DATA_ALIGN);
+    return RAJA_DIVIDE_CEILING_INT(num_cache_lines * RAJA::DATA_ALIGN, sizeof(T));
+  }
+
+  MultiReduceDataOMP const& get_parent() const
+  {
+    return m_parent ? *m_parent : *this;
+  }
+
+  /*!
+   * Combine the values of each thread into the parent's values and free
+   * them. Threads take ranges of whole cache lines of bins and combine the
+   * threads' values into each bin in thread order.
+   */
+  void combine_thread_data() const
+  {
+    const size_t num_cache_lines =
+        RAJA_DIVIDE_CEILING_INT(m_num_bins, bins_per_cache_line());
+    const size_t num_threads =
+        (m_num_bins * m_num_thread_data < min_parallel_combine_values)
+            ? size_t(1)
+            : std::min(num_cache_lines, m_max_threads);
+
+#pragma omp parallel num_threads(num_threads)
+    {
+      const size_t p = omp_get_num_threads();
+      const size_t pid = omp_get_thread_num();
+      const size_t bin_begin = std::min(
+          m_num_bins,
+          RAJA::detail::firstIndex(num_cache_lines, p, pid) * bins_per_cache_line());
+      const size_t bin_end = std::min(
+          m_num_bins,
+          RAJA::detail::firstIndex(num_cache_lines, p, pid + 1) * bins_per_cache_line());
+
+      for (size_t thread_idx = 0; thread_idx < m_max_threads; ++thread_idx) {
+        T const* thread_data = m_thread_data[thread_idx];
+        if (thread_data) {
+          for (size_t bin = bin_begin; bin < bin_end; ++bin) {
+            MultiReduceOp{}(m_data[bin], thread_data[bin]);
+          }
+        }
+      }
+    }
+
+    destroy_thread_data();
+  }
+
+  /*!
+   * Return the parent's value of bin combined with the values of each
+   * thread in thread order, without changing either.
+   */
+  T fold_thread_data(size_t bin) const
+  {
+    T value = m_data[bin];
+    for (size_t thread_idx = 0; thread_idx < m_max_threads; ++thread_idx) {
+      T const* thread_data = m_thread_data[thread_idx];
+      if (thread_data) {
+        MultiReduceOp{}(value, thread_data[bin]);
+      }
+    }
+    return value;
+  }
+
+  void destroy_thread_data() const
+  {
+    for (size_t thread_idx = 0; thread_idx < m_max_threads; ++thread_idx) {
+      destroy_data(m_thread_data[thread_idx], m_num_bins);
+    }
+    m_num_thread_data = 0;
+  }
+
+  template < typename Container >
+  static T* create_data(Container const& container, size_t num_bins)
+  {
+    if (num_bins == size_t(0)) {
+      return nullptr;
+    }
+    auto data = RAJA::allocate_aligned_type<T>( RAJA::DATA_ALIGN, num_bins * sizeof(T) );
+    size_t bin = 0;
+    for (auto const& value : container) {
+      new(&data[bin]) T(value);
+      ++bin;
+    }
+    return data;
+  }
+
+  static T* create_thread_data(T identity, size_t num_bins, size_t padded_bins)
+  {
+    auto data = RAJA::allocate_aligned_type<T>( RAJA::DATA_ALIGN, padded_bins * sizeof(T) );
+    for (size_t bin = 0; bin < num_bins; ++bin) {
+      new(&data[bin]) T(identity);
+    }
+    return data;
+  }
+
+  static void destroy_data(T*& data, size_t num_bins)
+  {
+    if (data == nullptr) {
+      return;
+    }
+    for (size_t bin = num_bins; bin > 0; --bin) {
+      data[bin-1].~T();
+    }
+    RAJA::free_aligned(data);
+    data = nullptr;
+  }
+
+  static T** create_thread_data_ptrs(size_t max_threads)
+  {
+    T** thread_data = new T*[max_threads];
+    for (size_t thread_idx = 0; thread_idx < max_threads; ++thread_idx) {
+      thread_data[thread_idx] = nullptr;
+    }
+    return thread_data;
+  }
+
+  static void destroy_thread_data_ptrs(T**& thread_data)
+  {
+    delete[] thread_data;
+    thread_data = nullptr;
+  }
+};
+
 }  // namespace detail
 
 RAJA_DECLARE_ALL_MULTI_REDUCERS(policy::omp::omp_multi_reduce_policy, detail::MultiReduceDataOMP)
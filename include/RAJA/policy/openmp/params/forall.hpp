@@ -94,6 +94,33 @@ namespace expt
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
     }
 
+    //
+    // omp for with a fixed static split
+    //
+    template <typename Iterable, typename Func, typename ForallParam>
+    RAJA_INLINE void forall_impl(const ::RAJA::policy::omp::FixedStatic& p,
+                                 Iterable&& iter,
+                                 Func&& loop_body,
+                                 ForallParam&& f_params)
+    {
+      using EXEC_POL = typename std::decay<decltype(p)>::type;
+      RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+      RAJA_OMP_DECLARE_REDUCTION_COMBINE;
+
+      RAJA_EXTRACT_BED_IT(iter);
+      #pragma omp parallel reduction(combine : f_params)
+      {
+        const int num_threads = omp_get_num_threads();
+        const int tid = omp_get_thread_num();
+        const auto i_end = EXEC_POL::end(distance_it, num_threads, tid);
+        for (auto i = EXEC_POL::begin(distance_it, num_threads, tid); i < i_end; ++i) {
+          RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        }
+      }
+
+      RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+    }
+
     //
     // omp for schedule(runtime)
     //
@@ -297,6 +324,32 @@ namespace expt
     expt::internal::forall_impl(Schedule{}, std::forward<Iterable>(iter), std::forward<Func>(loop_body), std::forward<ForallParam>(f_params));
     return resources::EventProxy<resources::Host>(host_res);
   }
+
+  template <int Grain, typename Iterable, typename Func, typename ForallParam>
+  RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                                 const omp_ws_exec<Grain>& p,
+                                                                 Iterable&& iter,
+                                                                 Func&& loop_body,
+                                                                 ForallParam f_params)
+  {
+    using EXEC_POL = typename std::decay<decltype(p)>::type;
+    RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+    RAJA_OMP_DECLARE_REDUCTION_COMBINE;
+
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp parallel reduction(combine : f_params)
+    {
+      RAJA::detail::openmp::work_stealing_for(Grain, distance_it,
+          [&](std::ptrdiff_t chunk_begin, std::ptrdiff_t chunk_end) {
+        for (std::ptrdiff_t i = chunk_begin; i < chunk_end; ++i) {
+          RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        }
+      });
+    }
+
+    RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+    return resources::EventProxy<resources::Host>(host_res);
+  }
 } //  namespace expt
 
 ///
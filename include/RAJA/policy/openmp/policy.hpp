@@ -48,7 +48,8 @@ namespace omp
 enum struct multi_reduce_algorithm : int
 {
   combine_on_destruction,
-  combine_on_get
+  combine_on_get,
+  combine_in_parallel
 };
 
 template < multi_reduce_algorithm t_algorithm >
@@ -56,7 +57,20 @@ struct MultiReduceTuning
 {
   static constexpr multi_reduce_algorithm algorithm = t_algorithm;
   static constexpr bool consistent =
-      (algorithm == multi_reduce_algorithm::combine_on_get);
+      (algorithm == multi_reduce_algorithm::combine_on_get) ||
+      (algorithm == multi_reduce_algorithm::combine_in_parallel);
+};
+
+enum struct scan_algorithm : int
+{
+  three_pass,
+  single_pass
+};
+
+template < scan_algorithm t_algorithm >
+struct ScanTuning
+{
+  static constexpr scan_algorithm algorithm = t_algorithm;
 };
 
 } // namspace omp
@@ -95,6 +109,9 @@ struct For {
 struct NoWait {
 };
 
+struct WorkSteal {
+};
+
 static constexpr int default_chunk_size = -1;
 
 struct Auto : public internal::Schedule<omp_sched_auto, default_chunk_size>{
@@ -104,6 +121,39 @@ template <int ChunkSize = default_chunk_size>
 struct Static : public internal::Schedule<omp_sched_static, ChunkSize> {
 };
 
+///
+///  Static schedule with a fixed split of the iterations. Thread t of p
+///  threads runs the t-th of p contiguous blocks of the iterations, the
+///  first len % p blocks are one iteration longer. Loops with the same
+///  length and thread count run each iteration on the same thread in every
+///  call, unlike schedule(static) whose split is implementation defined, so
+///  data first touched by a loop stays in the NUMA domain of the thread that
+///  uses it.
+///
+struct FixedStatic : public internal::Schedule<omp_sched_static, default_chunk_size> {
+
+  /// first iteration of thread tid of num_threads in a loop of len iterations
+  template <typename DistanceT>
+  RAJA_INLINE static constexpr DistanceT begin(DistanceT len,
+                                              int num_threads,
+                                              int tid)
+  {
+    return static_cast<DistanceT>(tid) * (len / num_threads) +
+           ((static_cast<DistanceT>(tid) < len % num_threads)
+                ? static_cast<DistanceT>(tid)
+                : len % num_threads);
+  }
+
+  /// end of the iterations of thread tid of num_threads
+  template <typename DistanceT>
+  RAJA_INLINE static constexpr DistanceT end(DistanceT len,
+                                            int num_threads,
+                                            int tid)
+  {
+    return begin(len, num_threads, tid + 1);
+  }
+};
+
 template <int ChunkSize = default_chunk_size>
 using Dynamic = internal::Schedule<omp_sched_dynamic, ChunkSize>;
 
@@ -141,6 +191,44 @@ struct omp_launch_t
                                             Platform::host> {
 };
 
+///
+///  Struct supporting RAJA::launch with teams of host threads. The threads
+///  are split into teams of ThreadsPerTeam threads, or into one team for
+///  each OpenMP place when ThreadsPerTeam is 0, so a team can share a cache
+///  or a NUMA domain. Each team has its own shared memory and teamSync
+///  barrier.
+///
+template <int ThreadsPerTeam = 0>
+struct omp_launch_teams_t
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+  static constexpr int threads_per_team = ThreadsPerTeam;
+};
+
+///
+///  Structs supporting loops in RAJA::launch with omp_launch_teams_t.
+///  omp_launch_team_loop gives the iterations to the teams in turn and every
+///  thread of a team runs the iterations of its team, as a GPU block loop.
+///  omp_launch_thread_loop gives the iterations to the threads of a team in
+///  turn, as a GPU thread loop, with no barrier at the end. Outside of
+///  omp_launch_teams_t the loops are sequential.
+///
+struct omp_launch_team_loop
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+///
+struct omp_launch_thread_loop
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 
 ///
 ///  Struct supporting OpenMP 'for nowait schedule( )'
@@ -154,7 +242,7 @@ struct omp_for_nowait_schedule_exec : make_policy_pattern_launch_platform_t<Poli
                                                               omp::NoWait,
                                                               Sched> {
     static_assert(std::is_base_of<::RAJA::policy::omp::internal::ScheduleTag, Sched>::value,
-        "Schedule type must be one of: Auto|Runtime|Static|Dynamic|Guided");
+        "Schedule type must be one of: Auto|Runtime|Static|FixedStatic|Dynamic|Guided");
 };
 
 
@@ -169,7 +257,7 @@ struct omp_for_schedule_exec : make_policy_pattern_launch_platform_t<Policy::ope
                                                               omp::For,
                                                               Sched> {
     static_assert(std::is_base_of<::RAJA::policy::omp::internal::ScheduleTag, Sched>::value,
-        "Schedule type must be one of: Auto|Runtime|Static|Dynamic|Guided");
+        "Schedule type must be one of: Auto|Runtime|Static|FixedStatic|Dynamic|Guided");
 };
 
 ///
@@ -182,6 +270,9 @@ using omp_for_exec = omp_for_schedule_exec<Auto>;
 template <int ChunkSize = default_chunk_size>
 using omp_for_static_exec = omp_for_schedule_exec<omp::Static<ChunkSize>>;
 
+///
+using omp_for_fixed_static_exec = omp_for_schedule_exec<omp::FixedStatic>;
+
 ///
 template <int ChunkSize = default_chunk_size>
 using omp_for_dynamic_exec = omp_for_schedule_exec<omp::Dynamic<ChunkSize>>;
@@ -210,6 +301,26 @@ using omp_for_runtime_exec = omp_for_schedule_exec<omp::Runtime>;
 template <int ChunkSize = default_chunk_size>
 using omp_for_nowait_static_exec = omp_for_nowait_schedule_exec<omp::Static<ChunkSize>>;
 
+///
+using omp_for_nowait_fixed_static_exec = omp_for_nowait_schedule_exec<omp::FixedStatic>;
+
+///
+///  Struct supporting work stealing loops within an omp_parallel_exec
+///  construct. Each thread starts with a contiguous part of the loop and
+///  splits off half of its remaining iterations for idle threads to steal
+///  whenever its deque is empty. Iterations run in chunks of Grain, a
+///  Grain <= 0 picks the chunk size from the loop length and thread count.
+///
+template <int Grain = default_chunk_size>
+struct omp_ws_exec : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                           Pattern::forall,
+                                                           Launch::undefined,
+                                                           Platform::host,
+                                                           omp::For,
+                                                           omp::WorkSteal> {
+  static constexpr int grain = Grain;
+};
+
 ///
 ///  Struct supporting OpenMP 'parallel' region containing an inner loop
 ///  execution construct.
@@ -232,6 +343,9 @@ using omp_parallel_for_exec = omp_parallel_exec<omp_for_exec>;
 template <int ChunkSize = default_chunk_size>
 using omp_parallel_for_static_exec = omp_parallel_exec<omp_for_schedule_exec<omp::Static<ChunkSize>> >;
 
+///
+using omp_parallel_for_fixed_static_exec = omp_parallel_exec<omp_for_schedule_exec<omp::FixedStatic> >;
+
 ///
 template <int ChunkSize = default_chunk_size>
 using omp_parallel_for_dynamic_exec = omp_parallel_exec<omp_for_schedule_exec<omp::Dynamic<ChunkSize>> >;
@@ -243,6 +357,34 @@ using omp_parallel_for_guided_exec = omp_parallel_exec<omp_for_schedule_exec<omp
 ///
 using omp_parallel_for_runtime_exec = omp_parallel_exec<omp_for_schedule_exec<omp::Runtime>>;
 
+///
+template <int Grain = default_chunk_size>
+using omp_parallel_ws_exec = omp_parallel_exec<omp_ws_exec<Grain>>;
+
+///
+///  Struct supporting OpenMP 'parallel for' loops that selects the algorithm
+///  used by scans. Loops execute the same as omp_parallel_for_exec.
+///
+template < typename tuning >
+struct omp_parallel_for_scan_policy : omp_parallel_for_exec {
+};
+
+///
+template < RAJA::omp::scan_algorithm algorithm >
+using omp_parallel_for_scan_tuning = omp_parallel_for_scan_policy<
+    RAJA::omp::ScanTuning<algorithm> >;
+
+// Policies for scans with specific behaviors.
+// - three_pass scans each thread's range, scans the per thread sums, then
+//   adds the sums to each thread's range. This reads and writes the data twice.
+using omp_parallel_for_scan_three_pass_exec = omp_parallel_for_scan_tuning<
+    RAJA::omp::scan_algorithm::three_pass>;
+// - single_pass scans cache sized tiles in order, each tile gets its prefix
+//   by looking back at the aggregates and prefixes published by earlier
+//   tiles. This reads and writes the data once.
+using omp_parallel_for_scan_single_pass_exec = omp_parallel_for_scan_tuning<
+    RAJA::omp::scan_algorithm::single_pass>;
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -287,6 +429,25 @@ struct omp_work : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                         Platform::host> {
 };
 
+///
+template <int Grain = default_chunk_size>
+struct omp_ws_work : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                           Pattern::workgroup_exec,
+                                                           Launch::sync,
+                                                           Platform::host> {
+};
+
+///
+/// WorkGroup ordering policy that runs the loops concurrently by flattening
+/// the iterations of all the loops into a single iteration space that is
+/// split among the threads of a single parallel region
+///
+struct unordered_omp_flattened_loop_iter
+    : make_policy_pattern_platform_t<Policy::openmp,
+                                     Pattern::workgroup_order,
+                                     Platform::host> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -302,6 +463,11 @@ struct omp_reduce_ordered
     : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::ordered> {
 };
 
+///
+struct omp_reduce_combine_on_get
+    : make_policy_pattern_t<Policy::openmp, Pattern::reduce> {
+};
+
 ///
 template < typename tuning >
 struct omp_multi_reduce_policy
@@ -346,6 +512,12 @@ using omp_multi_reduce_combine_on_destruction = omp_multi_reduce_tuning<
 //   each thread then when get is called those values are combined.
 using omp_multi_reduce_combine_on_get = omp_multi_reduce_tuning<
     RAJA::omp::multi_reduce_algorithm::combine_on_get>;
+// - combine_in_parallel policies combine new values into a single value for
+//   each thread, allocated by that thread, then when get is called the
+//   threads' values are combined in parallel with each thread combining a
+//   range of bins.
+using omp_multi_reduce_combine_in_parallel = omp_multi_reduce_tuning<
+    RAJA::omp::multi_reduce_algorithm::combine_in_parallel>;
 
 // Policy for RAJA::MultiReduce* objects that gives the
 // same answer every time when used in the same way
@@ -381,11 +553,19 @@ using policy::omp::omp_parallel_for_exec;
 ///
 using policy::omp::omp_parallel_for_static_exec;
 ///
+using policy::omp::omp_parallel_for_fixed_static_exec;
+///
 using policy::omp::omp_parallel_for_dynamic_exec;
 ///
 using policy::omp::omp_parallel_for_guided_exec;
 ///
 using policy::omp::omp_parallel_for_runtime_exec;
+///
+using policy::omp::omp_parallel_for_scan_three_pass_exec;
+///
+using policy::omp::omp_parallel_for_scan_single_pass_exec;
+///
+using policy::omp::omp_parallel_ws_exec;
 
 ///
 /// Type aliases for omp parallel for iteration over indexset segments
@@ -409,7 +589,7 @@ using policy::omp::omp_for_exec;
 /// Type aliases for 'omp for' and 'omp for nowait' loop execution with a 
 /// scheduling policy within an omp_parallel_exec construct
 /// Scheduling policies are near the top of this file and include:
-/// RAJA::policy::omp::{Auto, Static, Dynamic, Guided, Runtime}
+/// RAJA::policy::omp::{Auto, Static, FixedStatic, Dynamic, Guided, Runtime}
 ///
 /// Helper aliases to make usage less verbose for common use cases follow these.
 ///
@@ -428,17 +608,30 @@ using policy::omp::omp_for_static_exec;
 ///
 using policy::omp::omp_for_nowait_static_exec;
 ///
+using policy::omp::omp_for_fixed_static_exec;
+///
+using policy::omp::omp_for_nowait_fixed_static_exec;
+///
 using policy::omp::omp_for_dynamic_exec;
 ///
 using policy::omp::omp_for_guided_exec;
 ///
 using policy::omp::omp_for_runtime_exec;
 
+///
+/// Type alias for work stealing loop execution within an omp_parallel_exec
+/// construct
+///
+using policy::omp::omp_ws_exec;
+
 ///
 /// Type aliases for omp parallel region
 ///
 using policy::omp::omp_parallel_region;
 using policy::omp::omp_launch_t;
+using policy::omp::omp_launch_teams_t;
+using policy::omp::omp_launch_team_loop;
+using policy::omp::omp_launch_thread_loop;
 
 ///
 /// Type aliases for omp reductions
@@ -447,9 +640,13 @@ using policy::omp::omp_reduce;
 ///
 using policy::omp::omp_reduce_ordered;
 ///
+using policy::omp::omp_reduce_combine_on_get;
+///
 using policy::omp::omp_multi_reduce;
 ///
 using policy::omp::omp_multi_reduce_ordered;
+///
+using policy::omp::omp_multi_reduce_combine_in_parallel;
 
 ///
 /// Type aliases for omp reductions
@@ -458,6 +655,10 @@ using policy::omp::omp_synchronize;
 
 ///
 using policy::omp::omp_work;
+///
+using policy::omp::omp_ws_work;
+///
+using policy::omp::unordered_omp_flattened_loop_iter;
 
 }  // namespace RAJA
 
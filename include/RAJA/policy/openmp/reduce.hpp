@@ -26,11 +26,15 @@
 #if defined(RAJA_ENABLE_OPENMP)
 
 #include <memory>
+#include <new>
 #include <vector>
 
 #include <omp.h>
 
 #include "RAJA/util/types.hpp"
+#include "RAJA/util/reduce.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
@@ -124,6 +128,136 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce_ordered, detail::ReduceOMPOrdered)
 
+///////////////////////////////////////////////////////////////////////////////
+//
+// Reductions that combine into per thread storage without synchronization.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+/*!
+ **************************************************************************
+ *
+ * \brief  OpenMP reducer combiner that combines copies into per thread
+ *         slots instead of into the parent inside a critical section.
+ *
+ * Each slot is padded to a multiple of RAJA::DATA_ALIGN bytes so threads
+ * do not share cache lines. The slots are combined pairwise, as a binary
+ * tree, when the value is requested. Copies destroyed inside nested parallel
+ * regions, active or not, or on threads beyond the slot count, fall back to
+ * the critical section.
+ *
+ **************************************************************************
+ */
+template <typename T, typename Reduce>
+class ReduceOMPCombineOnGet
+    : public reduce::detail::
+          BaseCombinable<T, Reduce, ReduceOMPCombineOnGet<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPCombineOnGet>;
+
+public:
+  ReduceOMPCombineOnGet() : ReduceOMPCombineOnGet(T(), T()) { }
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceOMPCombineOnGet(T init_val, T identity_)
+      : Base(init_val, identity_)
+  {
+    create_slots(identity_);
+  }
+
+  ReduceOMPCombineOnGet(ReduceOMPCombineOnGet const& other)
+      : Base(other)
+      , m_num_slots(other.m_num_slots)
+      , m_slots(other.m_slots)
+  { }
+
+  ReduceOMPCombineOnGet& operator=(ReduceOMPCombineOnGet const&) = delete;
+
+  ~ReduceOMPCombineOnGet()
+  {
+    if (Base::parent) {
+      const size_t thread_idx = omp_get_thread_num();
+      if (thread_idx < m_num_slots && omp_get_level() <= 1) {
+        Reduce{}(get_slot(thread_idx), Base::my_data);
+      } else {
+#pragma omp critical(ompReduceCritical)
+        Reduce{}(Base::parent->local(), Base::my_data);
+      }
+      Base::my_data = Base::identity;
+    } else {
+      destroy_slots();
+    }
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    if (m_num_slots < static_cast<size_t>(omp_get_max_threads())) {
+      destroy_slots();
+      create_slots(identity_);
+    } else {
+      for (size_t i = 0; i < m_num_slots; ++i) {
+        get_slot(i) = identity_;
+      }
+    }
+  }
+
+  T get_combined() const
+  {
+    // combine the slots pairwise in a binary tree
+    ::RAJA::detail::BinaryTreeReduce<T, typename Reduce::operator_type>
+        reducer(Base::my_data);
+    for (size_t i = 0; i < m_num_slots; ++i) {
+      reducer.combine(get_slot(i));
+    }
+    return reducer.get_and_clear();
+  }
+
+private:
+  static constexpr size_t s_slot_bytes =
+      RAJA_DIVIDE_CEILING_INT(sizeof(T), RAJA::DATA_ALIGN) * RAJA::DATA_ALIGN;
+
+  size_t m_num_slots = 0;
+  char* m_slots = nullptr;
+
+  T& get_slot(size_t i) const
+  {
+    return *reinterpret_cast<T*>(m_slots + i * s_slot_bytes);
+  }
+
+  void create_slots(T const& identity_)
+  {
+    m_num_slots = omp_get_max_threads();
+    m_slots = RAJA::allocate_aligned_type<char>(RAJA::DATA_ALIGN,
+                                                m_num_slots * s_slot_bytes);
+    if (m_slots == nullptr) {
+      RAJA_ABORT_OR_THROW("ReduceOMPCombineOnGet failed to allocate slots");
+    }
+    for (size_t i = 0; i < m_num_slots; ++i) {
+      new (m_slots + i * s_slot_bytes) T(identity_);
+    }
+  }
+
+  void destroy_slots()
+  {
+    if (m_slots != nullptr) {
+      for (size_t i = 0; i < m_num_slots; ++i) {
+        get_slot(i).~T();
+      }
+      RAJA::free_aligned(m_slots);
+      m_slots = nullptr;
+      m_num_slots = 0;
+    }
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(omp_reduce_combine_on_get,
+                          detail::ReduceOMPCombineOnGet)
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_OPENMP guard
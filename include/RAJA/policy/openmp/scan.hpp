@@ -21,8 +21,12 @@
 #include "RAJA/config.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -39,17 +43,110 @@ namespace impl
 namespace scan
 {
 
+namespace detail
+{
+namespace openmp
+{
+
 /*!
-        \brief explicit inclusive inplace scan given range, function, and
-   initial value
+        \brief get the scan tuning of the given policy, policies without a
+               scan tuning use the three pass algorithm
 */
-template <typename Policy, typename Iter, typename BinFn>
+template <typename Policy>
+struct scan_tuning
+{
+  using type = RAJA::omp::ScanTuning<RAJA::omp::scan_algorithm::three_pass>;
+};
+///
+template <typename tuning>
+struct scan_tuning<::RAJA::policy::omp::omp_parallel_for_scan_policy<tuning>>
+{
+  using type = tuning;
+};
+
+template <typename tuning>
+using scan_is_single_pass = std::integral_constant<bool,
+    tuning::algorithm == RAJA::omp::scan_algorithm::single_pass>;
+
+// this number is arbitrary, tiles should fit in cache
+constexpr size_t get_scan_tile_bytes() { return 32*1024; }
+
+/*!
+        \brief number of items in each tile of a single pass scan
+*/
+template <typename Value>
+constexpr std::ptrdiff_t get_scan_tile_iterates()
+{
+  return (sizeof(Value) < get_scan_tile_bytes())
+             ? static_cast<std::ptrdiff_t>(get_scan_tile_bytes() / sizeof(Value))
+             : std::ptrdiff_t(1);
+}
+
+/*!
+        \brief status of a tile in a single pass scan, the aggregate of the
+               tile may be read once flag is aggregate_available and the
+               inclusive prefix of the tile may be read once flag is
+               prefix_available
+*/
+template <typename Value>
+struct ScanTileStatus
+{
+  static constexpr int invalid = 0;
+  static constexpr int aggregate_available = 1;
+  static constexpr int prefix_available = 2;
+
+  std::atomic<int> flag{invalid};
+  Value aggregate;
+  Value prefix;
+};
+
+/*!
+        \brief exclusive prefix of tile in a single pass scan, combines the
+               aggregates of earlier tiles until reaching a published
+               inclusive prefix, tile 0 must publish its inclusive prefix
+               without looking back
+*/
+template <typename Value, typename DistanceT, typename BinFn>
 RAJA_INLINE
-concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<Policy>>
+Value
+scan_tile_look_back(
+    ScanTileStatus<Value>* status,
+    DistanceT tile,
+    BinFn f)
+{
+  using TileStatus = ScanTileStatus<Value>;
+  DistanceT look_back = tile - 1;
+  int flag = status[look_back].flag.load(std::memory_order_acquire);
+  while (flag == TileStatus::invalid) {
+    std::this_thread::yield();
+    flag = status[look_back].flag.load(std::memory_order_acquire);
+  }
+  Value prefix = (flag == TileStatus::prefix_available)
+                     ? status[look_back].prefix
+                     : status[look_back].aggregate;
+  while (flag != TileStatus::prefix_available) {
+    --look_back;
+    flag = status[look_back].flag.load(std::memory_order_acquire);
+    while (flag == TileStatus::invalid) {
+      std::this_thread::yield();
+      flag = status[look_back].flag.load(std::memory_order_acquire);
+    }
+    prefix = (flag == TileStatus::prefix_available)
+                 ? f(status[look_back].prefix, prefix)
+                 : f(status[look_back].aggregate, prefix);
+  }
+  return prefix;
+}
+
+/*!
+        \brief three pass inclusive inplace scan given range and function
+*/
+template <typename tuning, typename Iter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if<concepts::negate<scan_is_single_pass<tuning>>>
 inclusive_inplace(
     resources::Host host_res,
-    const Policy&,
+    tuning,
     Iter begin,
     Iter end,
     BinFn f)
@@ -68,33 +165,30 @@ inclusive_inplace(
     const DistanceT idx_begin = firstIndex(n, p, pid);
     const DistanceT idx_end = firstIndex(n, p, pid + 1);
     if (idx_begin != idx_end) {
-      inclusive_inplace(host_res, ::RAJA::seq_exec{},
+      scan::inclusive_inplace(host_res, ::RAJA::seq_exec{},
                         begin + idx_begin, begin + idx_end, f);
       sums[pid] = begin[idx_end - 1];
     }
 #pragma omp barrier
 #pragma omp single
-    exclusive_inplace(host_res, ::RAJA::seq_exec{},
+    scan::exclusive_inplace(host_res, ::RAJA::seq_exec{},
                       sums.data(), sums.data() + p, f, BinFn::identity());
     for (auto i = idx_begin; i < idx_end; ++i) {
       begin[i] = f(begin[i], sums[pid]);
     }
   }
-
-  return resources::EventProxy<resources::Host>(host_res);
 }
 
 /*!
-        \brief explicit exclusive inplace scan given range, function, and
+        \brief three pass exclusive inplace scan given range, function, and
    initial value
 */
-template <typename Policy, typename Iter, typename BinFn, typename ValueT>
+template <typename tuning, typename Iter, typename BinFn, typename ValueT>
 RAJA_INLINE
-concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<Policy>>
+concepts::enable_if<concepts::negate<scan_is_single_pass<tuning>>>
 exclusive_inplace(
     resources::Host host_res,
-    const Policy&,
+    tuning,
     Iter begin,
     Iter end,
     BinFn f,
@@ -116,18 +210,279 @@ exclusive_inplace(
     const Value init = ((pid == 0) ? v : *(begin + idx_begin - 1));
 #pragma omp barrier
     if (idx_begin != idx_end) {
-      exclusive_inplace(host_res, seq_exec{},
+      scan::exclusive_inplace(host_res, ::RAJA::seq_exec{},
                         begin + idx_begin, begin + idx_end, f, init);
       sums[pid] = begin[idx_end - 1];
     }
 #pragma omp barrier
 #pragma omp single
-    exclusive_inplace(host_res, seq_exec{},
+    scan::exclusive_inplace(host_res, ::RAJA::seq_exec{},
                       sums.data(), sums.data() + p, f, BinFn::identity());
     for (auto i = idx_begin; i < idx_end; ++i) {
       begin[i] = f(begin[i], sums[pid]);
     }
   }
+}
+
+/*!
+        \brief single pass inplace scan given range, function, and
+   initial value
+
+   Threads take cache sized tiles in order. Each thread reduces its tile and
+   publishes the aggregate, then looks back at earlier tiles combining their
+   aggregates until it finds a published inclusive prefix. It publishes its
+   own inclusive prefix and scans the tile while the tile is still in cache.
+   Tiles are taken in order so every tile a thread waits on was taken by a
+   running thread.
+*/
+template <bool Exclusive, typename Iter, typename BinFn, typename ValueT>
+RAJA_INLINE
+void
+single_pass_inplace(
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  using std::distance;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  using TileStatus = ScanTileStatus<Value>;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  const DistanceT tile_size = get_scan_tile_iterates<Value>();
+  const DistanceT num_tiles = (n + tile_size - 1) / tile_size;
+  const int p0 = std::min(num_tiles, static_cast<DistanceT>(omp_get_max_threads()));
+
+  std::unique_ptr<TileStatus[]> status(new TileStatus[num_tiles]);
+  std::atomic<DistanceT> next_tile{0};
+
+#pragma omp parallel num_threads(p0)
+  {
+    for (DistanceT tile = next_tile.fetch_add(1, std::memory_order_relaxed);
+         tile < num_tiles;
+         tile = next_tile.fetch_add(1, std::memory_order_relaxed)) {
+
+      const DistanceT idx_begin = tile * tile_size;
+      const DistanceT idx_end = std::min(idx_begin + tile_size, n);
+      TileStatus& tile_status = status[tile];
+
+      Value prefix;
+      if (tile == 0) {
+
+        prefix = Exclusive ? Value(v) : begin[idx_begin];
+
+      } else {
+
+        Value aggregate = begin[idx_begin];
+        for (DistanceT i = idx_begin + 1; i < idx_end; ++i) {
+          aggregate = f(aggregate, begin[i]);
+        }
+        tile_status.aggregate = aggregate;
+        tile_status.flag.store(TileStatus::aggregate_available,
+                               std::memory_order_release);
+
+        prefix = scan_tile_look_back(status.get(), tile, f);
+
+        tile_status.prefix = f(prefix, aggregate);
+        tile_status.flag.store(TileStatus::prefix_available,
+                               std::memory_order_release);
+      }
+
+      if (Exclusive) {
+        for (DistanceT i = idx_begin; i < idx_end; ++i) {
+          Value next = f(prefix, begin[i]);
+          begin[i] = prefix;
+          prefix = next;
+        }
+      } else {
+        DistanceT i = idx_begin;
+        if (tile == 0) {
+          ++i;
+        }
+        for (; i < idx_end; ++i) {
+          prefix = f(prefix, begin[i]);
+          begin[i] = prefix;
+        }
+      }
+
+      if (tile == 0) {
+        tile_status.prefix = prefix;
+        tile_status.flag.store(TileStatus::prefix_available,
+                               std::memory_order_release);
+      }
+    }
+  }
+}
+
+/*!
+        \brief single pass inclusive inplace scan given range and function
+*/
+template <typename tuning, typename Iter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if<scan_is_single_pass<tuning>>
+inclusive_inplace(
+    resources::Host host_res,
+    tuning,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  if (end - begin <= get_scan_tile_iterates<Value>()) {
+    scan::inclusive_inplace(host_res, ::RAJA::seq_exec{}, begin, end, f);
+  } else {
+    single_pass_inplace<false>(begin, end, f, BinFn::identity());
+  }
+}
+
+/*!
+        \brief single pass exclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename tuning, typename Iter, typename BinFn, typename ValueT>
+RAJA_INLINE
+concepts::enable_if<scan_is_single_pass<tuning>>
+exclusive_inplace(
+    resources::Host host_res,
+    tuning,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  if (end - begin <= get_scan_tile_iterates<Value>()) {
+    scan::exclusive_inplace(host_res, ::RAJA::seq_exec{}, begin, end, f, v);
+  } else {
+    single_pass_inplace<true>(begin, end, f, v);
+  }
+}
+
+/*!
+        \brief segmented scan given input range, output, segment head
+   predicate, function, and initial value of each exclusive segment
+
+   Each thread scans its part of the range treating its first item as the
+   start of a segment, and records the aggregate of its last segment and
+   whether its part has a segment head. The aggregates are combined
+   sequentially into the carry into each part, which each thread then
+   applies to the items before its first segment head.
+*/
+template <bool Exclusive,
+          typename Iter,
+          typename OutIter,
+          typename HeadFn,
+          typename BinFn,
+          typename ValueT>
+RAJA_INLINE
+void
+segmented_scan(
+    Iter begin,
+    Iter end,
+    OutIter out,
+    HeadFn is_head,
+    BinFn f,
+    ValueT v)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  using Value = camp::decay<decltype(*out)>;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  ::std::vector<Value> carries(p0, Value());
+  ::std::vector<char> has_heads(p0, 0);
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+    if (idx_begin != idx_end) {
+      bool has_head = is_head(idx_begin);
+      Value agg = (Exclusive && !has_head) ? Value(BinFn::identity())
+                                           : Value(v);
+      for (DistanceT i = idx_begin; i < idx_end; ++i) {
+        const bool head = (i == idx_begin) ? has_head : is_head(i);
+        has_head = has_head || head;
+        if (Exclusive) {
+          if (head) {
+            agg = v;
+          }
+          Value t = begin[i];
+          out[i] = agg;
+          agg = f(agg, t);
+        } else {
+          agg = (i == idx_begin || head) ? Value(begin[i]) : f(agg, begin[i]);
+          out[i] = agg;
+        }
+      }
+      carries[pid] = agg;
+      has_heads[pid] = has_head;
+    }
+#pragma omp barrier
+#pragma omp single
+    {
+      // carries[t] becomes the carry into part t + 1
+      for (int t = 1; t < p; ++t) {
+        if (!has_heads[t]) {
+          carries[t] = f(carries[t - 1], carries[t]);
+        }
+      }
+    }
+    if (pid > 0 && idx_begin != idx_end && !is_head(idx_begin)) {
+      const Value carry = carries[pid - 1];
+      out[idx_begin] = f(carry, out[idx_begin]);
+      for (DistanceT i = idx_begin + 1; i < idx_end && !is_head(i); ++i) {
+        out[i] = f(carry, out[i]);
+      }
+    }
+  }
+}
+
+}  // namespace openmp
+
+}  // namespace detail
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<Policy>>
+inclusive_inplace(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  using tuning = typename detail::openmp::scan_tuning<Policy>::type;
+  detail::openmp::inclusive_inplace(host_res, tuning{}, begin, end, f);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename BinFn, typename ValueT>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<Policy>>
+exclusive_inplace(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  using tuning = typename detail::openmp::scan_tuning<Policy>::type;
+  detail::openmp::exclusive_inplace(host_res, tuning{}, begin, end, f, v);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -179,6 +534,61 @@ exclusive(
   return exclusive_inplace(host_res, exec, out, out + distance(begin, end), f, v);
 }
 
+/*!
+        \brief explicit segmented inclusive scan given input range, output,
+   segment head predicate, and function
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename HeadFn,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<Policy>>
+inclusive_segmented(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    HeadFn is_head,
+    BinFn f)
+{
+  detail::openmp::segmented_scan<false>(begin, end, out, is_head, f,
+                                        BinFn::identity());
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit segmented exclusive scan given input range, output,
+   segment head predicate, function, and initial value of each segment
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename HeadFn,
+          typename BinFn,
+          typename ValueT>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<Policy>>
+exclusive_segmented(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    HeadFn is_head,
+    BinFn f,
+    ValueT v)
+{
+  detail::openmp::segmented_scan<true>(begin, end, out, is_head, f, v);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace scan
 
 }  // namespace impl
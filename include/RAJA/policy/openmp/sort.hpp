@@ -21,8 +21,10 @@
 #include "RAJA/config.hpp"
 
 #include <algorithm>
+#include <climits>
 #include <functional>
 #include <iterator>
+#include <memory>
 
 #include <omp.h>
 
@@ -30,6 +32,10 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/util/zip.hpp"
+
+#include "RAJA/util/sort.hpp"
+
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/sequential/sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
@@ -186,6 +192,231 @@ void sort(Sorter sorter,
   }
 }
 
+// this number is arbitrary
+constexpr int get_min_iterates_per_radix_thread() { return 4096; }
+
+/*!
+        \brief stable LSD radix sort given range of keys moving the given
+               values with the keys, each pass counts digits into per thread
+               histograms, computes each thread's bucket offsets from the
+               histograms of all threads, then scatters in parallel
+*/
+template <typename Iter, typename Vals, typename Compare>
+inline void radix_sort(Iter begin,
+                       Iter end,
+                       Vals& vals,
+                       Compare comp)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using key_type = RAJA::detail::IterVal<Iter>;
+
+  constexpr diff_type min_iterates_per_thread = get_min_iterates_per_radix_thread();
+  constexpr unsigned digit_bits = RAJA::detail::radix_sort_digit_bits::get();
+  constexpr unsigned num_buckets = 1u << digit_bits;
+  constexpr unsigned num_passes = (sizeof(key_type)*CHAR_BIT + digit_bits - 1) / digit_bits;
+
+  const diff_type len = end - begin;
+
+  const diff_type max_threads = omp_get_max_threads();
+
+  const diff_type requested_num_threads = std::min((len+min_iterates_per_thread-1)/min_iterates_per_thread, max_threads);
+
+  if (requested_num_threads <= 1) {
+    RAJA::detail::radix_sort_impl(begin, end, vals, comp);
+    return;
+  }
+
+  std::unique_ptr<key_type, FreeAligned> key_buf(
+      RAJA::allocate_aligned_type<key_type>( RAJA::DATA_ALIGN, len * sizeof(key_type) ));
+
+  // one row of counts per thread, each row is a multiple of the alignment
+  // so threads do not share cache lines
+  std::unique_ptr<diff_type, FreeAligned> counts_buf(
+      RAJA::allocate_aligned_type<diff_type>( RAJA::DATA_ALIGN, max_threads * num_buckets * sizeof(diff_type) ));
+
+  key_type* buf = key_buf.get();
+  diff_type* counts = counts_buf.get();
+
+  // check memory allocation worked
+  if (buf == nullptr || counts == nullptr) {
+    RAJA_ABORT_OR_THROW( "radix_sort temporary memory allocation failed" );
+  }
+
+#pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
+  {
+    const diff_type num_threads = omp_get_num_threads();
+
+    const diff_type thread_id = omp_get_thread_num();
+
+    const diff_type i_begin = firstIndex(len, num_threads, thread_id);
+    const diff_type i_end   = firstIndex(len, num_threads, thread_id + 1);
+
+    diff_type* thread_counts = counts + thread_id * num_buckets;
+    diff_type offsets[num_buckets];
+
+    // every thread moves its own copy of the values view through the passes
+    Vals thread_vals = vals;
+
+    bool in_buffer = false;
+    for (unsigned pass = 0; pass < num_passes; ++pass) {
+
+      const unsigned shift = pass*digit_bits;
+
+      std::fill(thread_counts, thread_counts + num_buckets, diff_type(0));
+
+      if (in_buffer) {
+        RAJA::detail::radix_sort_count<Compare>(buf, i_begin, i_end, shift, thread_counts);
+      } else {
+        RAJA::detail::radix_sort_count<Compare>(begin, i_begin, i_end, shift, thread_counts);
+      }
+
+#pragma omp barrier
+
+      // this thread writes bucket d after all items in lower buckets and
+      // after the items in bucket d from lower threads
+      bool skip_pass = false;
+      diff_type offset = 0;
+      for (unsigned d = 0; d < num_buckets; ++d) {
+        diff_type lower_count = 0;
+        diff_type total_count = 0;
+        for (diff_type t = 0; t < num_threads; ++t) {
+          const diff_type count = counts[t * num_buckets + d];
+          lower_count += (t < thread_id) ? count : diff_type(0);
+          total_count += count;
+        }
+        // skip passes where every key has the same digit
+        skip_pass = skip_pass || (total_count == len);
+        offsets[d] = offset + lower_count;
+        offset += total_count;
+      }
+
+      if (!skip_pass) {
+
+        if (in_buffer) {
+          RAJA::detail::radix_sort_scatter<Compare>(buf, begin, thread_vals, i_begin, i_end, shift, offsets);
+        } else {
+          RAJA::detail::radix_sort_scatter<Compare>(begin, buf, thread_vals, i_begin, i_end, shift, offsets);
+        }
+
+        thread_vals.flip();
+        in_buffer = !in_buffer;
+      }
+
+#pragma omp barrier
+    }
+
+    if (in_buffer) {
+      std::copy(buf + i_begin, buf + i_end, begin + i_begin);
+      thread_vals.move_back(i_begin, i_end);
+    }
+
+    if (thread_id == 0) {
+      vals = thread_vals;
+    }
+  }
+}
+
+/*!
+        \brief radix sort given range if the keys and comparison function
+               allow it and the range is large enough, otherwise sort using
+               sorter
+*/
+template <typename Sorter, typename Iter, typename Compare>
+inline
+concepts::enable_if<RAJA::detail::is_radix_sortable<Iter, Compare>>
+radix_or_sort(Sorter sorter,
+              Iter begin,
+              Iter end,
+              Compare comp)
+{
+  if (end - begin <= get_min_iterates_per_task()) {
+
+    sorter(begin, end, comp);
+
+  } else {
+
+    RAJA::detail::radix_sort_no_values vals;
+    radix_sort(begin, end, vals, comp);
+  }
+}
+///
+template <typename Sorter, typename Iter, typename Compare>
+inline
+concepts::enable_if<concepts::negate<RAJA::detail::is_radix_sortable<Iter, Compare>>>
+radix_or_sort(Sorter sorter,
+              Iter begin,
+              Iter end,
+              Compare comp)
+{
+  sort(sorter, begin, end, comp);
+}
+
+/*!
+        \brief radix sort given range of pairs if the keys and comparison
+               function allow it and the range is large enough, otherwise
+               sort using sorter
+*/
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+inline
+concepts::enable_if<RAJA::detail::is_radix_sortable<KeyIter, Compare>>
+radix_or_sort_pairs(Sorter sorter,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<KeyIter>;
+  using value_type = RAJA::detail::IterVal<ValIter>;
+
+  const diff_type len = keys_end - keys_begin;
+
+  if (len <= get_min_iterates_per_task()) {
+
+    auto begin  = RAJA::zip(keys_begin, vals_begin);
+    auto end    = RAJA::zip(keys_end, vals_begin+len);
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    sorter(begin, end, RAJA::compare_first<zip_ref>(comp));
+
+  } else {
+
+    // Manage the lifetime of the buffer and objects constructed in the buffer
+    using buf_deleter_type = FreeAlignedType<value_type, diff_type>;
+    buf_deleter_type buf_deleter;
+
+    std::unique_ptr<value_type, buf_deleter_type&> val_buf(
+        RAJA::allocate_aligned_type<value_type>( RAJA::DATA_ALIGN, len * sizeof(value_type) ),
+        buf_deleter);
+
+    // check memory allocation worked
+    if (val_buf.get() == nullptr) {
+      RAJA_ABORT_OR_THROW( "radix_sort temporary memory allocation failed" );
+    }
+
+    RAJA::detail::radix_sort_values<ValIter> vals(vals_begin, val_buf.get());
+    radix_sort(keys_begin, keys_end, vals, comp);
+
+    if (vals.buf_constructed) {
+      buf_deleter.size = len;
+    }
+  }
+}
+///
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+inline
+concepts::enable_if<concepts::negate<RAJA::detail::is_radix_sortable<KeyIter, Compare>>>
+radix_or_sort_pairs(Sorter sorter,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    Compare comp)
+{
+  auto begin  = RAJA::zip(keys_begin, vals_begin);
+  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  sort(sorter, begin, end, RAJA::compare_first<zip_ref>(comp));
+}
+
 } // namespace openmp
 
 } // namespace detail
@@ -203,7 +434,7 @@ unstable(
     Iter end,
     Compare comp)
 {
-  detail::openmp::sort(detail::UnstableSorter{}, begin, end, comp);
+  detail::openmp::radix_or_sort(detail::UnstableSorter{}, begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -221,7 +452,7 @@ stable(
     Iter end,
     Compare comp)
 {
-  detail::openmp::sort(detail::StableSorter{}, begin, end, comp);
+  detail::openmp::radix_or_sort(detail::StableSorter{}, begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -240,10 +471,7 @@ unstable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::openmp::radix_or_sort_pairs(detail::UnstableSorter{}, keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -262,10 +490,7 @@ stable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::openmp::radix_or_sort_pairs(detail::StableSorter{}, keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
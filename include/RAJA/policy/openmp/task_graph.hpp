@@ -0,0 +1,228 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the dependency graph scheduler used by
+ *          the OpenMP task graph index set segment iteration policy.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_openmp_task_graph_HPP
+#define RAJA_openmp_task_graph_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/internal/DepGraphNode.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+namespace RAJA
+{
+namespace detail
+{
+namespace openmp
+{
+
+/*!
+ * \brief  Queue of ready tasks owned by one thread. The owner pushes and
+ *         pops at the back, other threads steal from the front.
+ */
+class alignas(RAJA::DATA_ALIGN) TaskGraphQueue
+{
+public:
+  void push(int task)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.push_back(task);
+  }
+
+  bool pop(int& task)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_tasks.empty()) {
+      return false;
+    }
+    task = m_tasks.back();
+    m_tasks.pop_back();
+    return true;
+  }
+
+  bool steal(int& task)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_tasks.empty()) {
+      return false;
+    }
+    task = m_tasks.front();
+    m_tasks.pop_front();
+    return true;
+  }
+
+private:
+  std::mutex m_mutex;
+  std::deque<int> m_tasks;
+};
+
+/*!
+ * \brief  State of one run of a dependency graph, each node has a counter
+ *         of its dependencies that have not completed yet.
+ */
+struct TaskGraphRun {
+  TaskGraphRun(DepGraphNode const* nodes_, int num_nodes, int num_queues_)
+      : nodes(nodes_),
+        num_queues(num_queues_),
+        counts(new std::atomic<int>[num_nodes]),
+        remaining(num_nodes)
+  {
+    bool any_ready = false;
+    for (int i = 0; i < num_nodes; ++i) {
+      const int count = nodes[i].semaphoreReloadValue();
+      counts[i].store(count, std::memory_order_relaxed);
+      any_ready = any_ready || (count == 0);
+    }
+    if (!any_ready) {
+      RAJA_ABORT_OR_THROW("TaskGraphRun dependency graph has no ready task");
+    }
+
+    queues = RAJA::allocate_aligned_type<TaskGraphQueue>(
+        RAJA::DATA_ALIGN, num_queues * sizeof(TaskGraphQueue));
+    if (queues == nullptr) {
+      RAJA_ABORT_OR_THROW("TaskGraphRun failed to allocate queues");
+    }
+    for (int q = 0; q < num_queues; ++q) {
+      new (&queues[q]) TaskGraphQueue();
+    }
+
+    // spread the tasks without dependencies over the queues
+    int num_ready = 0;
+    for (int i = 0; i < num_nodes; ++i) {
+      if (nodes[i].semaphoreReloadValue() == 0) {
+        queues[num_ready % num_queues].push(i);
+        ++num_ready;
+      }
+    }
+  }
+
+  TaskGraphRun(TaskGraphRun const&) = delete;
+  TaskGraphRun& operator=(TaskGraphRun const&) = delete;
+
+  ~TaskGraphRun()
+  {
+    for (int q = 0; q < num_queues; ++q) {
+      queues[q].~TaskGraphQueue();
+    }
+    RAJA::free_aligned(queues);
+  }
+
+  //! get a ready task, from queue q first then from the other queues
+  bool get_task(int q, int& task)
+  {
+    if (queues[q].pop(task)) {
+      return true;
+    }
+    for (int i = 1; i < num_queues; ++i) {
+      if (queues[(q + i) % num_queues].steal(task)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  DepGraphNode const* nodes;
+  int num_queues;
+  TaskGraphQueue* queues;
+  std::unique_ptr<std::atomic<int>[]> counts;
+  std::atomic<int> remaining;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Run func(task) for each node of a dependency graph in an OpenMP
+ *         parallel region, running a node only after the nodes it depends
+ *         on have completed.
+ *
+ * The graph must be acyclic and each node's semaphoreReloadValue() must be
+ * its number of dependencies. The graph itself is not modified.
+ *
+ * When a task completes it decrements the counters of its dependents, a
+ * dependent whose counter reaches zero is ready. The first ready dependent
+ * is run next by the same thread, which keeps the data it shares with the
+ * completed task in cache, the others are pushed on the thread's queue.
+ * Threads without ready tasks steal from the other queues, so no thread
+ * waits on a task that is not ready while other tasks are.
+ *
+ ******************************************************************************
+ */
+template <typename Func>
+RAJA_INLINE void task_graph_for(DepGraphNode const* nodes,
+                                int num_nodes,
+                                Func&& func)
+{
+  if (num_nodes <= 0) {
+    return;
+  }
+
+  TaskGraphRun run(nodes, num_nodes, omp_get_max_threads());
+
+#pragma omp parallel
+  {
+    const int q = omp_get_thread_num() % run.num_queues;
+
+    int task = -1;
+    while (run.remaining.load(std::memory_order_acquire) > 0) {
+      if (!run.get_task(q, task)) {
+        std::this_thread::yield();
+        continue;
+      }
+
+      while (task >= 0) {
+        func(task);
+
+        DepGraphNode const& node = run.nodes[task];
+        int next = -1;
+        for (int ii = 0; ii < node.numDepTasks(); ++ii) {
+          const int dep = node.depTaskNum(ii);
+          if (run.counts[dep].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            if (next < 0) {
+              next = dep;
+            } else {
+              run.queues[q].push(dep);
+            }
+          }
+        }
+        run.remaining.fetch_sub(1, std::memory_order_acq_rel);
+        task = next;
+      }
+    }
+  }
+}
+
+}  // namespace openmp
+}  // namespace detail
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,285 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the work stealing loop scheduler used by
+ *          the OpenMP work stealing execution policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_openmp_work_stealing_HPP
+#define RAJA_openmp_work_stealing_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <thread>
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+namespace RAJA
+{
+namespace detail
+{
+namespace openmp
+{
+
+//! range of loop iterations [begin, end)
+struct WorkStealingRange {
+  std::ptrdiff_t begin;
+  std::ptrdiff_t end;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Chase-Lev work stealing deque of iteration ranges.
+ *
+ * The owning thread pushes and pops at the bottom while other threads steal
+ * from the top. Ranges are only pushed when the deque is empty, so a small
+ * fixed capacity is enough and the deque never grows.
+ *
+ ******************************************************************************
+ */
+class alignas(RAJA::DATA_ALIGN) WorkStealingDeque
+{
+public:
+  static constexpr long long capacity = 8;
+
+  //! check if the deque is empty, call only from the owning thread
+  bool empty() const
+  {
+    return m_bottom.load(std::memory_order_relaxed) <=
+           m_top.load(std::memory_order_relaxed);
+  }
+
+  //! push a range at the bottom, call only from the owning thread
+  bool push(WorkStealingRange const& range)
+  {
+    const long long b = m_bottom.load(std::memory_order_relaxed);
+    const long long t = m_top.load(std::memory_order_acquire);
+    if (b - t >= capacity) {
+      return false;
+    }
+    m_begin[b & mask].store(range.begin, std::memory_order_relaxed);
+    m_end[b & mask].store(range.end, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  //! pop a range from the bottom, call only from the owning thread
+  bool pop(WorkStealingRange& range)
+  {
+    const long long b = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    long long t = m_top.load(std::memory_order_relaxed);
+
+    bool found = false;
+    if (t <= b) {
+      range.begin = m_begin[b & mask].load(std::memory_order_relaxed);
+      range.end = m_end[b & mask].load(std::memory_order_relaxed);
+      found = true;
+      if (t == b) {
+        // last range, race against thieves for it
+        found = m_top.compare_exchange_strong(t, t + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed);
+        m_bottom.store(b + 1, std::memory_order_relaxed);
+      }
+    } else {
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return found;
+  }
+
+  //! steal a range from the top, may be called from any thread
+  bool steal(WorkStealingRange& range)
+  {
+    long long t = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const long long b = m_bottom.load(std::memory_order_acquire);
+
+    if (t < b) {
+      range.begin = m_begin[t & mask].load(std::memory_order_relaxed);
+      range.end = m_end[t & mask].load(std::memory_order_relaxed);
+      return m_top.compare_exchange_strong(t, t + 1,
+                                           std::memory_order_seq_cst,
+                                           std::memory_order_relaxed);
+    }
+    return false;
+  }
+
+private:
+  static constexpr long long mask = capacity - 1;
+
+  std::atomic<long long> m_top{0};
+  std::atomic<long long> m_bottom{0};
+  std::atomic<std::ptrdiff_t> m_begin[capacity];
+  std::atomic<std::ptrdiff_t> m_end[capacity];
+};
+
+/*!
+ * \brief  State shared by the threads of a team running a work stealing loop.
+ */
+struct WorkStealingTeam {
+  WorkStealingTeam(int num_threads_, std::ptrdiff_t len)
+      : num_threads(num_threads_), remaining(len)
+  {
+    deques = RAJA::allocate_aligned_type<WorkStealingDeque>(
+        RAJA::DATA_ALIGN, num_threads * sizeof(WorkStealingDeque));
+    if (deques == nullptr) {
+      RAJA_ABORT_OR_THROW("WorkStealingTeam failed to allocate deques");
+    }
+    for (int t = 0; t < num_threads; ++t) {
+      new (&deques[t]) WorkStealingDeque();
+    }
+  }
+
+  WorkStealingTeam(WorkStealingTeam const&) = delete;
+  WorkStealingTeam& operator=(WorkStealingTeam const&) = delete;
+
+  ~WorkStealingTeam()
+  {
+    for (int t = 0; t < num_threads; ++t) {
+      deques[t].~WorkStealingDeque();
+    }
+    RAJA::free_aligned(deques);
+  }
+
+  int num_threads;
+  WorkStealingDeque* deques;
+  std::atomic<std::ptrdiff_t> remaining;
+};
+
+//! number of iterations run between checks for idle threads
+inline std::ptrdiff_t get_work_stealing_grain(int grain,
+                                              std::ptrdiff_t len,
+                                              int num_threads)
+{
+  if (grain > 0) {
+    return grain;
+  }
+  const std::ptrdiff_t auto_grain = len / (64 * num_threads);
+  return (auto_grain > 0) ? auto_grain : 1;
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Run func(begin, end) over the ranges of [0, len) using work
+ *         stealing with lazy binary splitting.
+ *
+ * Must be called by every thread of the current team, like an 'omp for'
+ * construct. Each thread starts with a contiguous part of the iterations
+ * and runs it in chunks of grain iterations. Whenever its deque is empty
+ * a thread pushes the upper half of its remaining iterations so idle
+ * threads can steal them. Ends with a barrier.
+ *
+ ******************************************************************************
+ */
+template <typename Func>
+RAJA_INLINE void work_stealing_for(int grain, std::ptrdiff_t len, Func&& func)
+{
+  const int num_threads = omp_get_num_threads();
+  if (len <= 0) {
+    return;
+  }
+  if (num_threads == 1) {
+    func(std::ptrdiff_t(0), len);
+    return;
+  }
+
+  WorkStealingTeam* team = nullptr;
+#pragma omp single copyprivate(team)
+  team = new WorkStealingTeam(num_threads, len);
+
+  const int tid = omp_get_thread_num();
+  const std::ptrdiff_t chunk = get_work_stealing_grain(grain, len, num_threads);
+  WorkStealingDeque& deque = team->deques[tid];
+
+  const std::ptrdiff_t per_thread = len / num_threads;
+  const std::ptrdiff_t extra = len % num_threads;
+  WorkStealingRange range;
+  range.begin = tid * per_thread + ((tid < extra) ? tid : extra);
+  range.end = range.begin + per_thread + ((tid < extra) ? 1 : 0);
+
+  unsigned int seed = 2654435761u * static_cast<unsigned int>(tid + 1);
+
+  for (;;) {
+
+    std::ptrdiff_t executed = 0;
+    while (range.begin < range.end) {
+      if (range.end - range.begin > chunk && deque.empty()) {
+        // lazily split off the upper half for idle threads
+        WorkStealingRange upper;
+        upper.begin = range.begin + (range.end - range.begin) / 2;
+        upper.end = range.end;
+        if (deque.push(upper)) {
+          range.end = upper.begin;
+        }
+      }
+      const std::ptrdiff_t chunk_end =
+          (range.end - range.begin > chunk) ? range.begin + chunk : range.end;
+      func(range.begin, chunk_end);
+      executed += chunk_end - range.begin;
+      range.begin = chunk_end;
+    }
+    if (executed > 0) {
+      team->remaining.fetch_sub(executed, std::memory_order_acq_rel);
+    }
+
+    if (deque.pop(range)) {
+      continue;
+    }
+
+    bool stolen = false;
+    int attempts = 0;
+    while (team->remaining.load(std::memory_order_acquire) > 0) {
+      seed = seed * 1103515245u + 12345u;
+      int victim = static_cast<int>((seed >> 16) % (num_threads - 1));
+      victim += (victim >= tid) ? 1 : 0;
+      if (team->deques[victim].steal(range)) {
+        stolen = true;
+        break;
+      }
+      if (++attempts == num_threads) {
+        attempts = 0;
+        std::this_thread::yield();
+      }
+    }
+    if (!stolen) {
+      break;
+    }
+  }
+
+#pragma omp barrier
+#pragma omp single nowait
+  delete team;
+}
+
+}  // namespace openmp
+}  // namespace detail
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
@@ -25,12 +25,15 @@
 #endif
 
 #include "RAJA/policy/sequential/forall.hpp"
+#include "RAJA/policy/sequential/fused_forall.hpp"
 #include "RAJA/policy/sequential/kernel.hpp"
 #include "RAJA/policy/sequential/policy.hpp"
 #include "RAJA/policy/sequential/reduce.hpp"
 #include "RAJA/policy/sequential/multi_reduce.hpp"
 #include "RAJA/policy/sequential/scan.hpp"
 #include "RAJA/policy/sequential/sort.hpp"
+#include "RAJA/policy/sequential/compact.hpp"
+#include "RAJA/policy/sequential/histogram.hpp"
 #include "RAJA/policy/sequential/launch.hpp"
 #include "RAJA/policy/sequential/WorkGroup.hpp"
 
@@ -0,0 +1,163 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_sequential_HPP
+#define RAJA_compact_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+/*!
+        \brief copy the items of the input range that satisfy pred to out,
+   returns the number of items copied
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename Pred>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+copy_if(
+    resources::Host,
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    Pred pred)
+{
+  using std::distance;
+  return distance(out, std::copy_if(begin, end, out, pred));
+}
+
+/*!
+        \brief move the items that satisfy pred before the items that do
+   not, returns the number of items that satisfy pred
+*/
+template <typename ExecPolicy, typename Iter, typename Pred>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+partition(
+    resources::Host,
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    Pred pred)
+{
+  using std::distance;
+  return distance(begin, std::partition(begin, end, pred));
+}
+
+/*!
+        \brief move the items that satisfy pred before the items that do
+   not keeping the order of each group, returns the number of items that
+   satisfy pred
+*/
+template <typename ExecPolicy, typename Iter, typename Pred>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+stable_partition(
+    resources::Host,
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    Pred pred)
+{
+  using std::distance;
+  return distance(begin, std::stable_partition(begin, end, pred));
+}
+
+/*!
+        \brief keep the first item of each run of equal consecutive items,
+   returns the number of items kept
+*/
+template <typename ExecPolicy, typename Iter, typename BinPred>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+unique(
+    resources::Host,
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    BinPred eq)
+{
+  using std::distance;
+  return distance(begin, std::unique(begin, end, eq));
+}
+
+/*!
+        \brief keep the first key and value of each run of equal consecutive
+   keys, returns the number of pairs kept
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename BinPred>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::IterDiff<KeyIter>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+unique_by_key(
+    resources::Host,
+    const ExecPolicy &,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    BinPred eq)
+{
+  using std::distance;
+  const auto n = distance(keys_begin, keys_end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  DistanceT count = 1;
+  for (DistanceT i = 1; i < n; ++i) {
+    if (!eq(keys_begin[count - 1], keys_begin[i])) {
+      if (count != i) {
+        keys_begin[count] = std::move(keys_begin[i]);
+        vals_begin[count] = std::move(vals_begin[i]);
+      }
+      ++count;
+    }
+  }
+
+  return count;
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
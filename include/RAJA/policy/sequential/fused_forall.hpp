@@ -0,0 +1,70 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA fused forall template methods for
+ *          sequential execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_fused_forall_sequential_HPP
+#define RAJA_fused_forall_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+#include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/detail/fused_forall.hpp"
+
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace sequential
+{
+
+/*!
+ * Stages run one after another so barriers need no synchronization.
+ */
+template <typename FusePolicy, typename Iterable, typename... Items>
+RAJA_INLINE resources::EventProxy<resources::Host>
+fused_forall_impl(resources::Host host_res,
+                  const seq_exec&,
+                  FusePolicy fuse,
+                  Iterable&& iter,
+                  camp::tuple<Items...>& items)
+{
+  using item_seq = camp::make_idx_seq_t<sizeof...(Items)>;
+  ::RAJA::expt::detail::init_fused_params<seq_exec>(items, item_seq{});
+
+  RAJA_EXTRACT_BED_IT(iter);
+
+  ::RAJA::expt::detail::run_fused_stages(
+      fuse, ::RAJA::expt::detail::FusedSeqLoop{}, begin_it,
+      decltype(distance_it)(0), distance_it, items, [] {});
+
+  ::RAJA::expt::detail::resolve_fused_params<seq_exec>(items, item_seq{});
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace sequential
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
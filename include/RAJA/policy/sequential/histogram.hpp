@@ -0,0 +1,325 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA histogram and reduce by key
+*          declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_sequential_HPP
+#define RAJA_histogram_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Operators.hpp"
+
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/sequential/sort.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+
+namespace detail
+{
+
+// this number is arbitrary, bins should fit in cache
+constexpr size_t get_histogram_cache_bins() { return 4096; }
+
+/*!
+        \brief true if keys are integers that may index dense bins
+*/
+template <typename Key>
+using is_dense_key = std::integral_constant<bool,
+    std::is_integral<Key>::value && !std::is_same<Key, bool>::value>;
+
+/*!
+        \brief number of dense bins for keys in [kmin, kmax] when there are
+               no more of them than max(n, get_histogram_cache_bins()),
+               otherwise 0 as the keys are too sparse for dense bins
+*/
+template <typename Key, typename DistanceT>
+RAJA_INLINE
+DistanceT
+get_dense_key_bins(Key kmin, Key kmax, DistanceT n)
+{
+  using UKey = typename std::make_unsigned<Key>::type;
+  const unsigned long long range = static_cast<UKey>(
+      static_cast<UKey>(kmax) - static_cast<UKey>(kmin));
+  const unsigned long long max_bins = std::max(
+      static_cast<unsigned long long>(n),
+      static_cast<unsigned long long>(get_histogram_cache_bins()));
+  return (range < max_bins) ? static_cast<DistanceT>(range + 1)
+                            : DistanceT(0);
+}
+
+/*!
+        \brief dense bin of a reduction by key, used is false until a
+               value is combined into the bin
+*/
+template <typename T>
+struct ReduceByKeyBin
+{
+  T value;
+  bool used;
+};
+
+/*!
+        \brief combine function of ReduceByKeyBin that only applies f to
+               used bins, so f needs no identity
+*/
+template <typename T, typename BinFn>
+struct ReduceByKeyBinFn
+{
+  BinFn f;
+
+  static ReduceByKeyBin<T> identity() { return ReduceByKeyBin<T>{T(), false}; }
+
+  ReduceByKeyBin<T> operator()(ReduceByKeyBin<T> const& lhs,
+                               ReduceByKeyBin<T> const& rhs) const
+  {
+    if (!lhs.used) {
+      return rhs;
+    } else if (!rhs.used) {
+      return lhs;
+    }
+    return ReduceByKeyBin<T>{f(lhs.value, rhs.value), true};
+  }
+};
+
+/*!
+        \brief sequential reduction by key of sorted keys and values,
+   returns the number of distinct keys
+*/
+template <typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+RAJA_INLINE
+RAJA::detail::IterDiff<KeyIter>
+reduce_sorted_by_key(
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    KeyOutIter keys_out,
+    ValOutIter vals_out,
+    BinFn f)
+{
+  using std::distance;
+  const auto n = distance(keys_begin, keys_end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  DistanceT count = 0;
+  for (DistanceT i = 0; i < n; ++i) {
+    if (i == 0 || !(keys_begin[i] == keys_begin[i - 1])) {
+      keys_out[count] = keys_begin[i];
+      vals_out[count] = vals_begin[i];
+      ++count;
+    } else {
+      vals_out[count - 1] = f(vals_out[count - 1], vals_begin[i]);
+    }
+  }
+  return count;
+}
+
+/*!
+        \brief reduce by key using a sort of the keys and values
+*/
+template <typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+RAJA_INLINE
+RAJA::detail::IterDiff<KeyIter>
+sequential_sorted_reduce_by_key(
+    resources::Host host_res,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    KeyOutIter keys_out,
+    ValOutIter vals_out,
+    BinFn f)
+{
+  using Key = RAJA::detail::IterVal<KeyIter>;
+  using Val = RAJA::detail::IterVal<ValIter>;
+  std::vector<Key> keys(keys_begin, keys_end);
+  std::vector<Val> vals(vals_begin, vals_begin + keys.size());
+
+  sort::stable_pairs(host_res, ::RAJA::seq_exec{},
+                     keys.data(), keys.data() + keys.size(), vals.data(),
+                     ::RAJA::operators::less<Key>{});
+
+  return reduce_sorted_by_key(keys.data(), keys.data() + keys.size(),
+                              vals.data(), keys_out, vals_out, f);
+}
+
+/*!
+        \brief reduce by key of integer keys, uses dense bins when the
+   range of the keys is small enough
+*/
+template <typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+RAJA_INLINE
+RAJA::detail::IterDiff<KeyIter>
+sequential_reduce_by_key(
+    resources::Host host_res,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    KeyOutIter keys_out,
+    ValOutIter vals_out,
+    BinFn f,
+    std::true_type)
+{
+  using std::distance;
+  using Key = RAJA::detail::IterVal<KeyIter>;
+  using Val = RAJA::detail::IterVal<ValIter>;
+  const auto n = distance(keys_begin, keys_end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  auto minmax = std::minmax_element(keys_begin, keys_end);
+  const Key kmin = *minmax.first;
+  const DistanceT num_bins = get_dense_key_bins(kmin, *minmax.second, n);
+  if (num_bins == 0) {
+    return sequential_sorted_reduce_by_key(host_res, keys_begin, keys_end,
+                                           vals_begin, keys_out, vals_out, f);
+  }
+
+  std::unique_ptr<Val[]> bins(new Val[num_bins]);
+  std::vector<char> used(num_bins, 0);
+  for (DistanceT i = 0; i < n; ++i) {
+    const DistanceT b = static_cast<DistanceT>(keys_begin[i] - kmin);
+    bins[b] = used[b] ? f(bins[b], vals_begin[i]) : Val(vals_begin[i]);
+    used[b] = 1;
+  }
+
+  DistanceT count = 0;
+  for (DistanceT b = 0; b < num_bins; ++b) {
+    if (used[b]) {
+      keys_out[count] = static_cast<Key>(kmin + b);
+      vals_out[count] = bins[b];
+      ++count;
+    }
+  }
+  return count;
+}
+///
+template <typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+RAJA_INLINE
+RAJA::detail::IterDiff<KeyIter>
+sequential_reduce_by_key(
+    resources::Host host_res,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    KeyOutIter keys_out,
+    ValOutIter vals_out,
+    BinFn f,
+    std::false_type)
+{
+  return sequential_sorted_reduce_by_key(host_res, keys_begin, keys_end,
+                                         vals_begin, keys_out, vals_out, f);
+}
+
+}  // namespace detail
+
+/*!
+        \brief combine value(i) into bins[key(i)] for each of the n items
+*/
+template <typename ExecPolicy,
+          typename DistanceT,
+          typename KeyFn,
+          typename ValFn,
+          typename BinIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+histogram(
+    resources::Host host_res,
+    const ExecPolicy &,
+    DistanceT n,
+    KeyFn key,
+    ValFn value,
+    BinIter bins,
+    RAJA::detail::IterDiff<BinIter>,
+    BinFn f)
+{
+  for (DistanceT i = 0; i < n; ++i) {
+    auto b = key(i);
+    bins[b] = f(bins[b], value(i));
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief reduce the values of equal keys, writes the distinct keys in
+   increasing order and their reduced values, returns the number of
+   distinct keys
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<RAJA::detail::IterDiff<KeyIter>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+reduce_by_key(
+    resources::Host host_res,
+    const ExecPolicy &,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    KeyOutIter keys_out,
+    ValOutIter vals_out,
+    BinFn f)
+{
+  using Key = RAJA::detail::IterVal<KeyIter>;
+  return detail::sequential_reduce_by_key(host_res, keys_begin, keys_end,
+                                          vals_begin, keys_out, vals_out, f,
+                                          detail::is_dense_key<Key>{});
+}
+
+}  // namespace histogram
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
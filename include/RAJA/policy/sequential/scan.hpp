@@ -156,6 +156,85 @@ exclusive(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief explicit segmented inclusive scan given input range, output,
+   segment head predicate, and function
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename HeadFn,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+inclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy &,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    HeadFn is_head,
+    BinFn f)
+{
+  using std::distance;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  using ValueT = typename std::remove_reference<decltype(*out)>::type;
+  ValueT agg = begin[0];
+  out[0] = agg;
+
+  for (DistanceT i = 1; i < n; ++i) {
+    agg = is_head(i) ? ValueT(begin[i]) : f(agg, begin[i]);
+    out[i] = agg;
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit segmented exclusive scan given input range, output,
+   segment head predicate, function, and initial value of each segment
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename HeadFn,
+          typename BinFn,
+          typename T>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+exclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy &,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    HeadFn is_head,
+    BinFn f,
+    T v)
+{
+  using std::distance;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  using ValueT = typename std::remove_reference<decltype(*out)>::type;
+  ValueT agg = v;
+
+  for (DistanceT i = 0; i < n; ++i) {
+    if (i > 0 && is_head(i)) {
+      agg = v;
+    }
+    ValueT t = begin[i];
+    out[i] = agg;
+    agg = f(agg, t);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace scan
 
 }  // namespace impl
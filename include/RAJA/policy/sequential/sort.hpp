@@ -72,6 +72,79 @@ struct StableSorter
   }
 };
 
+// this number is arbitrary
+constexpr int get_min_iterates_for_radix_sort() { return 128; }
+
+/*!
+        \brief radix sort given range if the keys and comparison function
+               allow it and the range is large enough, otherwise sort using
+               sorter
+*/
+template <typename Sorter, typename Iter, typename Compare>
+RAJA_INLINE
+concepts::enable_if<RAJA::detail::is_radix_sortable<Iter, Compare>>
+radix_or_sort(Sorter sorter,
+              Iter begin,
+              Iter end,
+              Compare comp)
+{
+  if (end - begin <= get_min_iterates_for_radix_sort()) {
+    sorter(begin, end, comp);
+  } else {
+    RAJA::detail::radix_sort(begin, end, comp);
+  }
+}
+///
+template <typename Sorter, typename Iter, typename Compare>
+RAJA_INLINE
+concepts::enable_if<concepts::negate<RAJA::detail::is_radix_sortable<Iter, Compare>>>
+radix_or_sort(Sorter sorter,
+              Iter begin,
+              Iter end,
+              Compare comp)
+{
+  sorter(begin, end, comp);
+}
+
+/*!
+        \brief radix sort given range of pairs if the keys and comparison
+               function allow it and the range is large enough, otherwise
+               sort using sorter
+*/
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+RAJA_INLINE
+concepts::enable_if<RAJA::detail::is_radix_sortable<KeyIter, Compare>>
+radix_or_sort_pairs(Sorter sorter,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    Compare comp)
+{
+  if (keys_end - keys_begin <= get_min_iterates_for_radix_sort()) {
+    auto begin = RAJA::zip(keys_begin, vals_begin);
+    auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    sorter(begin, end, RAJA::compare_first<zip_ref>(comp));
+  } else {
+    RAJA::detail::radix_sort_pairs(keys_begin, keys_end, vals_begin, comp);
+  }
+}
+///
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+RAJA_INLINE
+concepts::enable_if<concepts::negate<RAJA::detail::is_radix_sortable<KeyIter, Compare>>>
+radix_or_sort_pairs(Sorter sorter,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    Compare comp)
+{
+  auto begin = RAJA::zip(keys_begin, vals_begin);
+  auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  sorter(begin, end, RAJA::compare_first<zip_ref>(comp));
+}
+
 } // namespace detail
 
 /*!
@@ -87,7 +160,7 @@ unstable(
     Iter end,
     Compare comp)
 {
-  detail::UnstableSorter{}(begin, end, comp);
+  detail::radix_or_sort(detail::UnstableSorter{}, begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -105,7 +178,7 @@ stable(
     Iter end,
     Compare comp)
 {
-  detail::StableSorter{}(begin, end, comp);
+  detail::radix_or_sort(detail::StableSorter{}, begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -124,10 +197,7 @@ unstable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin = RAJA::zip(keys_begin, vals_begin);
-  auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::UnstableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::radix_or_sort_pairs(detail::UnstableSorter{}, keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -146,10 +216,7 @@ stable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin = RAJA::zip(keys_begin, vals_begin);
-  auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::StableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::radix_or_sort_pairs(detail::StableSorter{}, keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -21,6 +21,7 @@
 #define RAJA_simd_HPP
 
 #include "RAJA/policy/simd/forall.hpp"
+#include "RAJA/policy/simd/fused_forall.hpp"
 #include "RAJA/policy/simd/policy.hpp"
 #include "RAJA/policy/sequential/launch.hpp"
 #include "RAJA/policy/simd/kernel/For.hpp"
@@ -0,0 +1,89 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA fused forall template methods for
+ *          SIMD execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_fused_forall_simd_HPP
+#define RAJA_fused_forall_simd_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/simd/policy.hpp"
+
+#include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/detail/fused_forall.hpp"
+
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace simd
+{
+
+namespace detail
+{
+
+//! run loop_body for the iterations in [lo, hi) as a simd loop
+struct FusedSimdLoop {
+  template <typename DiffT, typename Func>
+  RAJA_INLINE void operator()(DiffT lo, DiffT hi, Func&& loop_body) const
+  {
+    RAJA_SIMD
+    for (DiffT i = lo; i < hi; ++i) {
+      loop_body(i);
+    }
+  }
+};
+
+}  // namespace detail
+
+/*!
+ * Each loop over a stage, or over one body of a stage for each tile, is a
+ * simd loop.
+ */
+template <typename FusePolicy, typename Iterable, typename... Items>
+RAJA_INLINE resources::EventProxy<resources::Host>
+fused_forall_impl(resources::Host host_res,
+                  const simd_exec&,
+                  FusePolicy fuse,
+                  Iterable&& iter,
+                  camp::tuple<Items...>& items)
+{
+  using item_seq = camp::make_idx_seq_t<sizeof...(Items)>;
+  ::RAJA::expt::detail::init_fused_params<seq_exec>(items, item_seq{});
+
+  RAJA_EXTRACT_BED_IT(iter);
+
+  ::RAJA::expt::detail::run_fused_stages(
+      fuse, detail::FusedSimdLoop{}, begin_it,
+      decltype(distance_it)(0), distance_it, items, [] {});
+
+  ::RAJA::expt::detail::resolve_fused_params<seq_exec>(items, item_seq{});
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace simd
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
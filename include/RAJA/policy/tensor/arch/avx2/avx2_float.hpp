@@ -215,6 +215,43 @@ namespace expt
       }
 
 
+      /*!
+       * @brief Generic gather operation for full vector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather(element_type const *ptr, int_vector_type offsets){
+        m_value = _mm256_i32gather_ps(ptr,
+                                      offsets.get_register(),
+                                      sizeof(element_type));
+        return *this;
+      }
+
+      /*!
+       * @brief Generic gather operation for n-length subvector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather_n(element_type const *ptr, int_vector_type offsets, camp::idx_t N){
+        m_value = _mm256_mask_i32gather_ps(_mm256_setzero_ps(),
+                                      ptr,
+                                      offsets.get_register(),
+                                      _mm256_castsi256_ps(createMask(N)),
+                                      sizeof(element_type));
+        return *this;
+      }
+
+
       /*!
        * @brief Store entire register to consecutive memory locations
        *
@@ -97,6 +97,16 @@ namespace expt
       explicit Register(register_type const &c) : base_type(), m_value(c) {}
 
 
+      /*!
+       * @brief Returns underlying SIMD register.
+       */
+      RAJA_INLINE
+      constexpr
+      register_type get_register() const {
+        return m_value;
+      }
+
+
       /*!
        * @brief Copy constructor
        */
@@ -227,6 +237,86 @@ namespace expt
         return *this;
       }
 
+
+      /*!
+       * @brief Generic gather operation for full vector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather(element_type const *ptr, int_vector_type offsets){
+				// AVX512F
+        m_value = _mm512_i64gather_pd(offsets.get_register(),
+                                      ptr,
+                                      sizeof(element_type));
+        return *this;
+      }
+
+      /*!
+       * @brief Generic gather operation for n-length subvector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather_n(element_type const *ptr, int_vector_type offsets, camp::idx_t N){
+				// AVX512F
+        m_value = _mm512_mask_i64gather_pd(_mm512_setzero_pd(),
+                                      createMask(N),
+                                      offsets.get_register(),
+                                      ptr,
+                                      sizeof(element_type));
+        return *this;
+      }
+
+      /*!
+       * @brief Generic scatter operation for full vector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be stored relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise. Lanes with the same
+       * offset are stored in lane order.
+       *
+       */
+      RAJA_INLINE
+      self_type const &scatter(element_type *ptr, int_vector_type const &offsets) const {
+				// AVX512F
+				_mm512_i64scatter_pd(ptr,
+				                     offsets.get_register(),
+				                     m_value,
+				                     sizeof(element_type));
+        return *this;
+      }
+
+      /*!
+       * @brief Generic scatter operation for n-length subvector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be stored relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise. Lanes with the same
+       * offset are stored in lane order.
+       *
+       */
+      RAJA_INLINE
+      self_type const &scatter_n(element_type *ptr, int_vector_type const &offsets, camp::idx_t N) const {
+				// AVX512F
+				_mm512_mask_i64scatter_pd(ptr,
+				                          createMask(N),
+				                          offsets.get_register(),
+				                          m_value,
+				                          sizeof(element_type));
+        return *this;
+      }
+
       /*!
        * @brief Get scalar value from vector register
        * @param i Offset of scalar to get
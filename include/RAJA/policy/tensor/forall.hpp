@@ -0,0 +1,180 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA index set and segment iteration
+ *          template methods for the simd_register_exec policy.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tensor_forall_HPP
+#define RAJA_policy_tensor_forall_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/params/forall.hpp"
+#include "RAJA/pattern/tensor/SimdIndex.hpp"
+
+#include "RAJA/policy/tensor/policy.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace tensor
+{
+namespace detail
+{
+
+/*!
+ * Load the n indices at it into a register, directly when the segment
+ * stores indices of the register's element type.
+ */
+template <typename INDEX_REGISTER>
+RAJA_INLINE INDEX_REGISTER
+simd_register_load_indices(typename INDEX_REGISTER::element_type const* it,
+                           camp::idx_t n,
+                           std::true_type)
+{
+  INDEX_REGISTER indices;
+  if (n == INDEX_REGISTER::s_num_elem) {
+    indices.load_packed(it);
+  } else {
+    indices.load_packed_n(it, n);
+  }
+  return indices;
+}
+
+template <typename INDEX_REGISTER, typename Iterator>
+RAJA_INLINE INDEX_REGISTER simd_register_load_indices(Iterator it,
+                                                      camp::idx_t n,
+                                                      std::false_type)
+{
+  using index_type = typename INDEX_REGISTER::element_type;
+
+  INDEX_REGISTER indices;
+  for (camp::idx_t lane = 0; lane < n; ++lane) {
+    indices.set(static_cast<index_type>(RAJA::stripIndexType(*(it + lane))),
+                lane);
+  }
+  return indices;
+}
+
+/*!
+ * Range segments are run in contiguous chunks.
+ */
+template <typename CHUNK, typename StorageT, typename DiffT, typename Func>
+RAJA_INLINE void simd_register_forall(
+    TypedRangeSegment<StorageT, DiffT> const& seg,
+    Func&& loop_body)
+{
+  using index_type = typename CHUNK::index_type;
+  constexpr camp::idx_t width = CHUNK::s_num_elem;
+
+  auto const begin = RAJA::stripIndexType(*seg.begin());
+  auto const distance = seg.size();
+
+  for (camp::decay<decltype(distance)> i = 0; i < distance; i += width) {
+    camp::idx_t const n =
+        distance - i < width ? static_cast<camp::idx_t>(distance - i) : width;
+    loop_body(CHUNK::range(static_cast<index_type>(begin + i), n));
+  }
+}
+
+/*!
+ * Other segments, such as list segments, are run in chunks of indices
+ * loaded into a register, that are accessed with gathers and scatters.
+ */
+template <typename CHUNK, typename Iterable, typename Func>
+RAJA_INLINE void simd_register_forall(Iterable const& seg, Func&& loop_body)
+{
+  using index_register_type = typename CHUNK::index_register_type;
+  using index_type = typename CHUNK::index_type;
+  constexpr camp::idx_t width = CHUNK::s_num_elem;
+
+  auto const begin = std::begin(seg);
+  auto const distance = std::distance(begin, std::end(seg));
+
+  using is_index_pointer = std::integral_constant<
+      bool,
+      std::is_pointer<camp::decay<decltype(begin)>>::value &&
+          std::is_same<camp::decay<decltype(*begin)>, index_type>::value>;
+
+  for (camp::decay<decltype(distance)> i = 0; i < distance; i += width) {
+    camp::idx_t const n =
+        distance - i < width ? static_cast<camp::idx_t>(distance - i) : width;
+    loop_body(CHUNK::list(simd_register_load_indices<index_register_type>(
+                              begin + i, n, is_index_pointer()),
+                          n));
+  }
+}
+
+}  // namespace detail
+
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  forall over a segment in chunks of register width, the loop body
+ *         takes a SimdIndex<ELEMENT_TYPE, REGISTER_POLICY> of each chunk.
+ *
+ * For example, with a TypedListSegment of zone indices:
+ *
+ *   RAJA::forall<RAJA::expt::simd_register_exec<double>>(zones,
+ *     [=](RAJA::expt::SimdIndex<double> z) {
+ *       auto v = z.load(x) * z.load(y);
+ *       z.store(y, v);
+ *     });
+ *
+ * Indices are converted to the register's integer type, which is 32 bits
+ * wide for 32 bit element types.
+ *
+ ******************************************************************************
+ */
+template <typename Iterable,
+          typename Func,
+          typename ForallParam,
+          typename ELEMENT_TYPE,
+          typename REGISTER_POLICY>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<resources::Host>,
+    expt::type_traits::is_ForallParamPack<ForallParam>,
+    expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(RAJA::resources::Host host_res,
+            const simd_register_exec<ELEMENT_TYPE, REGISTER_POLICY>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam)
+{
+  using chunk_type = RAJA::expt::SimdIndex<ELEMENT_TYPE, REGISTER_POLICY>;
+
+  detail::simd_register_forall<chunk_type>(iter,
+                                           std::forward<Func>(loop_body));
+
+  return RAJA::resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace tensor
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -50,6 +50,22 @@ struct tensor_exec : public EXEC_POLICY {
 };
 
 
+/*!
+ * Runs a forall body once per register width chunk of the segment, passing
+ * a RAJA::expt::SimdIndex<ELEMENT_TYPE, REGISTER_POLICY> of the chunk's
+ * indices. The width is that of a Register<ELEMENT_TYPE, REGISTER_POLICY>.
+ */
+template<typename ELEMENT_TYPE, typename REGISTER_POLICY>
+struct simd_register_exec
+    : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  using element_type = ELEMENT_TYPE;
+  using register_policy = REGISTER_POLICY;
+};
+
+
 
 }  // end of namespace tensor
 
@@ -67,6 +83,9 @@ using matrix_row_exec = policy::tensor::tensor_exec<seq_exec, TENSOR_TYPE, 0, TI
 template<typename TENSOR_TYPE, camp::idx_t TILE_SIZE = -1>
 using matrix_col_exec = policy::tensor::tensor_exec<seq_exec, TENSOR_TYPE, 1, TILE_SIZE>;
 
+template<typename ELEMENT_TYPE, typename REGISTER_POLICY = default_register>
+using simd_register_exec = policy::tensor::simd_register_exec<ELEMENT_TYPE, REGISTER_POLICY>;
+
 
 } //  namespace expt
 
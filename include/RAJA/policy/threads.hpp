@@ -0,0 +1,38 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA headers for the native thread pool
+ *          execution.
+ *
+ *          These methods work on all platforms that support std::thread and
+ *          do not need an OpenMP runtime.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_threads_HPP
+#define RAJA_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/policy/threads/thread_pool.hpp"
+#include "RAJA/policy/threads/forall.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/reduce.hpp"
+#include "RAJA/policy/threads/scan.hpp"
+#include "RAJA/policy/threads/launch.hpp"
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
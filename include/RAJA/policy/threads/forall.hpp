@@ -0,0 +1,139 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA segment iteration template methods
+ *          for the thread pool back-end.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_threads_HPP
+#define RAJA_forall_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/internal/fault_tolerance.hpp"
+
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/thread_pool.hpp"
+
+#include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/pattern/params/forall.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace threads
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// The following function templates iterate over segments on the workers
+// of the thread pool. Each worker runs one contiguous part of the
+// iterations with its own copy of the loop body.
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+template <typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+  >
+forall_impl(resources::Host host_res,
+            const threads_exec&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  using EXEC_POL = threads_exec;
+
+  expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+
+  RAJA_EXTRACT_BED_IT(iter);
+
+  // each worker combines into its own copy of the params, the copies are
+  // combined in worker order after the loop
+  std::vector<ForallParam> worker_params(
+      RAJA::detail::threads::get_max_threads(), f_params);
+
+  RAJA::detail::threads::threads_for(distance_it,
+      [&](std::ptrdiff_t i_begin, std::ptrdiff_t i_end) {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    ForallParam params = f_params;
+    for (std::ptrdiff_t i = i_begin; i < i_end; ++i) {
+      expt::invoke_body(params, body.get_priv(), *(begin_it + i));
+    }
+    worker_params[RAJA::detail::threads::get_worker_id()] = params;
+  });
+
+  for (ForallParam const& params : worker_params) {
+    expt::ParamMultiplexer::combine<EXEC_POL>(f_params, params);
+  }
+
+  expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  expt::type_traits::is_ForallParamPack_empty<ForallParam>
+  >
+forall_impl(resources::Host host_res,
+            const threads_exec&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+
+  RAJA::detail::threads::threads_for(distance_it,
+      [&](std::ptrdiff_t i_begin, std::ptrdiff_t i_end) {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    for (std::ptrdiff_t i = i_begin; i < i_end; ++i) {
+      body.get_priv()(*(begin_it + i));
+    }
+  });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace threads
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
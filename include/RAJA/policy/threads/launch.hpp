@@ -0,0 +1,299 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing user interface for RAJA::launch on
+ *          the thread pool back-end
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_threads_HPP
+#define RAJA_pattern_launch_threads_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/pattern/launch/launch_host_scratch.hpp"
+#include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/params/forall.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/thread_pool.hpp"
+
+namespace RAJA
+{
+
+template <>
+struct LaunchExecute<RAJA::threads_launch_t> {
+
+  template <typename BODY, typename ReduceParams>
+  static concepts::enable_if_t<resources::EventProxy<resources::Resource>,
+                               RAJA::expt::type_traits::is_ForallParamPack<ReduceParams>,
+                               RAJA::expt::type_traits::is_ForallParamPack_empty<ReduceParams>>
+  exec(RAJA::resources::Resource res, LaunchParams const &params, const char *, BODY const &body, ReduceParams &RAJA_UNUSED_ARG(launch_reducers))
+  {
+    RAJA::detail::threads::get_thread_pool().run([&](int, int) {
+
+        LaunchContext ctx;
+
+        using RAJA::internal::thread_privatize;
+        auto loop_body = thread_privatize(body);
+
+        detail::LaunchHostScratch scratch(params.shared_mem_size);
+        ctx.shared_mem_ptr = scratch.get();
+
+        loop_body.get_priv()(ctx);
+    });
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+  template<typename ReduceParams, typename BODY>
+    static concepts::enable_if_t<resources::EventProxy<resources::Resource>,
+                                 RAJA::expt::type_traits::is_ForallParamPack<ReduceParams>,
+                                 concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ReduceParams>>>
+  exec(RAJA::resources::Resource res, LaunchParams const &launch_params,
+       const char *RAJA_UNUSED_ARG(kernel_name),  BODY const &body, ReduceParams &f_params)
+  {
+
+    using EXEC_POL = RAJA::threads_launch_t;
+
+    expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+
+    // each worker combines into its own copy of the params, the copies are
+    // combined in worker order after the launch
+    std::vector<ReduceParams> worker_params(
+        RAJA::detail::threads::get_max_threads(), f_params);
+
+    RAJA::detail::threads::get_thread_pool().run([&](int, int) {
+
+      LaunchContext ctx;
+
+      using RAJA::internal::thread_privatize;
+      auto loop_body = thread_privatize(body);
+
+      detail::LaunchHostScratch scratch(launch_params.shared_mem_size);
+      ctx.shared_mem_ptr = scratch.get();
+
+      ReduceParams local_params = f_params;
+      expt::invoke_body(local_params, loop_body.get_priv(), ctx);
+      worker_params[RAJA::detail::threads::get_worker_id()] = local_params;
+    });
+
+    for (ReduceParams const& local_params : worker_params) {
+      expt::ParamMultiplexer::combine<EXEC_POL>(f_params, local_params);
+    }
+
+    expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+};
+
+
+template <typename SEGMENT>
+struct LoopExecute<threads_for_exec, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    RAJA::detail::threads::threads_team_for(len,
+        [&](std::ptrdiff_t i_begin, std::ptrdiff_t i_end) {
+      for (std::ptrdiff_t i = i_begin; i < i_end; i++) {
+        body(*(segment.begin() + i));
+      }
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    RAJA::detail::threads::threads_team_for(len1,
+        [&](std::ptrdiff_t j_begin, std::ptrdiff_t j_end) {
+      for (std::ptrdiff_t j = j_begin; j < j_end; j++) {
+        for (int i = 0; i < len0; i++) {
+
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j));
+        }
+      }
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    RAJA::detail::threads::threads_team_for(len2,
+        [&](std::ptrdiff_t k_begin, std::ptrdiff_t k_end) {
+      for (std::ptrdiff_t k = k_begin; k < k_end; k++) {
+        for (int j = 0; j < len1; j++) {
+          for (int i = 0; i < len0; i++) {
+            body(*(segment0.begin() + i),
+                 *(segment1.begin() + j),
+                 *(segment2.begin() + k));
+          }
+        }
+      }
+    });
+  }
+};
+
+//
+// Return local index
+//
+template <typename SEGMENT>
+struct LoopICountExecute<threads_for_exec, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    RAJA::detail::threads::threads_team_for(len,
+        [&](std::ptrdiff_t i_begin, std::ptrdiff_t i_end) {
+      for (std::ptrdiff_t i = i_begin; i < i_end; i++) {
+        body(*(segment.begin() + i), static_cast<int>(i));
+      }
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    RAJA::detail::threads::threads_team_for(len1,
+        [&](std::ptrdiff_t j_begin, std::ptrdiff_t j_end) {
+      for (std::ptrdiff_t j = j_begin; j < j_end; j++) {
+        for (int i = 0; i < len0; i++) {
+
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               i,
+               static_cast<int>(j));
+        }
+      }
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    RAJA::detail::threads::threads_team_for(len2,
+        [&](std::ptrdiff_t k_begin, std::ptrdiff_t k_end) {
+      for (std::ptrdiff_t k = k_begin; k < k_end; k++) {
+        for (int j = 0; j < len1; j++) {
+          for (int i = 0; i < len0; i++) {
+            body(*(segment0.begin() + i),
+                 *(segment1.begin() + j),
+                 *(segment2.begin() + k),
+                 i,
+                 j,
+                 static_cast<int>(k));
+          }
+        }
+      }
+    });
+  }
+};
+
+template <typename SEGMENT>
+struct TileExecute<threads_for_exec, SEGMENT> {
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len > 0) ? (len - 1) / tile_size + 1 : 0;
+
+    RAJA::detail::threads::threads_team_for(numTiles,
+        [&](std::ptrdiff_t t_begin, std::ptrdiff_t t_end) {
+      for (std::ptrdiff_t t = t_begin; t < t_end; t++) {
+        body(segment.slice(t * tile_size, tile_size));
+      }
+    });
+  }
+};
+
+template <typename SEGMENT>
+struct TileTCountExecute<threads_for_exec, SEGMENT> {
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len > 0) ? (len - 1) / tile_size + 1 : 0;
+
+    RAJA::detail::threads::threads_team_for(numTiles,
+        [&](std::ptrdiff_t t_begin, std::ptrdiff_t t_end) {
+      for (std::ptrdiff_t t = t_begin; t < t_end; t++) {
+        body(segment.slice(t * tile_size, tile_size), static_cast<int>(t));
+      }
+    });
+  }
+};
+
+}  // namespace RAJA
+#endif
@@ -0,0 +1,40 @@
+#ifndef THREADS_KERNELNAME_HPP
+#define THREADS_KERNELNAME_HPP
+
+#include "RAJA/pattern/params/kernel_name.hpp"
+
+namespace RAJA {
+namespace expt {
+namespace detail {
+
+#if defined(RAJA_ENABLE_THREADS)
+
+  // Init
+  template<typename EXEC_POL>
+  camp::concepts::enable_if< type_traits::is_threads_policy<EXEC_POL> >
+  init(KernelName&)
+  {
+    //TODO: Define kernel naming
+  }
+
+  // Combine
+  template<typename EXEC_POL, typename T>
+  camp::concepts::enable_if< type_traits::is_threads_policy<EXEC_POL> >
+  combine(KernelName&, T& /*place holder argument*/) {}
+
+  // Resolve
+  template<typename EXEC_POL>
+  camp::concepts::enable_if< type_traits::is_threads_policy<EXEC_POL> >
+  resolve(KernelName&)
+  {
+    //TODO: Define kernel naming
+  }
+
+#endif
+
+} //  namespace detail
+} //  namespace expt
+} //  namespace RAJA
+
+
+#endif //  THREADS_KERNELNAME_HPP
@@ -0,0 +1,96 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA thread pool policy definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_threads_HPP
+#define policy_threads_HPP
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace threads
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+///
+/// Segment execution policies
+///
+
+///
+/// Run the iterations of a loop on the workers of the persistent thread
+/// pool, each worker gets one contiguous part of the iterations
+///
+struct threads_exec : make_policy_pattern_launch_platform_t<Policy::threads,
+                                                            Pattern::forall,
+                                                            Launch::undefined,
+                                                            Platform::host> {
+};
+
+///
+/// Run the body of a launch on every worker of the thread pool
+///
+struct threads_launch_t
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::region,
+                                            Launch::sync,
+                                            Platform::host> {
+};
+
+///
+/// Split a loop inside a threads_launch_t launch among the workers, like
+/// 'omp for' this ends with a barrier
+///
+struct threads_for_exec
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+///
+///////////////////////////////////////////////////////////////////////
+///
+/// Reduction execution policies
+///
+///////////////////////////////////////////////////////////////////////
+///
+struct threads_reduce : make_policy_pattern_launch_platform_t<Policy::threads,
+                                                              Pattern::reduce,
+                                                              Launch::undefined,
+                                                              Platform::host> {
+};
+
+}  // end namespace threads
+}  // end namespace policy
+
+using policy::threads::threads_exec;
+using policy::threads::threads_launch_t;
+using policy::threads::threads_for_exec;
+using policy::threads::threads_reduce;
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,169 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA reduction templates for the thread
+ *          pool back-end.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_threads_reduce_HPP
+#define RAJA_threads_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <mutex>
+#include <new>
+
+#include "RAJA/util/types.hpp"
+#include "RAJA/util/reduce.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/reduce.hpp"
+
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/thread_pool.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! lock used by thread pool reducer copies destroyed outside of pool jobs
+inline std::mutex& get_threads_reduce_mutex()
+{
+  static std::mutex reduce_mutex;
+  return reduce_mutex;
+}
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Thread pool reducer combiner with one slot per pool worker.
+ *
+ * Copies made in a pool job combine into the slot of the worker that
+ * destroys them without synchronization. Each slot is padded to a multiple
+ * of RAJA::DATA_ALIGN bytes so workers do not share cache lines. The slots
+ * are combined in worker order when the value is requested. Copies
+ * destroyed outside of pool jobs combine into the parent under a lock.
+ *
+ **************************************************************************
+ */
+template <typename T, typename Reduce>
+class ReduceThreads
+    : public reduce::detail::BaseCombinable<T, Reduce, ReduceThreads<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceThreads>;
+
+public:
+  ReduceThreads() : ReduceThreads(T(), T()) { }
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceThreads(T init_val, T identity_)
+      : Base(init_val, identity_)
+  {
+    create_slots(identity_);
+  }
+
+  ReduceThreads(ReduceThreads const& other)
+      : Base(other)
+      , m_num_slots(other.m_num_slots)
+      , m_slots(other.m_slots)
+  { }
+
+  ReduceThreads& operator=(ReduceThreads const&) = delete;
+
+  ~ReduceThreads()
+  {
+    if (Base::parent) {
+      const int worker_id = ::RAJA::detail::threads::get_worker_id();
+      if (worker_id >= 0 && static_cast<size_t>(worker_id) < m_num_slots) {
+        Reduce{}(get_slot(worker_id), Base::my_data);
+      } else {
+        std::lock_guard<std::mutex> lock(get_threads_reduce_mutex());
+        Reduce{}(Base::parent->local(), Base::my_data);
+      }
+      Base::my_data = Base::identity;
+    } else {
+      destroy_slots();
+    }
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    for (size_t i = 0; i < m_num_slots; ++i) {
+      get_slot(i) = identity_;
+    }
+  }
+
+  T get_combined() const
+  {
+    T res = Base::my_data;
+    for (size_t i = 0; i < m_num_slots; ++i) {
+      Reduce{}(res, get_slot(i));
+    }
+    return res;
+  }
+
+private:
+  static constexpr size_t s_slot_bytes =
+      RAJA_DIVIDE_CEILING_INT(sizeof(T), RAJA::DATA_ALIGN) * RAJA::DATA_ALIGN;
+
+  size_t m_num_slots = 0;
+  char* m_slots = nullptr;
+
+  T& get_slot(size_t i) const
+  {
+    return *reinterpret_cast<T*>(m_slots + i * s_slot_bytes);
+  }
+
+  void create_slots(T const& identity_)
+  {
+    m_num_slots = ::RAJA::detail::threads::get_max_threads();
+    m_slots = RAJA::allocate_aligned_type<char>(RAJA::DATA_ALIGN,
+                                                m_num_slots * s_slot_bytes);
+    if (m_slots == nullptr) {
+      RAJA_ABORT_OR_THROW("ReduceThreads failed to allocate slots");
+    }
+    for (size_t i = 0; i < m_num_slots; ++i) {
+      new (m_slots + i * s_slot_bytes) T(identity_);
+    }
+  }
+
+  void destroy_slots()
+  {
+    if (m_slots != nullptr) {
+      for (size_t i = 0; i < m_num_slots; ++i) {
+        get_slot(i).~T();
+      }
+      RAJA::free_aligned(m_slots);
+      m_slots = nullptr;
+      m_num_slots = 0;
+    }
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(threads_reduce, detail::ReduceThreads)
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_THREADS guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,205 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scan declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scan_threads_HPP
+#define RAJA_scan_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/thread_pool.hpp"
+#include "RAJA/policy/sequential/scan.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace scan
+{
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+
+   Each worker scans its part of the range, the part totals are scanned by
+   worker 0, then each worker adds the total of the parts before it.
+*/
+template <typename Policy, typename Iter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_threads_policy<Policy>>
+inclusive_inplace(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  if (n <= 0) {
+    return resources::EventProxy<resources::Host>(host_res);
+  }
+  ::RAJA::detail::threads::ThreadPool& pool =
+      ::RAJA::detail::threads::get_thread_pool();
+  ::std::vector<Value> sums(pool.num_threads(), Value());
+  pool.run([&](int pid, int p) {
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+    if (idx_begin != idx_end) {
+      scan::inclusive_inplace(host_res, ::RAJA::seq_exec{},
+                        begin + idx_begin, begin + idx_end, f);
+      sums[pid] = begin[idx_end - 1];
+    } else {
+      sums[pid] = BinFn::identity();
+    }
+    pool.barrier();
+    if (pid == 0) {
+      scan::exclusive_inplace(host_res, ::RAJA::seq_exec{},
+                        sums.data(), sums.data() + p, f, BinFn::identity());
+    }
+    pool.barrier();
+    for (auto i = idx_begin; i < idx_end; ++i) {
+      begin[i] = f(begin[i], sums[pid]);
+    }
+  });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename BinFn, typename ValueT>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_threads_policy<Policy>>
+exclusive_inplace(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  if (n <= 0) {
+    return resources::EventProxy<resources::Host>(host_res);
+  }
+  ::RAJA::detail::threads::ThreadPool& pool =
+      ::RAJA::detail::threads::get_thread_pool();
+  ::std::vector<Value> sums(pool.num_threads(), v);
+  pool.run([&](int pid, int p) {
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+    const Value init = ((idx_begin == 0 || idx_begin == idx_end)
+                            ? Value(v)
+                            : *(begin + idx_begin - 1));
+    pool.barrier();
+    if (idx_begin != idx_end) {
+      scan::exclusive_inplace(host_res, ::RAJA::seq_exec{},
+                        begin + idx_begin, begin + idx_end, f, init);
+      sums[pid] = begin[idx_end - 1];
+    } else {
+      sums[pid] = BinFn::identity();
+    }
+    pool.barrier();
+    if (pid == 0) {
+      scan::exclusive_inplace(host_res, ::RAJA::seq_exec{},
+                        sums.data(), sums.data() + p, f, BinFn::identity());
+    }
+    pool.barrier();
+    for (auto i = idx_begin; i < idx_end; ++i) {
+      begin[i] = f(begin[i], sums[pid]);
+    }
+  });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_threads_policy<Policy>>
+inclusive(
+    resources::Host host_res,
+    const Policy& exec,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using std::distance;
+  ::std::copy(begin, end, out);
+  return inclusive_inplace(host_res, exec, out, out + distance(begin, end), f);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_threads_policy<Policy>>
+exclusive(
+    resources::Host host_res,
+    const Policy& exec,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  using std::distance;
+  ::std::copy(begin, end, out);
+  return exclusive_inplace(host_res, exec, out, out + distance(begin, end), f, v);
+}
+
+}  // namespace scan
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
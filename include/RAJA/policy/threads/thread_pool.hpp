@@ -0,0 +1,349 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the persistent thread pool used by the
+ *          thread pool execution policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_threads_thread_pool_HPP
+#define RAJA_threads_thread_pool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace detail
+{
+namespace threads
+{
+
+/*!
+ * \brief  Per thread state describing the pool job the thread is running.
+ *
+ * worker_id is the index of the worker in the pool, or -1 when the thread is
+ * not running a pool job. team_size is the number of threads sharing the
+ * current job, nested jobs run on a team of one thread.
+ */
+struct ThreadState {
+  int worker_id = -1;
+  int team_rank = 0;
+  int team_size = 1;
+};
+
+inline ThreadState& get_thread_state()
+{
+  static thread_local ThreadState state;
+  return state;
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Persistent pool of worker threads.
+ *
+ * The thread calling run takes part in the job as worker 0 and the pool
+ * threads are workers 1 to num_threads-1. A job is published by bumping a
+ * generation counter. Idle workers spin on the counter for a while so jobs
+ * issued back to back start in a few microseconds, then park on a condition
+ * variable so an idle pool does not burn cpu time.
+ *
+ * Jobs issued from inside a job run on the calling worker alone. Jobs issued
+ * concurrently from different threads outside the pool run one at a time.
+ *
+ ******************************************************************************
+ */
+class ThreadPool
+{
+public:
+  //! number of times an idle worker polls for a new job before parking
+  static constexpr int spin_count = 1 << 14;
+
+  //! number of polls between yields while spinning
+  static constexpr int yield_interval = 64;
+
+  explicit ThreadPool(int num_threads)
+      : m_num_threads((num_threads > 0) ? num_threads : 1)
+  {
+    m_workers.reserve(m_num_threads - 1);
+    for (int w = 1; w < m_num_threads; ++w) {
+      m_workers.emplace_back([this, w]() { worker_loop(w); });
+    }
+  }
+
+  ThreadPool(ThreadPool const&) = delete;
+  ThreadPool& operator=(ThreadPool const&) = delete;
+
+  ~ThreadPool()
+  {
+    m_stop.store(true, std::memory_order_relaxed);
+    publish();
+    for (std::thread& worker : m_workers) {
+      worker.join();
+    }
+  }
+
+  //! number of workers in the pool, including the calling thread
+  int num_threads() const { return m_num_threads; }
+
+  /*!
+   * \brief  Run func(team_rank, team_size) on every worker and wait for all
+   *         of them to finish.
+   */
+  template <typename Func>
+  void run(Func&& func)
+  {
+    ThreadState& state = get_thread_state();
+
+    if (state.worker_id >= 0) {
+      // nested job, run on this worker alone
+      const ThreadState outer = state;
+      state.team_rank = 0;
+      state.team_size = 1;
+      func(0, 1);
+      state = outer;
+      return;
+    }
+
+    std::lock_guard<std::mutex> run_lock(m_run_mutex);
+
+    if (m_num_threads == 1) {
+      state.worker_id = 0;
+      func(0, 1);
+      state = ThreadState{};
+      return;
+    }
+
+    using func_type = typename std::remove_reference<Func>::type;
+
+    m_job_data = const_cast<void*>(static_cast<const void*>(&func));
+    m_job_invoke = [](void* data, int rank, int size) {
+      (*static_cast<func_type*>(data))(rank, size);
+    };
+    m_pending.store(m_num_threads - 1, std::memory_order_relaxed);
+    publish();
+
+    state.worker_id = 0;
+    state.team_rank = 0;
+    state.team_size = m_num_threads;
+    func(0, m_num_threads);
+    state = ThreadState{};
+
+    int polls = 0;
+    while (m_pending.load(std::memory_order_acquire) != 0) {
+      if (++polls == yield_interval) {
+        polls = 0;
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  /*!
+   * \brief  Wait for every thread of the current job, call from all of them.
+   */
+  void barrier()
+  {
+    const ThreadState& state = get_thread_state();
+    if (state.team_size <= 1) {
+      return;
+    }
+
+    const unsigned gen = m_barrier_gen.load(std::memory_order_acquire);
+    if (m_barrier_count.fetch_add(1, std::memory_order_acq_rel) ==
+        state.team_size - 1) {
+      m_barrier_count.store(0, std::memory_order_relaxed);
+      m_barrier_gen.fetch_add(1, std::memory_order_release);
+    } else {
+      int polls = 0;
+      while (m_barrier_gen.load(std::memory_order_acquire) == gen) {
+        if (++polls == yield_interval) {
+          polls = 0;
+          std::this_thread::yield();
+        }
+      }
+    }
+  }
+
+private:
+  int m_num_threads;
+  std::vector<std::thread> m_workers;
+
+  std::mutex m_run_mutex;
+  void* m_job_data = nullptr;
+  void (*m_job_invoke)(void*, int, int) = nullptr;
+
+  std::atomic<unsigned> m_generation{0};
+  std::atomic<int> m_pending{0};
+  std::atomic<bool> m_stop{false};
+
+  std::mutex m_park_mutex;
+  std::condition_variable m_park_cv;
+  std::atomic<int> m_num_parked{0};
+
+  std::atomic<int> m_barrier_count{0};
+  std::atomic<unsigned> m_barrier_gen{0};
+
+  //! wake the workers for the job or stop request that was just written
+  void publish()
+  {
+    m_generation.fetch_add(1, std::memory_order_seq_cst);
+    if (m_num_parked.load(std::memory_order_seq_cst) > 0) {
+      std::lock_guard<std::mutex> park_lock(m_park_mutex);
+      m_park_cv.notify_all();
+    }
+  }
+
+  void worker_loop(int worker_id)
+  {
+    ThreadState& state = get_thread_state();
+    unsigned seen = 0;
+
+    for (;;) {
+
+      unsigned gen;
+      int polls = 0;
+      while ((gen = m_generation.load(std::memory_order_acquire)) == seen) {
+        if (++polls < spin_count) {
+          if (polls % yield_interval == 0) {
+            std::this_thread::yield();
+          }
+        } else {
+          std::unique_lock<std::mutex> park_lock(m_park_mutex);
+          m_num_parked.fetch_add(1, std::memory_order_seq_cst);
+          m_park_cv.wait(park_lock, [&]() {
+            return m_generation.load(std::memory_order_seq_cst) != seen;
+          });
+          m_num_parked.fetch_sub(1, std::memory_order_relaxed);
+          polls = 0;
+        }
+      }
+      seen = gen;
+
+      if (m_stop.load(std::memory_order_relaxed)) {
+        return;
+      }
+
+      state.worker_id = worker_id;
+      state.team_rank = worker_id;
+      state.team_size = m_num_threads;
+      m_job_invoke(m_job_data, worker_id, m_num_threads);
+      state = ThreadState{};
+
+      m_pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+  }
+};
+
+/*!
+ * \brief  Number of workers for the default pool, taken from the
+ *         RAJA_NUM_THREADS environment variable when it is set and from the
+ *         hardware concurrency otherwise.
+ */
+inline int get_default_num_threads()
+{
+  const char* env = std::getenv("RAJA_NUM_THREADS");
+  if (env != nullptr) {
+    const int num_threads = std::atoi(env);
+    if (num_threads > 0) {
+      return num_threads;
+    }
+  }
+  const unsigned hw = std::thread::hardware_concurrency();
+  return (hw > 0) ? static_cast<int>(hw) : 1;
+}
+
+//! the pool used by the thread pool policies, started on first use
+inline ThreadPool& get_thread_pool()
+{
+  static ThreadPool pool(get_default_num_threads());
+  return pool;
+}
+
+//! maximum number of workers that may run a job
+inline int get_max_threads() { return get_thread_pool().num_threads(); }
+
+//! index of the calling worker in the pool, -1 outside of a pool job
+inline int get_worker_id() { return get_thread_state().worker_id; }
+
+//! contiguous part [begin, end) of [0, len) given to rank out of size threads
+inline void get_team_range(std::ptrdiff_t len,
+                           std::ptrdiff_t rank,
+                           std::ptrdiff_t size,
+                           std::ptrdiff_t& begin,
+                           std::ptrdiff_t& end)
+{
+  const std::ptrdiff_t per_thread = len / size;
+  const std::ptrdiff_t extra = len % size;
+  begin = rank * per_thread + ((rank < extra) ? rank : extra);
+  end = begin + per_thread + ((rank < extra) ? 1 : 0);
+}
+
+/*!
+ * \brief  Run func(begin, end) on every worker of the pool, splitting
+ *         [0, len) into one contiguous range per worker.
+ */
+template <typename Func>
+RAJA_INLINE void threads_for(std::ptrdiff_t len, Func&& func)
+{
+  if (len <= 0) {
+    return;
+  }
+  get_thread_pool().run([&](int rank, int size) {
+    std::ptrdiff_t begin, end;
+    get_team_range(len, rank, size, begin, end);
+    if (begin < end) {
+      func(begin, end);
+    }
+  });
+}
+
+/*!
+ * \brief  Run func(begin, end) on one contiguous range of [0, len) per
+ *         thread of the current job.
+ *
+ * Must be called by every thread of the current job, like an 'omp for'
+ * construct. Ends with a barrier.
+ */
+template <typename Func>
+RAJA_INLINE void threads_team_for(std::ptrdiff_t len, Func&& func)
+{
+  const ThreadState& state = get_thread_state();
+  std::ptrdiff_t begin, end;
+  get_team_range(len, state.team_rank, state.team_size, begin, end);
+  if (begin < end) {
+    func(begin, end);
+  }
+  get_thread_pool().barrier();
+}
+
+}  // namespace threads
+}  // namespace detail
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,199 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining FastDivisor, an integer divisor that
+ *          divides with a multiply and shifts.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_FastDivisor_HPP
+#define RAJA_util_FastDivisor_HPP
+
+#include "RAJA/config.hpp"
+
+#include <climits>
+#include <cstdint>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * High half of the product of two unsigned integers of 32 bits or less.
+ */
+template <typename U>
+RAJA_HOST_DEVICE RAJA_INLINE constexpr
+std::enable_if_t<(sizeof(U) <= sizeof(uint32_t)), U>
+mul_hi(U a, U b)
+{
+  return static_cast<U>((static_cast<uint64_t>(a) * static_cast<uint64_t>(b))
+                        >> (CHAR_BIT * sizeof(U)));
+}
+
+/*!
+ * High half of the product of two unsigned 64 bit integers.
+ */
+template <typename U>
+RAJA_HOST_DEVICE RAJA_INLINE
+std::enable_if_t<(sizeof(U) == sizeof(uint64_t)), U>
+mul_hi(U a, U b)
+{
+#if (defined(RAJA_ENABLE_CUDA) && defined(__CUDA_ARCH__)) \
+  || (defined(RAJA_ENABLE_HIP) && defined(__HIP_DEVICE_COMPILE__))
+  return static_cast<U>(__umul64hi(static_cast<unsigned long long>(a),
+                                   static_cast<unsigned long long>(b)));
+#elif defined(__SIZEOF_INT128__) && !defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+  return static_cast<U>((static_cast<unsigned __int128>(a) *
+                         static_cast<unsigned __int128>(b)) >> 64);
+#else
+  const uint64_t a_lo = a & 0xffffffffu;
+  const uint64_t a_hi = a >> 32;
+  const uint64_t b_lo = b & 0xffffffffu;
+  const uint64_t b_hi = b >> 32;
+  const uint64_t lo_lo = a_lo * b_lo;
+  const uint64_t hi_lo = a_hi * b_lo;
+  const uint64_t lo_hi = a_lo * b_hi;
+  const uint64_t hi_hi = a_hi * b_hi;
+  const uint64_t mid = (lo_lo >> 32) + (hi_lo & 0xffffffffu) + lo_hi;
+  return static_cast<U>(hi_hi + (hi_lo >> 32) + (mid >> 32));
+#endif
+}
+
+}  // namespace detail
+
+/*!
+ * @brief An integer divisor that replaces division by a run time value with
+ * a multiply high, an add, and shifts.
+ *
+ * The multiplier and shifts are computed once at construction with the
+ * round down method of Granlund and Montgomery, so quotients are exact for
+ * every value of T. Signed values are divided by their magnitude, and the
+ * results round toward zero like the built in operators.
+ *
+ * For example:
+ *
+ *     RAJA::FastDivisor<int> d(7);
+ *
+ *     int q = 100 / d;   // q = 14
+ *     int r = 100 % d;   // r = 2
+ *
+ * The divisor must be positive, a default constructed FastDivisor divides
+ * by 1.
+ */
+template <typename T>
+struct FastDivisor {
+  static_assert(std::is_integral<T>::value,
+                "FastDivisor requires an integral type");
+
+  using value_type = T;
+  using unsigned_type = std::make_unsigned_t<T>;
+
+  static constexpr int bits = CHAR_BIT * sizeof(T);
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr FastDivisor() = default;
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr FastDivisor(T divisor)
+      : m_divisor(divisor)
+  {
+    const unsigned_type d = static_cast<unsigned_type>(divisor);
+
+    // l is the smallest power with 2^l >= d
+    int l = 0;
+    while (l < bits && (unsigned_type(1) << l) < d) {
+      ++l;
+    }
+
+    // multiplier is floor(2^bits * (2^l - d) / d) + 1, found by long
+    // division as 2^l - d < d
+    unsigned_type rem = static_cast<unsigned_type>(
+        (l < bits ? (unsigned_type(1) << l) : unsigned_type(0)) - d);
+    unsigned_type quot = 0;
+    for (int i = 0; i < bits; ++i) {
+      const bool carry = (rem >> (bits - 1)) != 0;
+      rem = static_cast<unsigned_type>(rem << 1);
+      quot = static_cast<unsigned_type>(quot << 1);
+      if (carry || rem >= d) {
+        rem = static_cast<unsigned_type>(rem - d);
+        quot = static_cast<unsigned_type>(quot | 1);
+      }
+    }
+
+    m_multiplier = static_cast<unsigned_type>(quot + 1);
+    m_shift1 = l > 0 ? 1 : 0;
+    m_shift2 = l > 0 ? l - 1 : 0;
+  }
+
+  //! divisor that this object divides by
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr T divisor() const { return m_divisor; }
+
+  //! quotient of n and the divisor, rounded toward zero
+  RAJA_HOST_DEVICE RAJA_INLINE T divide(T n) const
+  {
+    return divide_impl(n, std::is_signed<T>{});
+  }
+
+  //! remainder of n and the divisor, with the sign of n
+  RAJA_HOST_DEVICE RAJA_INLINE T modulo(T n) const
+  {
+    return static_cast<T>(n - divide(n) * m_divisor);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE friend T operator/(T n, FastDivisor const& d)
+  {
+    return d.divide(n);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE friend T operator%(T n, FastDivisor const& d)
+  {
+    return d.modulo(n);
+  }
+
+private:
+  RAJA_HOST_DEVICE RAJA_INLINE unsigned_type divide_unsigned(
+      unsigned_type n) const
+  {
+    const unsigned_type t = detail::mul_hi(m_multiplier, n);
+    return static_cast<unsigned_type>(
+        (t + static_cast<unsigned_type>((n - t) >> m_shift1)) >> m_shift2);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE T divide_impl(T n, std::false_type) const
+  {
+    return divide_unsigned(n);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE T divide_impl(T n, std::true_type) const
+  {
+    const unsigned_type q = n < 0
+        ? static_cast<unsigned_type>(
+              unsigned_type(0) -
+              divide_unsigned(static_cast<unsigned_type>(
+                  unsigned_type(0) - static_cast<unsigned_type>(n))))
+        : divide_unsigned(static_cast<unsigned_type>(n));
+    return static_cast<T>(q);
+  }
+
+  T m_divisor = 1;
+  unsigned_type m_multiplier = 1;
+  int m_shift1 = 0;
+  int m_shift2 = 0;
+};
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,161 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining host allocation that places memory on
+ *          the NUMA domains of the threads of an execution policy.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_FirstTouchAllocator_HPP
+#define RAJA_util_FirstTouchAllocator_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+//! alignment of first touch allocations, so no page is shared with
+//! other allocations
+constexpr size_t first_touch_alignment = 4096;
+
+namespace detail
+{
+
+/*!
+ * Loop body that zeroes the storage of each element, so the thread that
+ * runs the iteration maps the pages of the element.
+ */
+template <typename T>
+struct FirstTouchBody {
+  T* ptr;
+
+  RAJA_INLINE void operator()(size_t i) const
+  {
+    std::memset(static_cast<void*>(ptr + i), 0, sizeof(T));
+  }
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Allocate aligned host storage for n objects of type T and zero it
+ *        in a forall loop over [0, n) with ExecPolicy.
+ *
+ * Operating systems that place pages on first touch, like Linux by default,
+ * put each page of the storage in the NUMA domain of the thread that ran
+ * the loop iteration that first wrote it. Later loops over [0, n) with the
+ * same policy, and the same number of threads, then use memory local to
+ * each thread. omp_parallel_for_fixed_static_exec runs each iteration on
+ * the same thread in every loop of the same length, so it is the policy to
+ * use for both the allocation and the loops. Threads should also be bound
+ * to cores, for example with OMP_PROC_BIND=close or spread.
+ *
+ * The objects are not constructed. Free the storage with free_aligned.
+ */
+template <typename T, typename ExecPolicy>
+RAJA_INLINE T* allocate_first_touch(size_t n)
+{
+  const size_t alignment = (alignof(T) > first_touch_alignment)
+                               ? alignof(T)
+                               : first_touch_alignment;
+  // aligned_alloc requires a nonzero multiple of the alignment
+  size_t nbytes = ((n * sizeof(T) + alignment - 1) / alignment) * alignment;
+  if (nbytes == 0) {
+    nbytes = alignment;
+  }
+
+  T* ptr = allocate_aligned_type<T>(alignment, nbytes);
+  if (ptr != nullptr && n > 0) {
+    forall<ExecPolicy>(TypedRangeSegment<size_t>(0, n),
+                       detail::FirstTouchBody<T>{ptr});
+  }
+  return ptr;
+}
+
+/*!
+ * \brief Allocator that places storage with allocate_first_touch, for use
+ *        with std::vector, RAJA::RAJAVec, and other containers.
+ *
+ * For example:
+ *
+ *     using alloc = RAJA::FirstTouchAllocator<double,
+ *         RAJA::omp_parallel_for_fixed_static_exec>;
+ *
+ *     std::vector<double, alloc> a(N);
+ *     double* a_ptr = a.data();
+ *
+ *     // each thread uses the part of a in its NUMA domain
+ *     RAJA::forall<RAJA::omp_parallel_for_fixed_static_exec>(
+ *         RAJA::TypedRangeSegment<size_t>(0, N), [=](size_t i) {
+ *       a_ptr[i] = ...;
+ *     });
+ *
+ * The storage is touched when it is allocated, before the container
+ * constructs the objects on the calling thread, so the placement follows
+ * the allocation length, the capacity of the container.
+ */
+template <typename T, typename ExecPolicy>
+struct FirstTouchAllocator {
+  using value_type = T;
+
+  template <typename U>
+  struct rebind {
+    using other = FirstTouchAllocator<U, ExecPolicy>;
+  };
+
+  FirstTouchAllocator() = default;
+
+  template <typename U>
+  FirstTouchAllocator(FirstTouchAllocator<U, ExecPolicy> const&)
+  {
+  }
+
+  T* allocate(size_t n)
+  {
+    T* ptr = allocate_first_touch<T, ExecPolicy>(n);
+    if (ptr == nullptr) {
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+
+  void deallocate(T* ptr, size_t) { free_aligned(ptr); }
+
+  template <typename U>
+  bool operator==(FirstTouchAllocator<U, ExecPolicy> const&) const
+  {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(FirstTouchAllocator<U, ExecPolicy> const&) const
+  {
+    return false;
+  }
+};
+
+}  // namespace RAJA
+
+#endif
@@ -28,6 +28,7 @@
 
 #include "RAJA/internal/foldl.hpp"
 
+#include "RAJA/util/FastDivisor.hpp"
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/Permutations.hpp"
 
@@ -80,8 +81,9 @@ public:
 
   IdxLin sizes[n_dims] = {0};
   IdxLin strides[n_dims] = {0};
-  IdxLin inv_strides[n_dims] = {0};
-  IdxLin inv_mods[n_dims] = {0};
+  // divisors for toIndices, built once from the strides and sizes
+  FastDivisor<IdxLin> inv_strides[n_dims];
+  FastDivisor<IdxLin> inv_mods[n_dims];
 
 
   /*!
@@ -120,8 +122,8 @@ public:
           &rhs)
       : sizes{static_cast<IdxLin>(rhs.sizes[RangeInts])...},
         strides{static_cast<IdxLin>(rhs.strides[RangeInts])...},
-        inv_strides{static_cast<IdxLin>(rhs.inv_strides[RangeInts])...},
-        inv_mods{static_cast<IdxLin>(rhs.inv_mods[RangeInts])...}
+        inv_strides{(strides[RangeInts] ? strides[RangeInts] : IdxLin(1))...},
+        inv_mods{(sizes[RangeInts] ? sizes[RangeInts] : IdxLin(1))...}
   {
   }
 
@@ -197,7 +199,9 @@ public:
    * Given a linear-space index, compute the n-dimensional indices defined
    * by this layout.
    *
-   * Note that this operation requires 2n integer divide instructions
+   * The 2n integer divisions use the divisors built at construction, so
+   * each is a multiply high, an add and shifts instead of a divide
+   * instruction.
    *
    * @param linear_index  Linear space index to be converted to indices.
    * @param indices  Variadic list of indices to be assigned, number must match
@@ -367,8 +371,6 @@ struct TypedLayout<IdxLin, camp::tuple<DimTypes...>, StrideOne>
    * Given a linear-space index, compute the n-dimensional indices defined
    * by this layout.
    *
-   * Note that this operation requires 2n integer divide instructions
-   *
    * @param linear_index  Linear space index to be converted to indices.
    * @param indices  Variadic list of indices to be assigned, number must match
    *                 dimensionality of this layout.
@@ -0,0 +1,322 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining MortonLayout, a N-dimensional index
+ *          calculator that orders the index space along a Z-order curve
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_MORTON_LAYOUT_HPP
+#define RAJA_MORTON_LAYOUT_HPP
+
+#include "RAJA/config.hpp"
+
+#include <climits>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__BMI2__) && !defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+#include <immintrin.h>
+#endif
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Scatter the low bits of x to the set bits of mask, lowest first.
+ */
+template <typename U>
+RAJA_HOST_DEVICE RAJA_INLINE U bit_deposit(U x, U mask)
+{
+  U res = 0;
+  for (U bb = 1; mask != 0; bb = static_cast<U>(bb + bb)) {
+    if (x & bb) {
+      res |= static_cast<U>(mask & (U(0) - mask));
+    }
+    mask &= static_cast<U>(mask - 1);
+  }
+  return res;
+}
+
+/*!
+ * Gather the bits of x at the set bits of mask into the low bits.
+ */
+template <typename U>
+RAJA_HOST_DEVICE RAJA_INLINE U bit_extract(U x, U mask)
+{
+  U res = 0;
+  for (U bb = 1; mask != 0; bb = static_cast<U>(bb + bb)) {
+    if (x & mask & (U(0) - mask)) {
+      res |= bb;
+    }
+    mask &= static_cast<U>(mask - 1);
+  }
+  return res;
+}
+
+#if defined(__BMI2__) && !defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+// single instruction versions with BMI2
+RAJA_HOST_DEVICE RAJA_INLINE unsigned int bit_deposit(unsigned int x,
+                                                      unsigned int mask)
+{
+  return _pdep_u32(x, mask);
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE unsigned int bit_extract(unsigned int x,
+                                                      unsigned int mask)
+{
+  return _pext_u32(x, mask);
+}
+
+#if defined(__x86_64__)
+RAJA_HOST_DEVICE RAJA_INLINE unsigned long long bit_deposit(
+    unsigned long long x,
+    unsigned long long mask)
+{
+  return _pdep_u64(x, mask);
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE unsigned long long bit_extract(
+    unsigned long long x,
+    unsigned long long mask)
+{
+  return _pext_u64(x, mask);
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE unsigned long bit_deposit(unsigned long x,
+                                                       unsigned long mask)
+{
+  return _pdep_u64(x, mask);
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE unsigned long bit_extract(unsigned long x,
+                                                       unsigned long mask)
+{
+  return _pext_u64(x, mask);
+}
+#endif
+#endif
+
+/*!
+ * Number of bits needed to hold indices in [0, size).
+ */
+template <typename U>
+RAJA_HOST_DEVICE RAJA_INLINE constexpr U morton_bits(U size)
+{
+  U b = 0;
+  while (b < U(CHAR_BIT * sizeof(U)) && (U(1) << b) < size) {
+    ++b;
+  }
+  return b;
+}
+
+/*!
+ * Bits of the linear index that hold the bits of the indices in dimension
+ * dim. Bits are handed out one per dimension in turn starting with the
+ * last dimension, dimensions that need no more bits are skipped.
+ */
+template <typename U, size_t n_dims>
+RAJA_HOST_DEVICE RAJA_INLINE constexpr U morton_mask(U const (&bits)[n_dims],
+                                                     size_t dim)
+{
+  U mask = 0;
+  U used[n_dims] = {0};
+  U bit = 0;
+  bool any = true;
+  while (any) {
+    any = false;
+    for (size_t d = n_dims; d-- > 0;) {
+      if (used[d] < bits[d]) {
+        if (d == dim) {
+          mask |= U(1) << bit;
+        }
+        ++used[d];
+        ++bit;
+        any = true;
+      }
+    }
+  }
+  return mask;
+}
+
+template <typename Range, typename IdxLin = Index_type>
+struct MortonLayout_impl;
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+struct MortonLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> {
+public:
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::make_idx_seq_t<sizeof...(RangeInts)>;
+  using mask_type = std::make_unsigned_t<IdxLin>;
+
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+  static constexpr ptrdiff_t stride_one_dim = -1;
+
+  IdxLin sizes[n_dims] = {0};
+  mask_type bits[n_dims] = {0};
+  // bits of the linear index used by each dimension
+  mask_type masks[n_dims] = {0};
+
+
+  /*!
+   * Default constructor with zero sizes.
+   */
+  constexpr RAJA_INLINE MortonLayout_impl() = default;
+  constexpr RAJA_INLINE MortonLayout_impl(MortonLayout_impl const &) = default;
+  constexpr RAJA_INLINE MortonLayout_impl(MortonLayout_impl &&) = default;
+  RAJA_INLINE MortonLayout_impl &operator=(MortonLayout_impl const &) = default;
+  RAJA_INLINE MortonLayout_impl &operator=(MortonLayout_impl &&) = default;
+
+  /*!
+   * Construct a layout given the size of each dimension.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr MortonLayout_impl(Types... ns)
+      : sizes{static_cast<IdxLin>(stripIndexType(ns))...},
+        bits{detail::morton_bits(static_cast<mask_type>(sizes[RangeInts]))...},
+        masks{detail::morton_mask(bits, RangeInts)...}
+  {
+    static_assert(n_dims == sizeof...(Types),
+                  "number of dimensions must match");
+  }
+
+  /*!
+   * Computes a linear space index from specified indices.
+   * This interleaves the bits of the indices.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE IdxLin operator()(Indices... indices) const
+  {
+    return static_cast<IdxLin>(foldl(
+        RAJA::operators::bit_or<mask_type>(),
+        mask_type(0),
+        detail::bit_deposit(
+            static_cast<mask_type>(stripIndexType(indices)),
+            masks[RangeInts])...));
+  }
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+    camp::sink((indices = (camp::decay<Indices>)(detail::bit_extract(
+                    static_cast<mask_type>(linear_index),
+                    masks[RangeInts])))...);
+  }
+
+  /*!
+   * Computes the size of the layout's storage, which is the next power of
+   * 2 of each dimension's size multiplied together.
+   *
+   * @return Number of entries in the storage of this layout
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return static_cast<IdxLin>(
+        mask_type(1) << foldl(RAJA::operators::plus<mask_type>(),
+                              mask_type(0),
+                              bits[RangeInts]...));
+  }
+
+  /*!
+   * Computes a total size of the layout's space.
+   * This is the produce of each dimensions size.
+   *
+   * @return Total size spanned by indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size_noproj() const
+  {
+    return foldl(RAJA::operators::multiplies<IdxLin>(), sizes[RangeInts]...);
+  }
+
+  template<camp::idx_t DIM>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr
+  IndexLinear get_dim_size() const {
+    return sizes[DIM];
+  }
+
+  template<camp::idx_t DIM>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr
+  IndexLinear get_dim_begin() const {
+    return 0;
+  }
+};
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+constexpr size_t MortonLayout_impl<camp::idx_seq<RangeInts...>, IdxLin>::n_dims;
+
+}  // namespace detail
+
+/*!
+ * @brief A mapping of n-dimensional index space to a linear index space
+ * that orders the index space along a Morton, or Z-order, curve.
+ *
+ * The linear index interleaves the bits of the indices, one bit from each
+ * dimension in turn starting with the last dimension. Points that are
+ * close in every dimension are close in memory at every scale, without
+ * choosing a tile size for a particular cache. Each dimension is padded to
+ * a power of 2, so storage for a View with this layout must hold size()
+ * entries. The bits are interleaved with the BMI2 pdep and pext
+ * instructions when the host compiler targets them, and with a loop over
+ * the bits otherwise.
+ *
+ * For example:
+ *
+ *     // Create a 4 x 4 layout
+ *     MortonLayout<2> layout(4, 4);
+ *
+ *     // Map from 2d index space to linear
+ *     int lin = layout(1, 2);    // lin = 0b0110 = 6
+ *
+ *     // Map from linear space to 2d indices
+ *     int i, j;
+ *     layout.toIndices(lin, i, j);  // i,j = {1, 2}
+ *
+ * Data may be copied between views with Morton and strided layouts with
+ * RAJA::copy_view.
+ */
+template <size_t n_dims, typename IdxLin = Index_type>
+using MortonLayout =
+    detail::MortonLayout_impl<camp::make_idx_seq_t<n_dims>, IdxLin>;
+
+}  // namespace RAJA
+
+#endif
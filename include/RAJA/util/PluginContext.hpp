@@ -10,6 +10,7 @@
 
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/internal/get_platform.hpp"
+#include "RAJA/util/types.hpp"
 
 namespace RAJA {
 namespace util {
@@ -18,11 +19,19 @@ class KokkosPluginLoader;
 
 struct PluginContext {
   public:
-    PluginContext(const Platform p) :
-      platform(p) {}
+    PluginContext(const Platform p,
+                  const char* name = nullptr,
+                  Index_type len = -1) :
+      platform(p), kernel_name(name), length(len) {}
 
     Platform platform;
 
+    //! name given with RAJA::expt::KernelName, nullptr when not named
+    const char* kernel_name;
+
+    //! number of iterations in the kernel's iteration space, -1 if unknown
+    Index_type length;
+
   private:
     mutable uint64_t kID;
 
@@ -30,9 +39,10 @@ struct PluginContext {
 };
 
 template<typename Policy>
-PluginContext make_context()
+PluginContext make_context(const char* kernel_name = nullptr,
+                           Index_type length = -1)
 {
-  return PluginContext{detail::get_platform<Policy>::value};
+  return PluginContext{detail::get_platform<Policy>::value, kernel_name, length};
 }
 
 } // closing brace for util namespace
@@ -0,0 +1,86 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file declaring the tuning table used by
+ *          RAJA::expt::tuned_forall to select policies at run-time.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PolicyTuner_HPP
+#define RAJA_PolicyTuner_HPP
+
+#include "RAJA/config.hpp"
+
+#include <string>
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+ * \brief  Tuning state of one kernel name, segment size bucket, and number
+ *         of candidate policies.
+ *
+ * Entries are created on first use and never destroyed, so pointers to
+ * them stay valid for the life of the program.
+ */
+struct PolicyTuningEntry;
+
+/*!
+ * \brief  Get the tuning entry of a kernel run over length iterations with
+ *         num_policies candidate policies. Lengths are bucketed by powers
+ *         of two.
+ */
+PolicyTuningEntry* RAJASHAREDDLL_API
+getPolicyTuningEntry(const char* name, Index_type length, int num_policies);
+
+//! the policy selected for entry, or -1 while it is being tuned
+int RAJASHAREDDLL_API getTunedPolicy(PolicyTuningEntry* entry);
+
+/*!
+ * \brief  Get the policy to time for the next run of a kernel being tuned,
+ *         policies are tried in turn. Returns the selected policy if tuning
+ *         has finished in the meantime.
+ */
+int RAJASHAREDDLL_API beginPolicyTrial(PolicyTuningEntry* entry);
+
+/*!
+ * \brief  Record the time of a run started with beginPolicyTrial. Once
+ *         every policy has been timed RAJA_TUNING_TRIALS times (default 3)
+ *         the fastest is selected, and if RAJA_TUNING_FILE is set all
+ *         selections are written to that file.
+ */
+void RAJASHAREDDLL_API endPolicyTrial(PolicyTuningEntry* entry,
+                                      int policy,
+                                      double seconds);
+
+/*!
+ * \brief  Read selections from a tuning file. The file named by
+ *         RAJA_TUNING_FILE is read automatically before the first kernel
+ *         is tuned.
+ */
+void RAJASHAREDDLL_API loadPolicyTuning(const std::string& path);
+
+//! write the selections made so far to a tuning file
+void RAJASHAREDDLL_API savePolicyTuning(const std::string& path);
+
+//! forget all selections and timings, the tuning file is not changed
+void RAJASHAREDDLL_API resetPolicyTuning();
+
+}  // namespace expt
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Profiling_Plugin_HPP
+#define RAJA_Profiling_Plugin_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginOptions.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * \brief  Totals for one kernel, kernels are identified by their
+   *         KernelName (or kernel_name for launch) and platform.
+   */
+  struct ProfilingRecord
+  {
+    std::string name;
+    Platform platform;
+    uint64_t calls;
+    //! sum of the iteration counts of the calls with a known length
+    uint64_t iterations;
+    //! host wall time from preLaunch to postLaunch
+    double seconds;
+  };
+
+  /*!
+   * \brief  Plugin timing every kernel launched through RAJA.
+   *
+   * Each thread launching kernels records into its own fixed size table, so
+   * the launch hooks take no locks and do not allocate. The tables are merged
+   * when records are requested and a report sorted by total time is written
+   * at finalize, to the file named by the RAJA_PROFILING_OUTPUT environment
+   * variable if it is set and to stdout otherwise.
+   *
+   * Times are measured on the host around the kernel launch, kernels run
+   * asynchronously (for example on a device) are only timed until they are
+   * launched.
+   */
+  class ProfilingPlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    ProfilingPlugin();
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+  };  // end ProfilingPlugin class
+
+  //! per kernel records of every thread, sorted by decreasing total time
+  std::vector<ProfilingRecord> getProfilingRecords();
+
+  //! write the records as a table to os
+  void writeProfilingReport(std::ostream& os);
+
+  //! clear the records of every thread, may be called while kernels run
+  void resetProfilingRecords();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
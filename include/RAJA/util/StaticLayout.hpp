@@ -102,6 +102,27 @@ struct StaticLayoutBase_impl<IdxLin,
   }
 
 
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * The strides and sizes are compile time constants, so the compiler
+   * replaces the divisions with multiplies and shifts.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  static RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                                     Indices &... indices)
+  {
+    camp::sink((indices = static_cast<camp::decay<Indices>>(
+                    (linear_index / (Strides ? Strides : IdxLin(1))) %
+                    (Sizes ? Sizes : IdxLin(1))))...);
+  }
+
+
   // Multiply together all of the sizes,
   // replacing 1 for any zero-sized dimensions
   static constexpr IdxLin s_size =
@@ -248,6 +269,18 @@ struct StaticLayoutBase_impl<IdxLin,
   }
 
 
+  /*!
+   * Given a linear-space index, compute the typed n-dimensional indices
+   * defined by this layout.
+   */
+  static RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IndexLinear linear_index,
+                                                     DimTypes &... indices)
+  {
+    toIndicesHelper(camp::make_idx_seq_t<sizeof...(DimTypes)>{},
+                    linear_index,
+                    indices...);
+  }
+
   static constexpr IndexLinear s_size = InnerLayout::s_size;
   static constexpr IndexLinear s_size_noproj = InnerLayout::s_size_noproj;
 
@@ -289,6 +322,18 @@ struct StaticLayoutBase_impl<IdxLin,
   RAJA_INLINE
   static void print() { InnerLayout::print(); }
 
+private:
+  template <camp::idx_t... Dims>
+  static RAJA_INLINE RAJA_HOST_DEVICE void toIndicesHelper(
+      camp::idx_seq<Dims...>,
+      IndexLinear linear_index,
+      DimTypes &... indices)
+  {
+    IndexLinear locals[sizeof...(DimTypes)];
+    InnerLayout::toIndices(linear_index, locals[Dims]...);
+    camp::sink((indices = DimTypes{static_cast<DimTypes>(locals[Dims])})...);
+  }
+
 };
 
 
@@ -0,0 +1,231 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining TiledLayout, a N-dimensional index
+ *          calculator that stores tiles of the index space contiguously
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_TILED_LAYOUT_HPP
+#define RAJA_TILED_LAYOUT_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/FastDivisor.hpp"
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/Operators.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Number of points in a tile of TileSize points in each of n_dims
+ * dimensions.
+ */
+template <typename IdxLin>
+RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin tile_volume(IdxLin tile_size,
+                                                          size_t n_dims)
+{
+  return n_dims == 0 ? IdxLin(1) : tile_size * tile_volume(tile_size, n_dims - 1);
+}
+
+template <typename Range, camp::idx_t TileSize, typename IdxLin = Index_type>
+struct TiledLayout_impl;
+
+template <camp::idx_t... RangeInts, camp::idx_t TileSize, typename IdxLin>
+struct TiledLayout_impl<camp::idx_seq<RangeInts...>, TileSize, IdxLin> {
+public:
+  static_assert(TileSize > 0, "TileSize must be positive");
+
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::make_idx_seq_t<sizeof...(RangeInts)>;
+
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+  static constexpr ptrdiff_t stride_one_dim = -1;
+  static constexpr IdxLin tile_size = TileSize;
+  static constexpr IdxLin tile_volume = detail::tile_volume(tile_size, n_dims);
+
+  IdxLin sizes[n_dims] = {0};
+  IdxLin num_tiles[n_dims] = {0};
+  // distance between neighboring tiles in each dimension
+  IdxLin tile_strides[n_dims] = {0};
+
+  // divisors for toIndices, built once from the tile strides and counts
+  FastDivisor<IdxLin> inv_tile_strides[n_dims];
+  FastDivisor<IdxLin> inv_num_tiles[n_dims];
+
+
+  /*!
+   * Default constructor with zero sizes and strides.
+   */
+  constexpr RAJA_INLINE TiledLayout_impl() = default;
+  constexpr RAJA_INLINE TiledLayout_impl(TiledLayout_impl const &) = default;
+  constexpr RAJA_INLINE TiledLayout_impl(TiledLayout_impl &&) = default;
+  RAJA_INLINE TiledLayout_impl &operator=(TiledLayout_impl const &) = default;
+  RAJA_INLINE TiledLayout_impl &operator=(TiledLayout_impl &&) = default;
+
+  /*!
+   * Construct a layout given the size of each dimension.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr TiledLayout_impl(Types... ns)
+      : sizes{static_cast<IdxLin>(stripIndexType(ns))...},
+        num_tiles{(sizes[RangeInts] > 0
+                       ? (sizes[RangeInts] + tile_size - 1) / tile_size
+                       : IdxLin(1))...},
+        tile_strides{(detail::stride_calculator<RangeInts + 1, n_dims, IdxLin>{}(
+            tile_volume,
+            num_tiles))...},
+        inv_tile_strides{tile_strides[RangeInts]...},
+        inv_num_tiles{num_tiles[RangeInts]...}
+  {
+    static_assert(n_dims == sizeof...(Types),
+                  "number of dimensions must match");
+  }
+
+  /*!
+   * Computes a linear space index from specified indices.
+   * This is the offset of the tile holding the indices plus the row major
+   * offset of the indices in that tile.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin operator()(
+      Indices... indices) const
+  {
+    return sum<IdxLin>(
+        ((static_cast<IdxLin>(stripIndexType(indices)) / tile_size) *
+             tile_strides[RangeInts] +
+         (static_cast<IdxLin>(stripIndexType(indices)) % tile_size) *
+             detail::tile_volume(tile_size, n_dims - 1 - RangeInts))...);
+  }
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+    const IdxLin in_tile = linear_index % tile_volume;
+
+    camp::sink((indices = (camp::decay<Indices>)(
+        ((linear_index / inv_tile_strides[RangeInts]) % inv_num_tiles[RangeInts]) *
+            tile_size +
+        (in_tile / detail::tile_volume(tile_size, n_dims - 1 - RangeInts)) %
+            tile_size))...);
+  }
+
+  /*!
+   * Computes the size of the layout's storage, which holds whole tiles so
+   * it may be larger than the product of the sizes.
+   *
+   * @return Number of entries in the storage of this layout
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return tile_volume * foldl(RAJA::operators::multiplies<IdxLin>(),
+                               num_tiles[RangeInts]...);
+  }
+
+  /*!
+   * Computes a total size of the layout's space.
+   * This is the produce of each dimensions size.
+   *
+   * @return Total size spanned by indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size_noproj() const
+  {
+    return foldl(RAJA::operators::multiplies<IdxLin>(), sizes[RangeInts]...);
+  }
+
+  template<camp::idx_t DIM>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr
+  IndexLinear get_dim_size() const {
+    return sizes[DIM];
+  }
+
+  template<camp::idx_t DIM>
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr
+  IndexLinear get_dim_begin() const {
+    return 0;
+  }
+};
+
+template <camp::idx_t... RangeInts, camp::idx_t TileSize, typename IdxLin>
+constexpr size_t
+    TiledLayout_impl<camp::idx_seq<RangeInts...>, TileSize, IdxLin>::n_dims;
+template <camp::idx_t... RangeInts, camp::idx_t TileSize, typename IdxLin>
+constexpr IdxLin
+    TiledLayout_impl<camp::idx_seq<RangeInts...>, TileSize, IdxLin>::tile_size;
+template <camp::idx_t... RangeInts, camp::idx_t TileSize, typename IdxLin>
+constexpr IdxLin
+    TiledLayout_impl<camp::idx_seq<RangeInts...>, TileSize, IdxLin>::tile_volume;
+
+}  // namespace detail
+
+/*!
+ * @brief A mapping of n-dimensional index space to a linear index space
+ * that stores tiles of TileSize points in each dimension contiguously.
+ *
+ * Neighbors in every dimension are in the same tile, and so likely in the
+ * same cache line or page, except at the edges of tiles. The tiles are in
+ * row major order, as are the points in each tile. Each dimension is
+ * padded to a whole number of tiles, so storage for a View with this
+ * layout must hold size() entries, which may be more than the product of
+ * the sizes. A power of 2 TileSize makes the index math shifts and masks.
+ *
+ * For example:
+ *
+ *     // Create a 100 x 100 layout with 8 x 8 tiles
+ *     TiledLayout<2, 8> layout(100, 100);
+ *
+ *     // storage for 13 x 13 tiles
+ *     double* data = new double[layout.size()];
+ *     View<double, TiledLayout<2, 8>> view(data, layout);
+ *
+ *     // Map from 2d index space to linear
+ *     int lin = layout(9, 3);    // lin = 1 * (13 * 64) + 1 * 8 + 3
+ *
+ *     // Map from linear space to 2d indices
+ *     int i, j;
+ *     layout.toIndices(lin, i, j);  // i,j = {9, 3}
+ *
+ * Data may be copied between views with tiled and strided layouts with
+ * RAJA::copy_view.
+ */
+template <size_t n_dims, camp::idx_t TileSize, typename IdxLin = Index_type>
+using TiledLayout =
+    detail::TiledLayout_impl<camp::make_idx_seq_t<n_dims>, TileSize, IdxLin>;
+
+}  // namespace RAJA
+
+#endif
@@ -18,14 +18,21 @@
 #ifndef RAJA_BASIC_MEMPOOL_HPP
 #define RAJA_BASIC_MEMPOOL_HPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <list>
 #include <map>
+#include <memory>
+#include <vector>
 
 #include "RAJA/util/align.hpp"
+#include "RAJA/util/macros.hpp"
 #include "RAJA/util/mutex.hpp"
 
 namespace RAJA
@@ -239,9 +246,127 @@ private:
   used_type m_used_space;
 };
 
+
+/*! \class SizeClassArena
+ ******************************************************************************
+ *
+ * \brief  SizeClassArena divides a large chunk of pre-allocated memory into
+ * fixed size pages that are each given to a single size class of MemPool
+ *
+ * Pages are aligned to page_bytes so blocks of a power of two size class are
+ * aligned to the class size. The size class of a page is recorded on the host
+ * so the memory itself is never accessed, which allows device memory to be
+ * used. Pages are not returned to the arena until the arena is released.
+ *
+ ******************************************************************************
+ */
+class SizeClassArena
+{
+public:
+  static const size_t page_bytes = 64ull * 1024ull;
+
+  SizeClassArena() = default;
+
+  SizeClassArena(void* ptr, size_t size)
+    : m_allocation{ ptr, static_cast<char*>(ptr)+size },
+      m_pages_begin(nullptr),
+      m_num_pages(0),
+      m_next_page(0),
+      m_page_class()
+  {
+    if (m_allocation.begin == nullptr) {
+      fprintf(stderr, "Attempt to create SizeClassArena with no memory");
+      std::abort();
+    }
+    void* pages_ptr = ptr;
+    size_t pages_size = size;
+    if (::RAJA::align(page_bytes, page_bytes, pages_ptr, pages_size)) {
+      m_pages_begin = static_cast<char*>(pages_ptr);
+      m_num_pages = pages_size / page_bytes;
+      m_page_class.reset(new int[m_num_pages]);
+      std::fill_n(m_page_class.get(), m_num_pages, -1);
+    }
+  }
+
+  SizeClassArena(SizeClassArena const&) = delete;
+  SizeClassArena& operator=(SizeClassArena const&) = delete;
+
+  SizeClassArena(SizeClassArena&&) = default;
+  SizeClassArena& operator=(SizeClassArena&&) = default;
+
+  void* get_allocation() { return m_allocation.begin; }
+
+  bool contains(const void* ptr) const
+  {
+    return m_pages_begin <= ptr &&
+           ptr < m_pages_begin + m_num_pages * page_bytes;
+  }
+
+  //! size class of the page containing ptr, ptr must be contained
+  int size_class(const void* ptr) const
+  {
+    const size_t page = (static_cast<const char*>(ptr) - m_pages_begin) /
+                        page_bytes;
+    return m_page_class[page];
+  }
+
+  //! get an unused page for size_class, nullptr if there are none left
+  void* get_page(int size_class)
+  {
+    void* ptr_out = nullptr;
+    if (m_next_page < m_num_pages) {
+      m_page_class[m_next_page] = size_class;
+      ptr_out = m_pages_begin + m_next_page * page_bytes;
+      ++m_next_page;
+    }
+    return ptr_out;
+  }
+
+private:
+  struct memory_chunk {
+    void* begin;
+    void* end;
+  };
+
+  memory_chunk m_allocation{ nullptr, nullptr };
+  char* m_pages_begin = nullptr;
+  size_t m_num_pages = 0;
+  size_t m_next_page = 0;
+  std::unique_ptr<int[]> m_page_class;
+};
+
 } /* end namespace detail */
 
 
+/*! \struct MemPoolStatistics
+ ******************************************************************************
+ *
+ * \brief  Counts of the allocation requests served by a MemPool
+ *
+ * Allocation rates can be derived by sampling the statistics around a
+ * region of interest.
+ *
+ ******************************************************************************
+ */
+struct MemPoolStatistics
+{
+  //! number of calls to malloc
+  size_t num_mallocs = 0;
+  //! number of calls to free
+  size_t num_frees = 0;
+  //! mallocs served from the calling thread's size class cache
+  size_t num_thread_cache_mallocs = 0;
+  //! mallocs served from the shared size class free lists
+  size_t num_size_class_mallocs = 0;
+  //! mallocs served by first fit search of the arenas
+  size_t num_arena_mallocs = 0;
+  //! number of allocations made with the underlying allocator
+  size_t num_backing_allocations = 0;
+  //! bytes allocated with the underlying allocator
+  size_t num_backing_bytes = 0;
+};
+
+
 /*! \class MemPool
  ******************************************************************************
  *
@@ -251,6 +376,13 @@ private:
  * MemPool uses MemoryArena to do the heavy lifting of maintaining access to
  * the used/free space.
  *
+ * Small requests are served from power of two size classes carved out of
+ * SizeClassArena pages, making malloc/free constant time. With OpenMP each
+ * thread keeps a small cache of free blocks per pool and size class that it
+ * can use without taking the pool lock, and gives the blocks back to the
+ * pool when it exits. Larger requests use the first fit arenas. The counts
+ * in MemPoolStatistics are kept per thread and summed by get_statistics.
+ *
  * MemPool provides an example generic_allocator which can guide more
  *specialized
  * allocators. The following are some examples
@@ -296,9 +428,25 @@ public:
 
   static const size_t default_default_arena_size = 32ull * 1024ull * 1024ull;
 
+  static const size_t num_size_classes = 9;
+  static const size_t min_size_class_bytes = 64;
+  static const size_t max_size_class_bytes =
+      min_size_class_bytes << (num_size_classes - 1);
+
+  static const size_t size_class_arena_size = 4ull * 1024ull * 1024ull;
+  static const size_t max_size_class_arenas = 64;
+
+  static const size_t thread_cache_capacity = 32;
+  static const size_t thread_cache_refill = 8;
+
   MemPool()
-      : m_arenas(), m_default_arena_size(default_default_arena_size), m_alloc()
+      : m_arenas(), m_default_arena_size(default_default_arena_size), m_alloc(),
+        m_id(next_epoch()), m_epoch(next_epoch())
   {
+#if defined(RAJA_ENABLE_OPENMP)
+    m_anchor = std::make_shared<pool_anchor>();
+    m_anchor->pool = this;
+#endif
   }
 
   ~MemPool()
@@ -306,6 +454,12 @@ public:
     // With static objects like MemPool, cudaErrorCudartUnloading is a possible
     // error with cudaFree
     // So no more cuda calls here
+
+#if defined(RAJA_ENABLE_OPENMP)
+    // thread caches of exiting threads must no longer return blocks here
+    lock_guard<omp::mutex> lock(m_anchor->mutex);
+    m_anchor->pool = nullptr;
+#endif
   }
 
 
@@ -321,6 +475,21 @@ public:
       m_alloc.free(allocation_ptr);
       m_arenas.pop_front();
     }
+
+    const size_t num_size_class_arenas =
+        m_num_size_class_arenas.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < num_size_class_arenas; ++i) {
+      m_alloc.free(m_size_class_arenas[i].get_allocation());
+      m_size_class_arenas[i] = detail::SizeClassArena{};
+    }
+    m_num_size_class_arenas.store(0, std::memory_order_release);
+
+    for (std::vector<void*>& free_list : m_free_lists) {
+      free_list.clear();
+    }
+
+    // invalidate blocks held in thread caches
+    m_epoch.store(next_epoch(), std::memory_order_release);
   }
 
   size_t arena_size()
@@ -343,32 +512,56 @@ public:
     return prev_size;
   }
 
-  template <typename T>
-  T* malloc(size_t nTs, size_t alignment = alignof(T))
+  /// Get the counts of allocation requests served by this pool
+  ///
+  /// Counts made on other threads while this runs may or may not be
+  /// included.
+  MemPoolStatistics get_statistics() const
   {
 #if defined(RAJA_ENABLE_OPENMP)
     lock_guard<omp::mutex> lock(m_mutex);
 #endif
 
+    MemPoolStatistics stats = total_statistics();
+    stats.num_mallocs -= m_stats_offset.num_mallocs;
+    stats.num_frees -= m_stats_offset.num_frees;
+    stats.num_thread_cache_mallocs -= m_stats_offset.num_thread_cache_mallocs;
+    stats.num_size_class_mallocs -= m_stats_offset.num_size_class_mallocs;
+    stats.num_arena_mallocs -= m_stats_offset.num_arena_mallocs;
+    stats.num_backing_allocations -= m_stats_offset.num_backing_allocations;
+    stats.num_backing_bytes -= m_stats_offset.num_backing_bytes;
+    return stats;
+  }
+
+  /// Reset all counts of allocation requests to zero
+  ///
+  /// The per thread counts are never written by other threads, the counts
+  /// at the time of the reset are instead subtracted by get_statistics.
+  void reset_statistics()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    m_stats_offset = total_statistics();
+  }
+
+  template <typename T>
+  T* malloc(size_t nTs, size_t alignment = alignof(T))
+  {
+    thread_cache& cache = get_thread_cache();
+    count(cache.stats.num_mallocs);
+
     const size_t size = nTs * sizeof(T);
     void* ptr = nullptr;
-    arena_container_type::iterator end = m_arenas.end();
-    for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
-         ++iter) {
-      ptr = iter->get(size, alignment);
-      if (ptr != nullptr) {
-        break;
-      }
+
+    const int size_class = get_size_class(size, alignment);
+    if (size_class >= 0) {
+      ptr = size_class_get(cache, size_class);
     }
 
     if (ptr == nullptr) {
-      const size_t alloc_size =
-          std::max(size + alignment, m_default_arena_size);
-      void* arena_ptr = m_alloc.malloc(alloc_size);
-      if (arena_ptr != nullptr) {
-        m_arenas.emplace_front(arena_ptr, alloc_size);
-        ptr = m_arenas.front().get(size, alignment);
-      }
+      ptr = arena_get(size, alignment);
     }
 
     return static_cast<T*>(ptr);
@@ -376,11 +569,21 @@ public:
 
   void free(const void* cptr)
   {
+    thread_cache& cache = get_thread_cache();
+    count(cache.stats.num_frees);
+
+    void* ptr = const_cast<void*>(cptr);
+
+    const int size_class = find_size_class(ptr);
+    if (size_class >= 0) {
+      size_class_give(cache, ptr, size_class);
+      return;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)
     lock_guard<omp::mutex> lock(m_mutex);
 #endif
 
-    void* ptr = const_cast<void*>(cptr);
     arena_container_type::iterator end = m_arenas.end();
     for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
          ++iter) {
@@ -396,14 +599,361 @@ public:
 
 private:
   using arena_container_type = std::list<detail::MemoryArena>;
+  using size_class_arena_container_type =
+      std::array<detail::SizeClassArena, max_size_class_arenas>;
+  using free_lists_type = std::array<std::vector<void*>, num_size_classes>;
+
+  //! counts made on the fast paths, written only by the owning thread
+  struct thread_statistics {
+    std::atomic<size_t> num_mallocs{0};
+    std::atomic<size_t> num_frees{0};
+    std::atomic<size_t> num_thread_cache_mallocs{0};
+  };
 
 #if defined(RAJA_ENABLE_OPENMP)
-  omp::mutex m_mutex;
+  //! per thread free blocks, only valid for the epoch recorded
+  struct thread_cache {
+    size_t epoch = 0;
+    free_lists_type free_lists;
+    thread_statistics stats;
+  };
+
+  //! lets exiting threads find out whether the pool still exists
+  struct pool_anchor {
+    omp::mutex mutex;
+    MemPool* pool = nullptr;
+  };
+
+  //! the caches of one thread, keyed by pool id, returned to their pools
+  //  when the thread exits
+  struct thread_caches {
+    struct entry {
+      size_t pool_id;
+      std::shared_ptr<pool_anchor> anchor;
+      std::unique_ptr<thread_cache> cache;
+    };
+
+    std::vector<entry> entries;
+
+    ~thread_caches()
+    {
+      for (entry& e : entries) {
+        lock_guard<omp::mutex> lock(e.anchor->mutex);
+        if (e.anchor->pool != nullptr) {
+          e.anchor->pool->retire_thread_cache(*e.cache);
+        }
+      }
+    }
+  };
+#else
+  //! without OpenMP there is one thread and no cached blocks
+  struct thread_cache {
+    thread_statistics stats;
+  };
+#endif
+
+  //! ids and epochs are unique across pools so a new pool at the address of
+  //  a destroyed pool does not see the destroyed pool's cached blocks
+  static size_t next_epoch()
+  {
+    static std::atomic<size_t> s_epoch{1};
+    return s_epoch.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  //! increment a counter only ever written by the calling thread, a plain
+  //  load and store avoids a locked read-modify-write
+  static void count(std::atomic<size_t>& counter)
+  {
+    counter.store(counter.load(std::memory_order_relaxed) + 1,
+                  std::memory_order_relaxed);
+  }
+
+  static void add_thread_statistics(MemPoolStatistics& stats,
+                                    thread_statistics const& thread_stats)
+  {
+    stats.num_mallocs +=
+        thread_stats.num_mallocs.load(std::memory_order_relaxed);
+    stats.num_frees += thread_stats.num_frees.load(std::memory_order_relaxed);
+    stats.num_thread_cache_mallocs +=
+        thread_stats.num_thread_cache_mallocs.load(std::memory_order_relaxed);
+  }
+
+  //! counts since the pool was created, call with lock held
+  MemPoolStatistics total_statistics() const
+  {
+    MemPoolStatistics stats = m_stats;
+#if defined(RAJA_ENABLE_OPENMP)
+    for (const thread_cache* cache : m_thread_caches) {
+      add_thread_statistics(stats, cache->stats);
+    }
+#else
+    add_thread_statistics(stats, m_thread_cache.stats);
+#endif
+    return stats;
+  }
+
+  //! smallest size class that fits size and alignment, -1 if none does
+  static int get_size_class(size_t size, size_t alignment)
+  {
+    const size_t nbytes = (size < alignment) ? alignment : size;
+    if (nbytes > max_size_class_bytes) {
+      return -1;
+    }
+    int size_class = 0;
+    while ((min_size_class_bytes << size_class) < nbytes) {
+      ++size_class;
+    }
+    return size_class;
+  }
+
+  //! size class of ptr if it was allocated from a size class, -1 otherwise
+  int find_size_class(const void* ptr) const
+  {
+    const size_t num_size_class_arenas =
+        m_num_size_class_arenas.load(std::memory_order_acquire);
+    for (size_t i = 0; i < num_size_class_arenas; ++i) {
+      if (m_size_class_arenas[i].contains(ptr)) {
+        return m_size_class_arenas[i].size_class(ptr);
+      }
+    }
+    return -1;
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  thread_cache& get_thread_cache()
+  {
+    static thread_local thread_caches caches;
+
+    thread_cache* cache = nullptr;
+    for (typename thread_caches::entry& e : caches.entries) {
+      if (e.pool_id == m_id) {
+        cache = e.cache.get();
+        break;
+      }
+    }
+    if (cache == nullptr) {
+      cache = add_thread_cache(caches);
+    }
+
+    // blocks cached before free_chunks no longer exist
+    const size_t epoch = m_epoch.load(std::memory_order_acquire);
+    if (cache->epoch != epoch) {
+      for (std::vector<void*>& free_list : cache->free_lists) {
+        free_list.clear();
+      }
+      cache->epoch = epoch;
+    }
+    return *cache;
+  }
+
+  //! make a cache for this pool on the calling thread
+  thread_cache* add_thread_cache(thread_caches& caches)
+  {
+    // drop the caches of destroyed pools
+    caches.entries.erase(
+        std::remove_if(caches.entries.begin(),
+                       caches.entries.end(),
+                       [](typename thread_caches::entry& e) {
+                         lock_guard<omp::mutex> lock(e.anchor->mutex);
+                         return e.anchor->pool == nullptr;
+                       }),
+        caches.entries.end());
+
+    std::unique_ptr<thread_cache> cache(new thread_cache);
+    thread_cache* cache_ptr = cache.get();
+    {
+      lock_guard<omp::mutex> lock(m_mutex);
+      m_thread_caches.push_back(cache_ptr);
+    }
+    caches.entries.push_back(
+        typename thread_caches::entry{m_id, m_anchor, std::move(cache)});
+    return cache_ptr;
+  }
+
+  //! give the blocks and counts of an exiting thread's cache to the pool
+  void retire_thread_cache(thread_cache& cache)
+  {
+    lock_guard<omp::mutex> lock(m_mutex);
+
+    if (cache.epoch == m_epoch.load(std::memory_order_relaxed)) {
+      for (size_t i = 0; i < num_size_classes; ++i) {
+        m_free_lists[i].insert(m_free_lists[i].end(),
+                               cache.free_lists[i].begin(),
+                               cache.free_lists[i].end());
+        cache.free_lists[i].clear();
+      }
+    }
+
+    add_thread_statistics(m_stats, cache.stats);
+    m_thread_caches.erase(std::remove(m_thread_caches.begin(),
+                                      m_thread_caches.end(),
+                                      &cache),
+                          m_thread_caches.end());
+  }
+#else
+  thread_cache& get_thread_cache() { return m_thread_cache; }
+#endif
+
+  void* size_class_get(thread_cache& cache, int size_class)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    std::vector<void*>& cache_list = cache.free_lists[size_class];
+    if (!cache_list.empty()) {
+      void* ptr = cache_list.back();
+      cache_list.pop_back();
+      count(cache.stats.num_thread_cache_mallocs);
+      return ptr;
+    }
+
+    lock_guard<omp::mutex> lock(m_mutex);
+#else
+    RAJA_UNUSED_VAR(cache);
+#endif
+
+    std::vector<void*>& free_list = m_free_lists[size_class];
+    if (free_list.empty() && !add_size_class_page(size_class)) {
+      return nullptr;
+    }
+
+    void* ptr = free_list.back();
+    free_list.pop_back();
+
+#if defined(RAJA_ENABLE_OPENMP)
+    // move a few more blocks to the thread cache for the next requests
+    for (size_t i = 1; i < thread_cache_refill && !free_list.empty(); ++i) {
+      cache_list.push_back(free_list.back());
+      free_list.pop_back();
+    }
+#endif
+
+    ++m_stats.num_size_class_mallocs;
+    return ptr;
+  }
+
+  void size_class_give(thread_cache& cache, void* ptr, int size_class)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    std::vector<void*>& cache_list = cache.free_lists[size_class];
+    cache_list.push_back(ptr);
+    if (cache_list.size() > thread_cache_capacity) {
+      // return half of the cached blocks for use by other threads
+      lock_guard<omp::mutex> lock(m_mutex);
+      std::vector<void*>& free_list = m_free_lists[size_class];
+      while (cache_list.size() > thread_cache_capacity / 2) {
+        free_list.push_back(cache_list.back());
+        cache_list.pop_back();
+      }
+    }
+#else
+    RAJA_UNUSED_VAR(cache);
+    m_free_lists[size_class].push_back(ptr);
+#endif
+  }
+
+  //! fill the free list of size_class with a new page, call with lock held
+  bool add_size_class_page(int size_class)
+  {
+    void* page = nullptr;
+
+    const size_t num_size_class_arenas =
+        m_num_size_class_arenas.load(std::memory_order_relaxed);
+    for (size_t i = num_size_class_arenas; i > 0; --i) {
+      page = m_size_class_arenas[i - 1].get_page(size_class);
+      if (page != nullptr) {
+        break;
+      }
+    }
+
+    if (page == nullptr && num_size_class_arenas < max_size_class_arenas) {
+      const size_t alloc_size =
+          size_class_arena_size + detail::SizeClassArena::page_bytes;
+      void* arena_ptr = m_alloc.malloc(alloc_size);
+      if (arena_ptr != nullptr) {
+        ++m_stats.num_backing_allocations;
+        m_stats.num_backing_bytes += alloc_size;
+        m_size_class_arenas[num_size_class_arenas] =
+            detail::SizeClassArena(arena_ptr, alloc_size);
+        m_num_size_class_arenas.store(num_size_class_arenas + 1,
+                                      std::memory_order_release);
+        page = m_size_class_arenas[num_size_class_arenas].get_page(size_class);
+      }
+    }
+
+    if (page == nullptr) {
+      return false;
+    }
+
+    // push in reverse so blocks are handed out in address order
+    const size_t block_bytes = min_size_class_bytes << size_class;
+    const size_t num_blocks = detail::SizeClassArena::page_bytes / block_bytes;
+    std::vector<void*>& free_list = m_free_lists[size_class];
+    for (size_t i = num_blocks; i > 0; --i) {
+      free_list.push_back(static_cast<char*>(page) + (i - 1) * block_bytes);
+    }
+    return true;
+  }
+
+  void* arena_get(size_t size, size_t alignment)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    void* ptr = nullptr;
+    arena_container_type::iterator end = m_arenas.end();
+    for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
+         ++iter) {
+      ptr = iter->get(size, alignment);
+      if (ptr != nullptr) {
+        break;
+      }
+    }
+
+    if (ptr == nullptr) {
+      const size_t alloc_size =
+          std::max(size + alignment, m_default_arena_size);
+      void* arena_ptr = m_alloc.malloc(alloc_size);
+      if (arena_ptr != nullptr) {
+        ++m_stats.num_backing_allocations;
+        m_stats.num_backing_bytes += alloc_size;
+        m_arenas.emplace_front(arena_ptr, alloc_size);
+        ptr = m_arenas.front().get(size, alignment);
+      }
+    }
+
+    if (ptr != nullptr) {
+      ++m_stats.num_arena_mallocs;
+    }
+
+    return ptr;
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  mutable omp::mutex m_mutex;
 #endif
 
   arena_container_type m_arenas;
   size_t m_default_arena_size;
   allocator_t m_alloc;
+
+  size_class_arena_container_type m_size_class_arenas;
+  std::atomic<size_t> m_num_size_class_arenas{0};
+  free_lists_type m_free_lists;
+  const size_t m_id;
+  std::atomic<size_t> m_epoch;
+
+  //! counts made with the lock held, and those of exited threads
+  MemPoolStatistics m_stats;
+  //! counts at the last reset_statistics
+  MemPoolStatistics m_stats_offset;
+
+#if defined(RAJA_ENABLE_OPENMP)
+  std::shared_ptr<pool_anchor> m_anchor;
+  //! caches of the threads that have used the pool
+  std::vector<thread_cache*> m_thread_caches;
+#else
+  thread_cache m_thread_cache;
+#endif
 };
 
 //! example allocator for basic_mempool using malloc/free
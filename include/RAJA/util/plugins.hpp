@@ -28,6 +28,15 @@ RAJA_INLINE auto trigger_updates_before(T&& item)
   return item;
 }
 
+//! true if any plugin is registered, so launch information that only the
+//! plugins read can be skipped when there are none
+RAJA_INLINE
+bool
+pluginsRegistered()
+{
+  return PluginRegistry::begin() != PluginRegistry::end();
+}
+
 RAJA_INLINE
 void
 callPreCapturePlugins(const PluginContext& p)
@@ -31,6 +31,9 @@
 #include "RAJA/policy/sycl/policy.hpp"
 #endif
 #include "RAJA/policy/sequential/policy.hpp"
+#if defined(RAJA_ENABLE_THREADS)
+#include "RAJA/policy/host_async/resource.hpp"
+#endif
 #include "RAJA/policy/openmp_target/policy.hpp"
 #include "RAJA/internal/get_platform.hpp"
 
@@ -173,6 +176,9 @@ namespace RAJA
 #endif
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
     template <> struct is_resource<resources::Omp> : std::true_type {};
+#endif
+#if defined(RAJA_ENABLE_THREADS)
+    template <> struct is_resource<resources::HostAsync> : std::true_type {};
 #endif
   } // end namespace type_traits
 
@@ -20,14 +20,22 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <climits>
+#include <cstring>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <type_traits>
 
 #include "RAJA/pattern/detail/algorithm.hpp"
 
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/math.hpp"
+#include "RAJA/util/Operators.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
 
 namespace RAJA
 {
@@ -676,6 +684,360 @@ merge_sort(Iter begin,
   //}
 }
 
+/*!
+    \brief number of key bits sorted in each pass of radix sort
+*/
+struct radix_sort_digit_bits
+{
+  static constexpr unsigned get() { return 8; }
+};
+
+/*!
+    \brief traits mapping a key to an unsigned integer whose ordering is the
+    same as the ordering of the key, types without a mapping can not be
+    radix sorted
+*/
+template <typename T, typename Enable = void>
+struct radix_sort_key_traits : std::false_type
+{ };
+
+/*!
+    \brief radix sort key traits for integral types other than bool
+*/
+template <typename T>
+struct radix_sort_key_traits<T,
+    typename std::enable_if<std::is_integral<T>::value &&
+                            !std::is_same<T, bool>::value>::type>
+  : std::true_type
+{
+  using bits_type = typename std::make_unsigned<T>::type;
+
+  // flip the sign bit of signed types so negative keys come first
+  static constexpr bits_type flip_bits =
+      std::is_signed<T>::value
+        ? static_cast<bits_type>(bits_type(1) << (sizeof(T)*CHAR_BIT - 1))
+        : bits_type(0);
+
+  template <bool descending>
+  RAJA_INLINE
+  static bits_type get(T key)
+  {
+    bits_type bits = static_cast<bits_type>(static_cast<bits_type>(key) ^ flip_bits);
+    return descending ? static_cast<bits_type>(~bits) : bits;
+  }
+};
+
+/*!
+    \brief radix sort key traits for IEEE floating point types
+*/
+template <typename T>
+struct radix_sort_key_traits<T,
+    typename std::enable_if<std::is_floating_point<T>::value &&
+                            std::numeric_limits<T>::is_iec559 &&
+                            (sizeof(T) == sizeof(unsigned int) ||
+                             sizeof(T) == sizeof(unsigned long long))>::type>
+  : std::true_type
+{
+  using bits_type = typename std::conditional<sizeof(T) == sizeof(unsigned int),
+                                              unsigned int,
+                                              unsigned long long>::type;
+
+  static constexpr bits_type sign_bit =
+      static_cast<bits_type>(bits_type(1) << (sizeof(T)*CHAR_BIT - 1));
+
+  template <bool descending>
+  RAJA_INLINE
+  static bits_type get(T key)
+  {
+    bits_type bits = sign_bit;
+    // -0.0 and 0.0 compare equal so they must get the same bits to keep
+    // the sort stable
+    if (key != T(0)) {
+      std::memcpy(&bits, &key, sizeof(T));
+      // negative keys flip all bits, positive keys flip only the sign bit
+      bits = (bits & sign_bit) ? static_cast<bits_type>(~bits)
+                               : static_cast<bits_type>(bits | sign_bit);
+    }
+    return descending ? static_cast<bits_type>(~bits) : bits;
+  }
+};
+
+/*!
+    \brief true if Compare sorts keys of type T in descending order
+*/
+template <typename T, typename Compare>
+using radix_sort_descending = camp::is_same<Compare, operators::greater<T>>;
+
+/*!
+    \brief true if the range given by Iter can be radix sorted using Compare,
+    this requires a key type with radix sort key traits and either
+    RAJA::operators::less or RAJA::operators::greater
+*/
+template <typename Iter, typename Compare>
+using is_radix_sortable = concepts::all_of<
+    radix_sort_key_traits<IterVal<Iter>>,
+    concepts::any_of<
+      camp::is_same<Compare, operators::less<IterVal<Iter>>>,
+      camp::is_same<Compare, operators::greater<IterVal<Iter>>>>>;
+
+/*!
+    \brief get the radix sort digit of key starting at bit shift
+*/
+template <typename Compare, typename T>
+RAJA_INLINE
+unsigned
+radix_sort_digit(T key, unsigned shift)
+{
+  constexpr unsigned digit_mask = (1u << radix_sort_digit_bits::get()) - 1u;
+  return static_cast<unsigned>(
+      radix_sort_key_traits<T>::template get<
+        radix_sort_descending<T, Compare>::value>(key) >> shift) & digit_mask;
+}
+
+/*!
+    \brief placeholder for the values when radix sorting keys only
+*/
+struct radix_sort_no_values
+{
+  template <typename diff_type>
+  RAJA_INLINE void move(diff_type, diff_type) const { }
+
+  RAJA_INLINE void flip() { }
+
+  template <typename diff_type>
+  RAJA_INLINE void move_back(diff_type, diff_type) const { }
+};
+
+/*!
+    \brief values moved along with the keys during radix sort, the values are
+    moved back and forth between the given range and a buffer of the same
+    size as the keys are
+*/
+template <typename ValIter>
+struct radix_sort_values
+{
+  using value_type = IterVal<ValIter>;
+
+  ValIter vals;
+  value_type* buf;
+  bool in_buffer = false;
+  bool buf_constructed = false;
+
+  radix_sort_values(ValIter vals_, value_type* buf_)
+    : vals(vals_), buf(buf_)
+  { }
+
+  template <typename diff_type>
+  RAJA_INLINE void move(diff_type i_src, diff_type i_dst)
+  {
+    if (in_buffer) {
+      vals[i_dst] = std::move(buf[i_src]);
+    } else if (buf_constructed) {
+      buf[i_dst] = std::move(vals[i_src]);
+    } else {
+      new(&buf[i_dst]) value_type(std::move(vals[i_src]));
+    }
+  }
+
+  // called after every pass, after the first pass every item in the buffer
+  // has been constructed
+  RAJA_INLINE void flip()
+  {
+    buf_constructed = true;
+    in_buffer = !in_buffer;
+  }
+
+  template <typename diff_type>
+  RAJA_INLINE void move_back(diff_type i_begin, diff_type i_end)
+  {
+    if (in_buffer) {
+      std::move(buf + i_begin, buf + i_end, vals + i_begin);
+    }
+  }
+};
+
+/*!
+    \brief count the radix sort digits of keys in [i_begin, i_end) starting
+    at bit shift
+*/
+template <typename Compare, typename Iter, typename diff_type>
+RAJA_INLINE
+void
+radix_sort_count(Iter keys,
+                 diff_type i_begin,
+                 diff_type i_end,
+                 unsigned shift,
+                 diff_type* counts)
+{
+  for (diff_type i = i_begin; i < i_end; ++i) {
+    ++counts[radix_sort_digit<Compare>(keys[i], shift)];
+  }
+}
+
+/*!
+    \brief scatter keys and values in [i_begin, i_end) into their bucket
+    by the radix sort digit starting at bit shift, the offsets are the first
+    output index of each bucket and are advanced as items are written
+*/
+template <typename Compare, typename SrcIter, typename DstIter,
+          typename Vals, typename diff_type>
+RAJA_INLINE
+void
+radix_sort_scatter(SrcIter src_keys,
+                   DstIter dst_keys,
+                   Vals& vals,
+                   diff_type i_begin,
+                   diff_type i_end,
+                   unsigned shift,
+                   diff_type* offsets)
+{
+  for (diff_type i = i_begin; i < i_end; ++i) {
+    const diff_type j = offsets[radix_sort_digit<Compare>(src_keys[i], shift)]++;
+    dst_keys[j] = src_keys[i];
+    vals.move(i, j);
+  }
+}
+
+/*!
+    \brief stable LSD radix sort given range of keys, moving the given values
+    with the keys, using O(N*sizeof(key)) operations and O(N) memory
+*/
+template <typename Iter, typename Vals, typename Compare>
+RAJA_INLINE
+void
+radix_sort_impl(Iter begin,
+                Iter end,
+                Vals& vals,
+                Compare)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using key_type = RAJA::detail::IterVal<Iter>;
+  using traits = radix_sort_key_traits<key_type>;
+  using bits_type = typename traits::bits_type;
+
+  constexpr unsigned digit_bits = radix_sort_digit_bits::get();
+  constexpr unsigned num_buckets = 1u << digit_bits;
+  constexpr unsigned num_passes = (sizeof(key_type)*CHAR_BIT + digit_bits - 1) / digit_bits;
+  constexpr bool descending = radix_sort_descending<key_type, Compare>::value;
+
+  const diff_type len = end - begin;
+
+  if (len <= 1) {
+    return;
+  }
+
+  // count the digits for every pass in a single read of the keys,
+  // the counts are not changed by the permutation done in each pass
+  diff_type counts[num_passes][num_buckets] = {};
+  for (diff_type i = 0; i < len; ++i) {
+    const bits_type bits = traits::template get<descending>(begin[i]);
+    for (unsigned pass = 0; pass < num_passes; ++pass) {
+      ++counts[pass][(bits >> (pass*digit_bits)) & (num_buckets - 1u)];
+    }
+  }
+
+  std::unique_ptr<key_type, FreeAligned> key_buf(
+      RAJA::allocate_aligned_type<key_type>( RAJA::DATA_ALIGN, len * sizeof(key_type) ));
+
+  key_type* buf = key_buf.get();
+
+  // check memory allocation worked
+  if (buf == nullptr) {
+    RAJA_ABORT_OR_THROW( "radix_sort temporary memory allocation failed" );
+  }
+
+  bool in_buffer = false;
+  for (unsigned pass = 0; pass < num_passes; ++pass) {
+
+    const unsigned shift = pass*digit_bits;
+    diff_type* offsets = counts[pass];
+
+    // skip passes where every key has the same digit
+    if (offsets[radix_sort_digit<Compare>(begin[0], shift)] == len) {
+      continue;
+    }
+
+    diff_type offset = 0;
+    for (unsigned d = 0; d < num_buckets; ++d) {
+      const diff_type count = offsets[d];
+      offsets[d] = offset;
+      offset += count;
+    }
+
+    if (in_buffer) {
+      radix_sort_scatter<Compare>(buf, begin, vals, diff_type(0), len, shift, offsets);
+    } else {
+      radix_sort_scatter<Compare>(begin, buf, vals, diff_type(0), len, shift, offsets);
+    }
+
+    vals.flip();
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer) {
+    std::copy(buf, buf + len, begin);
+    vals.move_back(diff_type(0), len);
+  }
+}
+
+/*!
+    \brief stable LSD radix sort given range inplace using RAJA::operators::less
+    or RAJA::operators::greater, using O(N*sizeof(key)) operations and O(N) memory
+*/
+template <typename Iter, typename Compare>
+RAJA_INLINE
+void
+radix_sort(Iter begin,
+           Iter end,
+           Compare comp)
+{
+  radix_sort_no_values vals;
+  radix_sort_impl(begin, end, vals, comp);
+}
+
+/*!
+    \brief stable LSD radix sort given range of pairs inplace using
+    RAJA::operators::less or RAJA::operators::greater on keys,
+    using O(N*sizeof(key)) operations and O(N) memory
+*/
+template <typename KeyIter, typename ValIter, typename Compare>
+RAJA_INLINE
+void
+radix_sort_pairs(KeyIter keys_begin,
+                 KeyIter keys_end,
+                 ValIter vals_begin,
+                 Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<KeyIter>;
+  using value_type = RAJA::detail::IterVal<ValIter>;
+
+  const diff_type len = keys_end - keys_begin;
+
+  if (len <= 1) {
+    return;
+  }
+
+  // Manage the lifetime of the buffer and objects constructed in the buffer
+  using buf_deleter_type = FreeAlignedType<value_type, diff_type>;
+  buf_deleter_type buf_deleter;
+
+  std::unique_ptr<value_type, buf_deleter_type&> val_buf(
+      RAJA::allocate_aligned_type<value_type>( RAJA::DATA_ALIGN, len * sizeof(value_type) ),
+      buf_deleter);
+
+  // check memory allocation worked
+  if (val_buf.get() == nullptr) {
+    RAJA_ABORT_OR_THROW( "radix_sort temporary memory allocation failed" );
+  }
+
+  radix_sort_values<ValIter> vals(vals_begin, val_buf.get());
+  radix_sort_impl(keys_begin, keys_end, vals, comp);
+
+  if (vals.buf_constructed) {
+    buf_deleter.size = len;
+  }
+}
+
 }  // namespace detail
 
 /*!
@@ -828,6 +1190,81 @@ merge_sort(Container&& c,
   }
 }
 
+/*!
+    \brief stable radix sort given range inplace using RAJA::operators::less
+    or RAJA::operators::greater and using O(N*sizeof(key)) operations and
+    O(N) memory
+*/
+template <typename Container,
+          typename Compare = operators::less<detail::ContainerVal<Container>>>
+RAJA_INLINE
+concepts::enable_if<type_traits::is_range<Container>>
+radix_sort(Container&& c,
+           Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(detail::radix_sort_key_traits<T>::value,
+                "radix_sort is only implemented for integral and floating point types");
+  static_assert(concepts::any_of<
+      camp::is_same<Compare, operators::less<T>>,
+      camp::is_same<Compare, operators::greater<T>>>::value,
+      "radix_sort is only implemented for RAJA::operators::less or RAJA::operators::greater");
+
+  auto begin_it = begin(c);
+  auto end_it   = end(c);
+
+  if (begin_it != end_it) {
+    auto next = begin_it;
+    if (++next != end_it) {
+      detail::radix_sort(begin_it, end_it, comp);
+    }
+  }
+}
+
+/*!
+    \brief stable radix sort given range of pairs inplace using
+    RAJA::operators::less or RAJA::operators::greater on keys and using
+    O(N*sizeof(key)) operations and O(N) memory
+*/
+template <typename KeyContainer,
+          typename ValContainer,
+          typename Compare = operators::less<detail::ContainerVal<KeyContainer>>>
+RAJA_INLINE
+concepts::enable_if<type_traits::is_range<KeyContainer>,
+                    type_traits::is_range<ValContainer>>
+radix_sort_pairs(KeyContainer&& keys,
+                 ValContainer&& vals,
+                 Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<KeyContainer>;
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+  static_assert(detail::radix_sort_key_traits<T>::value,
+                "radix_sort_pairs is only implemented for integral and floating point keys");
+  static_assert(concepts::any_of<
+      camp::is_same<Compare, operators::less<T>>,
+      camp::is_same<Compare, operators::greater<T>>>::value,
+      "radix_sort_pairs is only implemented for RAJA::operators::less or RAJA::operators::greater");
+
+  auto begin_it = begin(keys);
+  auto end_it   = end(keys);
+
+  if (begin_it != end_it) {
+    auto next = begin_it;
+    if (++next != end_it) {
+      detail::radix_sort_pairs(begin_it, end_it, begin(vals), comp);
+    }
+  }
+}
+
 }  // namespace RAJA
 
 #endif
@@ -25,13 +25,13 @@ namespace RAJA
 
 void DepGraphNode::print(std::ostream& os) const
 {
-  os << "DepGraphNode : sem, reload value = " << m_semaphore_value << " , "
-     << m_semaphore_reload_value << std::endl;
+  os << "DepGraphNode : reload value = " << m_semaphore_reload_value
+     << std::endl;
 
-  os << "     num dep tasks = " << m_num_dep_tasks;
-  if (m_num_dep_tasks > 0) {
+  os << "     num dep tasks = " << numDepTasks();
+  if (numDepTasks() > 0) {
     os << " ( ";
-    for (int jj = 0; jj < m_num_dep_tasks; ++jj) {
+    for (int jj = 0; jj < numDepTasks(); ++jj) {
       os << m_dep_task[jj] << "  ";
     }
     os << " )";
@@ -20,6 +20,7 @@
 #include <cstring>
 
 #include <iostream>
+#include <vector>
 
 #include "RAJA/index/IndexSetBuilders.hpp"
 
@@ -46,7 +47,8 @@ void buildLockFreeBlockIndexset(
     RAJA::TypedIndexSet<RAJA::RangeSegment>& iset,
     int fastDim,
     int midDim,
-    int slowDim)
+    int slowDim,
+    const double* zoneCost)
 {
   constexpr int PROFITABLE_ENTITY_THRESHOLD_BLOCK = 100;
 
@@ -107,85 +109,73 @@ void buildLockFreeBlockIndexset(
     }
   } else { /* 3d mesh */
 
-    // this requires dependence graph - commenting out for now
-
-    /* Need at least 3 full planes per thread */
-    /* and at least one segment per plane */
-    /*
-        const int segmentsPerThread = 2;
-        int rowsPerSegment = slowDim / (segmentsPerThread * numThreads);
-        if (rowsPerSegment == 0) {
-          // printf("%d %d\n", 0, fastDim*midDim*slowDim) ;
-          iset.push_back(RAJA::RangeSegment(0, fastDim * midDim * slowDim));
-          printf(
-              "Failure to create lockfree indexset - not enough rows per "
-              "segment\n");
-          exit(-1);
-        } else {
-    */
-    /* This just sets up the schedule -- a truly safe */
-    /* execution of this schedule would require a check */
-    /* for completion of dependent threads before execution. */
-
-    /* We might want to force one thread if the */
-    /* profitability ratio is really bad, but for */
-    /* now use the brain dead approach. */
-    /*
-          for (int lane = 0; lane < segmentsPerThread; ++lane) {
-            for (int i = 0; i < numThreads; ++i) {
-              RAJA::Index_type startPlane = i * slowDim / numThreads;
-              RAJA::Index_type endPlane = (i + 1) * slowDim / numThreads;
-              RAJA::Index_type start = startPlane * fastDim * midDim;
-              RAJA::Index_type end = endPlane * fastDim * midDim;
-              RAJA::Index_type len = end - start;
-              // printf("%d %d\n", start + (lane  )*len/segmentsPerThread,
-              //                   start + (lane+1)*len/segmentsPerThread  );
-              iset.push_back(
-                  RAJA::RangeSegment(start + (lane)*len / segmentsPerThread,
-                                     start + (lane + 1) * len /
-       segmentsPerThread));
-            }
-          }
-    */
-    /* Allocate dependency graph structures for index set segments */
-    /*
-          iset.initDependencyGraph();
-
-          if (segmentsPerThread == 1) {
-    */
-    /* This dependency graph should impose serialization */
-    /*
-            for (int i = 0; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreValue() = ((i
-       == 0) ? 0 : 1); task->semaphoreReloadValue() = ((i == 0) ? 0 : 1); if (i
-       != numThreads - 1) { task->numDepTasks() = 1; task->depTaskNum(0) = i +
-       1;
-              }
-            }
-          } else {
-    */
-    /* This dependency graph relies on omp schedule(static, 1) */
-    /* but allows a minimumal set of dependent tasks be used */
-    /*
-            int borderSeg = numThreads * (segmentsPerThread - 1);
-            for (int i = 1; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreReloadValue() =
-       1; task->numDepTasks() = 1; task->depTaskNum(0) = borderSeg + i - 1;
-
-              RAJA::DepGraphNode* border_task =
-                  iset.getSegmentInfo(borderSeg + i - 1)->getDepGraphNode();
-              border_task->semaphoreValue() = 1;
-              border_task->semaphoreReloadValue() = 1;
-              border_task->numDepTasks() = 1;
-              border_task->depTaskNum(0) = i;
-            }
-          }
+    /* Split the mesh into slabs of whole planes. A zone touches the */
+    /* nodes of its own plane and the next one, so only adjacent slabs */
+    /* share nodes: even slabs run concurrently, and each odd slab runs */
+    /* once both its even neighbors have completed. */
+    const RAJA::Index_type planeSize =
+        static_cast<RAJA::Index_type>(fastDim) * midDim;
+
+    const int segmentsPerThread = 2;
+    int numSlabs = segmentsPerThread * numThreads;
+    if (numSlabs > slowDim) {
+      numSlabs = slowDim;
+    }
 
-          iset.finalizeDependencyGraph();
+    /* Cost of planes [0, k) */
+    std::vector<double> planeCost(slowDim + 1, 0.0);
+    for (int k = 0; k < slowDim; ++k) {
+      double cost = 1.0;
+      if (zoneCost != nullptr) {
+        cost = 0.0;
+        const double* plane = zoneCost + k * planeSize;
+        for (RAJA::Index_type z = 0; z < planeSize; ++z) {
+          cost += plane[z];
+        }
+      }
+      planeCost[k + 1] = planeCost[k] + cost;
+    }
+    const double totalCost = planeCost[slowDim];
+
+    /* Place each slab boundary at the plane closest to an equal share */
+    /* of the cost, keeping at least one plane in every slab. */
+    std::vector<int> slabStart(numSlabs + 1);
+    slabStart[0] = 0;
+    slabStart[numSlabs] = slowDim;
+    for (int s = 1; s < numSlabs; ++s) {
+      int k = slabStart[s - 1] + 1;
+      if (totalCost > 0.0) {
+        const double target = totalCost * s / numSlabs;
+        while (k < slowDim && planeCost[k] < target) {
+          ++k;
         }
-    */
+        if (k > slabStart[s - 1] + 1 &&
+            target - planeCost[k - 1] < planeCost[k] - target) {
+          --k;
+        }
+      } else {
+        k = static_cast<int>(static_cast<RAJA::Index_type>(s) * slowDim /
+                             numSlabs);
+      }
+      const int lo = slabStart[s - 1] + 1;
+      const int hi = slowDim - (numSlabs - s);
+      slabStart[s] = (k < lo) ? lo : ((k > hi) ? hi : k);
+    }
+
+    for (int s = 0; s < numSlabs; ++s) {
+      iset.push_back(RAJA::RangeSegment(slabStart[s] * planeSize,
+                                        slabStart[s + 1] * planeSize));
+    }
+
+    /* Allocate dependency graph structures for index set segments */
+    iset.initDependencyGraph();
+    for (int s = 1; s < numSlabs; s += 2) {
+      iset.addSegmentDependency(s, s - 1);
+      if (s + 1 < numSlabs) {
+        iset.addSegmentDependency(s, s + 1);
+      }
+    }
+    iset.finalizeDependencyGraph();
   }
 
   /* Print the dependency schedule for segments */
@@ -7,6 +7,10 @@
 
 #include "RAJA/util/PluginStrategy.hpp"
 
+#if defined(RAJA_ENABLE_PROFILING_PLUGIN)
+#include "RAJA/util/ProfilingPlugin.hpp"
+#endif
+
 RAJA_INSTANTIATE_REGISTRY(PluginRegistry);
 
 namespace RAJA {
@@ -28,3 +32,9 @@ void PluginStrategy::finalize() { }
 
 }
 }
+
+#if defined(RAJA_ENABLE_PROFILING_PLUGIN)
+// Registered here rather than in ProfilingPlugin.cpp so it is linked into
+// every executable using RAJA, PluginStrategy.cpp is always linked.
+static RAJA::util::PluginRegistry::add<RAJA::util::ProfilingPlugin> P("ProfilingPlugin", "Time kernels and report per kernel totals at finalize.");
+#endif
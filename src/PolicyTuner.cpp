@@ -0,0 +1,290 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/PolicyTuner.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+namespace RAJA
+{
+namespace expt
+{
+
+struct PolicyTuningEntry {
+  std::string name;
+  int bucket;
+  int num_policies;
+
+  //! selected policy, -1 while tuning
+  std::atomic<int> policy{-1};
+
+  // tuning state, guarded by the table mutex
+  int next_trial = 0;
+  std::vector<int> trials;
+  std::vector<double> best_seconds;
+};
+
+}  // namespace expt
+}  // namespace RAJA
+
+namespace
+{
+
+using RAJA::expt::PolicyTuningEntry;
+
+using TuningKey = std::tuple<std::string, int, int>;
+
+struct PolicyTuningTable {
+  std::mutex mutex;
+  std::map<TuningKey, PolicyTuningEntry> entries;
+  int trials = 3;
+  std::string file;
+};
+
+//
+// Created on first use and never destroyed so kernels run during static
+// destruction can still be tuned.
+//
+PolicyTuningTable& getTable()
+{
+  static PolicyTuningTable* table = [] {
+    PolicyTuningTable* t = new PolicyTuningTable;
+    const char* trials = std::getenv("RAJA_TUNING_TRIALS");
+    if (trials != nullptr && std::atoi(trials) > 0) {
+      t->trials = std::atoi(trials);
+    }
+    const char* file = std::getenv("RAJA_TUNING_FILE");
+    if (file != nullptr && file[0] != '\0') {
+      t->file = file;
+    }
+    return t;
+  }();
+  return *table;
+}
+
+int getBucket(RAJA::Index_type length)
+{
+  int bucket = 0;
+  while (length > 0) {
+    ++bucket;
+    length >>= 1;
+  }
+  return bucket;
+}
+
+PolicyTuningEntry& findEntry(PolicyTuningTable& table,
+                             const std::string& name,
+                             int bucket,
+                             int num_policies)
+{
+  PolicyTuningEntry& entry =
+      table.entries[TuningKey(name, bucket, num_policies)];
+  if (entry.trials.empty()) {
+    entry.name = name;
+    entry.bucket = bucket;
+    entry.num_policies = num_policies;
+    entry.trials.assign(num_policies, 0);
+    entry.best_seconds.assign(num_policies,
+                              std::numeric_limits<double>::infinity());
+  }
+  return entry;
+}
+
+void loadTable(PolicyTuningTable& table, const std::string& path)
+{
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    // name, bucket, number of policies, and selected policy separated by
+    // tabs, names may contain spaces
+    std::istringstream fields(line);
+    std::string name;
+    int bucket = -1;
+    int num_policies = 0;
+    int policy = -1;
+    if (!std::getline(fields, name, '\t') ||
+        !(fields >> bucket >> num_policies >> policy) || bucket < 0 ||
+        num_policies <= 0 || policy < 0 || policy >= num_policies) {
+      continue;
+    }
+    findEntry(table, name, bucket, num_policies)
+        .policy.store(policy, std::memory_order_release);
+  }
+}
+
+void saveTable(PolicyTuningTable& table, const std::string& path)
+{
+  std::ofstream file(path);
+  if (!file) {
+    std::cerr << "[PolicyTuner]: could not write " << path << std::endl;
+    return;
+  }
+  for (auto const& item : table.entries) {
+    PolicyTuningEntry const& entry = item.second;
+    const int policy = entry.policy.load(std::memory_order_relaxed);
+    if (policy >= 0) {
+      file << entry.name << '\t' << entry.bucket << '\t'
+           << entry.num_policies << '\t' << policy << '\n';
+    }
+  }
+}
+
+//! the table, after reading RAJA_TUNING_FILE the first time
+PolicyTuningTable& getLoadedTable()
+{
+  static bool loaded = [] {
+    PolicyTuningTable& table = getTable();
+    if (!table.file.empty()) {
+      std::lock_guard<std::mutex> lock(table.mutex);
+      loadTable(table, table.file);
+    }
+    return true;
+  }();
+  (void)loaded;
+  return getTable();
+}
+
+//
+// Per thread cache of recent lookups, so the table mutex is only taken the
+// first time a thread runs a kernel. Names are compared by pointer and by
+// content, in case a name's storage was reused for another name.
+//
+struct TuningCacheSlot {
+  const char* name = nullptr;
+  int bucket = -1;
+  int num_policies = 0;
+  PolicyTuningEntry* entry = nullptr;
+};
+
+constexpr std::size_t tuning_cache_size = 64;
+
+}  // end anonymous namespace
+
+namespace RAJA
+{
+namespace expt
+{
+
+PolicyTuningEntry* getPolicyTuningEntry(const char* name,
+                                        Index_type length,
+                                        int num_policies)
+{
+  static thread_local TuningCacheSlot cache[tuning_cache_size];
+
+  const int bucket = getBucket(length);
+  const uint64_t hash =
+      ((static_cast<uint64_t>(reinterpret_cast<std::uintptr_t>(name)) >> 3) *
+           31 +
+       bucket) *
+      0x9E3779B97F4A7C15ull;
+  TuningCacheSlot& slot = cache[(hash >> 32) % tuning_cache_size];
+
+  if (slot.entry != nullptr && slot.name == name && slot.bucket == bucket &&
+      slot.num_policies == num_policies &&
+      slot.entry->name == (name ? name : "")) {
+    return slot.entry;
+  }
+
+  PolicyTuningTable& table = getLoadedTable();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  PolicyTuningEntry& entry =
+      findEntry(table, name ? name : "", bucket, num_policies);
+
+  slot.name = name;
+  slot.bucket = bucket;
+  slot.num_policies = num_policies;
+  slot.entry = &entry;
+  return &entry;
+}
+
+int getTunedPolicy(PolicyTuningEntry* entry)
+{
+  return entry->policy.load(std::memory_order_acquire);
+}
+
+int beginPolicyTrial(PolicyTuningEntry* entry)
+{
+  PolicyTuningTable& table = getTable();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  const int policy = entry->policy.load(std::memory_order_relaxed);
+  if (policy >= 0) {
+    return policy;
+  }
+  const int trial = entry->next_trial;
+  entry->next_trial = (trial + 1) % entry->num_policies;
+  return trial;
+}
+
+void endPolicyTrial(PolicyTuningEntry* entry, int policy, double seconds)
+{
+  PolicyTuningTable& table = getTable();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  if (entry->policy.load(std::memory_order_relaxed) >= 0) {
+    return;
+  }
+
+  ++entry->trials[policy];
+  if (seconds < entry->best_seconds[policy]) {
+    entry->best_seconds[policy] = seconds;
+  }
+
+  int best = 0;
+  for (int p = 0; p < entry->num_policies; ++p) {
+    if (entry->trials[p] < table.trials) {
+      return;
+    }
+    if (entry->best_seconds[p] < entry->best_seconds[best]) {
+      best = p;
+    }
+  }
+  entry->policy.store(best, std::memory_order_release);
+
+  if (!table.file.empty()) {
+    saveTable(table, table.file);
+  }
+}
+
+void loadPolicyTuning(const std::string& path)
+{
+  PolicyTuningTable& table = getLoadedTable();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  loadTable(table, path);
+}
+
+void savePolicyTuning(const std::string& path)
+{
+  PolicyTuningTable& table = getLoadedTable();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  saveTable(table, path);
+}
+
+void resetPolicyTuning()
+{
+  PolicyTuningTable& table = getLoadedTable();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  for (auto& item : table.entries) {
+    PolicyTuningEntry& entry = item.second;
+    entry.policy.store(-1, std::memory_order_relaxed);
+    entry.next_trial = 0;
+    entry.trials.assign(entry.num_policies, 0);
+    entry.best_seconds.assign(entry.num_policies,
+                              std::numeric_limits<double>::infinity());
+  }
+}
+
+}  // namespace expt
+}  // namespace RAJA
@@ -0,0 +1,354 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/ProfilingPlugin.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+//! number of kernels each thread can record, a power of two
+constexpr std::size_t table_size = 512;
+
+//! longest kernel name kept, longer names are truncated
+constexpr std::size_t max_name_length = 95;
+
+//! deepest nesting of kernel launches that is timed
+constexpr int max_depth = 64;
+
+//
+// One kernel in a thread's table. Only the owning thread writes an entry,
+// the counters are atomics so they can be read while the owner records.
+//
+struct ProfilingEntry
+{
+  std::atomic<bool> used{false};
+  const char* key = nullptr;
+  RAJA::Platform platform = RAJA::Platform::undefined;
+  char name[max_name_length + 1] = {};
+
+  std::atomic<uint64_t> calls{0};
+  std::atomic<uint64_t> iterations{0};
+  std::atomic<uint64_t> nanoseconds{0};
+};
+
+struct ProfilingTable
+{
+  std::atomic<bool> owned{true};
+
+  //! reset epoch the counters belong to, see resetProfilingRecords
+  std::atomic<uint64_t> epoch{0};
+
+  ProfilingEntry entries[table_size];
+
+  //! kernels that did not fit in entries
+  ProfilingEntry overflow;
+
+  clock_type::time_point starts[max_depth];
+  int depth = 0;
+};
+
+struct ProfilingTableList
+{
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ProfilingTable>> tables;
+};
+
+//
+// resetProfilingRecords only advances the epoch, each thread zeroes its own
+// counters when it next records and tables of older epochs are not read, so
+// no thread writes counters another thread is updating.
+//
+std::atomic<uint64_t> reset_epoch{0};
+
+// never destroyed so threads exiting during static destruction can still
+// release their tables
+ProfilingTableList& getTableList()
+{
+  static ProfilingTableList* list = new ProfilingTableList;
+  return *list;
+}
+
+//
+// Tables outlive their threads so the records of finished threads are kept,
+// a table released by an exiting thread is reused by the next new thread.
+//
+struct ProfilingTableHandle
+{
+  ProfilingTable* table = nullptr;
+
+  ~ProfilingTableHandle()
+  {
+    if (table) {
+      table->depth = 0;
+      table->owned.store(false, std::memory_order_release);
+    }
+  }
+};
+
+ProfilingTable& getThreadTable()
+{
+  static thread_local ProfilingTableHandle handle;
+
+  if (!handle.table) {
+    ProfilingTableList& list = getTableList();
+    std::lock_guard<std::mutex> lock(list.mutex);
+    for (auto& table : list.tables) {
+      if (!table->owned.load(std::memory_order_acquire)) {
+        table->owned.store(true, std::memory_order_relaxed);
+        handle.table = table.get();
+        break;
+      }
+    }
+    if (!handle.table) {
+      list.tables.emplace_back(new ProfilingTable);
+      handle.table = list.tables.back().get();
+    }
+  }
+  return *handle.table;
+}
+
+void addTo(std::atomic<uint64_t>& counter, uint64_t value)
+{
+  // only the owning thread writes, so no read-modify-write is needed
+  counter.store(counter.load(std::memory_order_relaxed) + value,
+                std::memory_order_relaxed);
+}
+
+void clearCounts(ProfilingEntry& entry)
+{
+  entry.calls.store(0, std::memory_order_relaxed);
+  entry.iterations.store(0, std::memory_order_relaxed);
+  entry.nanoseconds.store(0, std::memory_order_relaxed);
+}
+
+//! zero the counters of the calling thread's table after a reset
+void syncEpoch(ProfilingTable& table)
+{
+  const uint64_t epoch = reset_epoch.load(std::memory_order_acquire);
+  if (table.epoch.load(std::memory_order_relaxed) != epoch) {
+    for (ProfilingEntry& entry : table.entries) {
+      clearCounts(entry);
+    }
+    clearCounts(table.overflow);
+    table.epoch.store(epoch, std::memory_order_release);
+  }
+}
+
+bool matches(const ProfilingEntry& entry,
+             const char* key,
+             RAJA::Platform platform)
+{
+  // names are usually literals so the pointer identifies them, the copy is
+  // compared as well in case a name's storage was reused for another name
+  return entry.key == key && entry.platform == platform &&
+         (key == nullptr ||
+          std::strncmp(entry.name, key, max_name_length) == 0);
+}
+
+ProfilingEntry& findEntry(ProfilingTable& table,
+                          const char* key,
+                          RAJA::Platform platform)
+{
+  const std::size_t hash =
+      (reinterpret_cast<std::uintptr_t>(key) >> 3) * 0x9E3779B97F4A7C15ull ^
+      static_cast<std::size_t>(platform);
+
+  for (std::size_t probe = 0; probe < table_size; ++probe) {
+    ProfilingEntry& entry = table.entries[(hash + probe) & (table_size - 1)];
+    if (!entry.used.load(std::memory_order_relaxed)) {
+      entry.key = key;
+      entry.platform = platform;
+      if (key) {
+        std::strncpy(entry.name, key, max_name_length);
+        entry.name[max_name_length] = '\0';
+      }
+      entry.used.store(true, std::memory_order_release);
+      return entry;
+    }
+    if (matches(entry, key, platform)) {
+      return entry;
+    }
+  }
+  return table.overflow;
+}
+
+const char* getPlatformName(RAJA::Platform platform)
+{
+  switch (platform) {
+    case RAJA::Platform::host: return "host";
+    case RAJA::Platform::cuda: return "cuda";
+    case RAJA::Platform::hip: return "hip";
+    case RAJA::Platform::omp_target: return "omp_target";
+    case RAJA::Platform::sycl: return "sycl";
+    default: return "undefined";
+  }
+}
+
+}  // end anonymous namespace
+
+namespace RAJA {
+namespace util {
+
+ProfilingPlugin::ProfilingPlugin() = default;
+
+void ProfilingPlugin::preLaunch(const RAJA::util::PluginContext&)
+{
+  ProfilingTable& table = getThreadTable();
+  if (table.depth < max_depth) {
+    table.starts[table.depth] = clock_type::now();
+  }
+  ++table.depth;
+}
+
+void ProfilingPlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  const clock_type::time_point stop = clock_type::now();
+
+  ProfilingTable& table = getThreadTable();
+  if (table.depth == 0) {
+    return;
+  }
+  --table.depth;
+
+  syncEpoch(table);
+
+  ProfilingEntry& entry = findEntry(table, p.kernel_name, p.platform);
+  addTo(entry.calls, 1);
+  if (p.length >= 0) {
+    addTo(entry.iterations, static_cast<uint64_t>(p.length));
+  }
+  if (table.depth < max_depth) {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        stop - table.starts[table.depth]);
+    addTo(entry.nanoseconds, static_cast<uint64_t>(elapsed.count()));
+  }
+}
+
+void ProfilingPlugin::finalize()
+{
+  const char* path = std::getenv("RAJA_PROFILING_OUTPUT");
+  if (path != nullptr && path[0] != '\0') {
+    std::ofstream file(path);
+    if (file) {
+      writeProfilingReport(file);
+      return;
+    }
+    std::cerr << "[ProfilingPlugin]: could not open " << path
+              << ", writing report to stdout" << std::endl;
+  }
+  writeProfilingReport(std::cout);
+}
+
+std::vector<ProfilingRecord> getProfilingRecords()
+{
+  std::map<std::pair<std::string, int>, ProfilingRecord> merged;
+
+  auto merge = [&](const ProfilingEntry& entry, const std::string& name) {
+    const uint64_t calls = entry.calls.load(std::memory_order_relaxed);
+    if (calls == 0) {
+      return;
+    }
+    ProfilingRecord& record =
+        merged.emplace(std::make_pair(name, static_cast<int>(entry.platform)),
+                       ProfilingRecord{name, entry.platform, 0, 0, 0.0})
+            .first->second;
+    record.calls += calls;
+    record.iterations += entry.iterations.load(std::memory_order_relaxed);
+    record.seconds +=
+        1.0e-9 * entry.nanoseconds.load(std::memory_order_relaxed);
+  };
+
+  const uint64_t epoch = reset_epoch.load(std::memory_order_acquire);
+
+  ProfilingTableList& list = getTableList();
+  {
+    std::lock_guard<std::mutex> lock(list.mutex);
+    for (auto& table : list.tables) {
+      if (table->epoch.load(std::memory_order_acquire) != epoch) {
+        // recorded before the last reset
+        continue;
+      }
+      for (const ProfilingEntry& entry : table->entries) {
+        if (entry.used.load(std::memory_order_acquire)) {
+          merge(entry, entry.key ? entry.name : "<unnamed>");
+        }
+      }
+      merge(table->overflow, "<other>");
+    }
+  }
+
+  std::vector<ProfilingRecord> records;
+  records.reserve(merged.size());
+  for (auto& item : merged) {
+    records.push_back(std::move(item.second));
+  }
+  std::stable_sort(records.begin(), records.end(),
+                   [](const ProfilingRecord& a, const ProfilingRecord& b) {
+                     return a.seconds > b.seconds;
+                   });
+  return records;
+}
+
+void writeProfilingReport(std::ostream& os)
+{
+  const std::vector<ProfilingRecord> records = getProfilingRecords();
+
+  double total = 0.0;
+  for (const ProfilingRecord& record : records) {
+    total += record.seconds;
+  }
+
+  const std::ios::fmtflags flags = os.flags();
+  const std::streamsize precision = os.precision();
+
+  os << "RAJA profiling report, kernels sorted by total time\n";
+  os << std::setw(12) << "time (s)" << std::setw(8) << "%"
+     << std::setw(12) << "calls" << std::setw(16) << "iterations"
+     << std::setw(12) << "ns/iter" << std::setw(12) << "platform"
+     << "  kernel\n";
+
+  for (const ProfilingRecord& record : records) {
+    os << std::fixed << std::setprecision(6) << std::setw(12)
+       << record.seconds << std::setprecision(1) << std::setw(8)
+       << ((total > 0.0) ? 100.0 * record.seconds / total : 0.0)
+       << std::setw(12) << record.calls << std::setw(16)
+       << record.iterations << std::setw(12);
+    if (record.iterations > 0) {
+      os << 1.0e9 * record.seconds / record.iterations;
+    } else {
+      os << "-";
+    }
+    os << std::setw(12) << getPlatformName(record.platform) << "  "
+       << record.name << "\n";
+  }
+  os.flush();
+
+  os.flags(flags);
+  os.precision(precision);
+}
+
+void resetProfilingRecords()
+{
+  reset_epoch.fetch_add(1, std::memory_order_acq_rel);
+}
+
+}  // end namespace util
+}  // end namespace RAJA
@@ -0,0 +1,119 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_FUSED_HPP__
+#define __TEST_FORALL_FUSED_HPP__
+
+#include <numeric>
+#include <vector>
+
+template <typename INDEX_TYPE, typename WORKING_RES,
+          typename EXEC_POLICY, typename FUSE_POLICY>
+void ForallFusedTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  const INDEX_TYPE N = last - first;
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg(first, last);
+
+  std::vector<INDEX_TYPE> idx_array(N);
+  std::iota(&idx_array[0], &idx_array[0] + N, first);
+
+  RAJA::TypedListSegment<INDEX_TYPE> lseg(&idx_array[0], N,
+                                          working_res);
+
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  allocateForallTestData<INDEX_TYPE>(N,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  //
+  // Bodies without a barrier only use the data of their own iteration.
+  //
+  RAJA::expt::fused_forall<EXEC_POLICY, FUSE_POLICY>(rseg,
+    [=](INDEX_TYPE idx) {
+      working_array[idx - first] = idx;
+    },
+    [=](INDEX_TYPE idx) {
+      working_array[idx - first] += idx;
+    },
+    [=](INDEX_TYPE idx) {
+      test_array[idx - first] = working_array[idx - first] + 1;
+    });
+
+  for (INDEX_TYPE i = 0; i < N; i++) {
+    ASSERT_EQ(test_array[i], 2 * (first + i) + 1);
+  }
+
+  //
+  // The body after the barrier reads data written by other iterations of
+  // the body before it, and the reductions cover every body.
+  //
+  INDEX_TYPE sum = 0;
+  INDEX_TYPE max = 0;
+
+  RAJA::expt::fused_forall<EXEC_POLICY, FUSE_POLICY>(lseg,
+    RAJA::expt::fused_body(
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      [=](INDEX_TYPE idx, INDEX_TYPE& s) {
+        working_array[idx - first] = 1;
+        s += 1;
+      }),
+    RAJA::expt::fused_barrier,
+    RAJA::expt::fused_body(
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      RAJA::expt::Reduce<RAJA::operators::maximum>(&max),
+      [=](INDEX_TYPE idx, INDEX_TYPE& s, INDEX_TYPE& m) {
+        const INDEX_TYPE next = (idx - first + 1) % N;
+        test_array[idx - first] =
+            working_array[idx - first] + working_array[next];
+        s += test_array[idx - first];
+        m = RAJA_MAX(m, idx);
+      }),
+    RAJA::expt::fused_barrier);
+
+  ASSERT_EQ(sum, 3 * N);
+  ASSERT_EQ(max, last - 1);
+  for (INDEX_TYPE i = 0; i < N; i++) {
+    ASSERT_EQ(test_array[i], 2);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallFusedTest);
+template <typename T>
+class ForallFusedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallFusedTest, FusedForall)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+  using FUSE_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  ForallFusedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY, FUSE_POLICY>(0, 25);
+  ForallFusedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY, FUSE_POLICY>(1, 153);
+  ForallFusedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY, FUSE_POLICY>(3, 2556);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallFusedTest,
+                            FusedForall);
+
+#endif  // __TEST_FORALL_FUSED_HPP__
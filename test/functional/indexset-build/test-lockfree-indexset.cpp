@@ -0,0 +1,148 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for lock-free block index set builder.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include <cmath>
+#include <vector>
+
+using LockFreeISetType = RAJA::TypedIndexSet<RAJA::RangeSegment>;
+
+//
+// Check the segments are contiguous slabs of whole planes covering the mesh
+// and that odd slabs depend on their neighbors.
+//
+void checkLockFreeSlabs(const LockFreeISetType& iset,
+                        RAJA::Index_type planeSize,
+                        int slowDim)
+{
+  const int numSlabs = static_cast<int>(iset.size());
+  ASSERT_GE(numSlabs, 1);
+  ASSERT_EQ(static_cast<RAJA::Index_type>(iset.getLength()), planeSize * slowDim);
+  ASSERT_TRUE(iset.dependencyGraphSet());
+
+  RAJA::Index_type next = 0;
+  for (int s = 0; s < numSlabs; ++s) {
+    const RAJA::RangeSegment& seg = iset.getSegment<const RAJA::RangeSegment>(s);
+    ASSERT_EQ(*seg.begin(), next);
+    ASSERT_GT(seg.size(), 0);
+    ASSERT_EQ(seg.size() % planeSize, 0);
+    next += seg.size();
+
+    const RAJA::DepGraphNode& node = iset.getDepGraphNode(s);
+    if (s % 2 == 0) {
+      ASSERT_EQ(node.semaphoreReloadValue(), 0);
+    } else {
+      ASSERT_EQ(node.semaphoreReloadValue(), (s + 1 < numSlabs) ? 2 : 1);
+    }
+  }
+  ASSERT_EQ(next, planeSize * slowDim);
+}
+
+TEST(IndexSetBuild, LockFreeBlock3D)
+{
+  const int fastDim = 5;
+  const int midDim = 4;
+  const int slowDim = 37;
+
+  LockFreeISetType iset;
+  RAJA::buildLockFreeBlockIndexset(iset, fastDim, midDim, slowDim);
+
+  checkLockFreeSlabs(iset, fastDim * midDim, slowDim);
+}
+
+TEST(IndexSetBuild, LockFreeBlock3DCost)
+{
+  const int fastDim = 2;
+  const int midDim = 2;
+  const int slowDim = 1000;
+  const RAJA::Index_type planeSize = fastDim * midDim;
+
+  // zones in plane k cost k + 1
+  std::vector<double> cost(planeSize * slowDim);
+  for (int k = 0; k < slowDim; ++k) {
+    for (RAJA::Index_type z = 0; z < planeSize; ++z) {
+      cost[k * planeSize + z] = k + 1.0;
+    }
+  }
+
+  LockFreeISetType iset;
+  RAJA::buildLockFreeBlockIndexset(iset, fastDim, midDim, slowDim, &cost[0]);
+
+  checkLockFreeSlabs(iset, planeSize, slowDim);
+
+  const int numSlabs = static_cast<int>(iset.size());
+  if (4 * numSlabs <= slowDim) {
+    double total = 0.0;
+    for (double c : cost) {
+      total += c;
+    }
+    const double maxPlaneCost = planeSize * static_cast<double>(slowDim);
+
+    // each slab boundary is within one plane of an equal share of the cost
+    for (int s = 0; s < numSlabs; ++s) {
+      const RAJA::RangeSegment& seg =
+          iset.getSegment<const RAJA::RangeSegment>(s);
+      double slabCost = 0.0;
+      for (RAJA::Index_type i : seg) {
+        slabCost += cost[i];
+      }
+      ASSERT_LE(std::abs(slabCost - total / numSlabs), 2.0 * maxPlaneCost);
+    }
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(IndexSetBuild, LockFreeBlock3DScatter)
+{
+  const int fastDim = 6;
+  const int midDim = 5;
+  const int slowDim = 64;
+  const int fastNodes = fastDim + 1;
+  const int planeNodes = fastNodes * (midDim + 1);
+
+  LockFreeISetType iset;
+  RAJA::buildLockFreeBlockIndexset(iset, fastDim, midDim, slowDim);
+
+  // each zone adds to its 8 nodes without atomics, which is only safe if
+  // slabs sharing nodes do not run concurrently
+  std::vector<int> nodes(planeNodes * (slowDim + 1), 0);
+  int* node_val = &nodes[0];
+
+  using EXEC_POL = RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>;
+
+  RAJA::forall<EXEC_POL>(iset, [=](RAJA::Index_type zone) {
+    const int i = static_cast<int>(zone % fastDim);
+    const int j = static_cast<int>((zone / fastDim) % midDim);
+    const int k = static_cast<int>(zone / (fastDim * midDim));
+    for (int dk = 0; dk < 2; ++dk) {
+      for (int dj = 0; dj < 2; ++dj) {
+        for (int di = 0; di < 2; ++di) {
+          node_val[(k + dk) * planeNodes + (j + dj) * fastNodes + i + di] += 1;
+        }
+      }
+    }
+  });
+
+  for (int k = 0; k <= slowDim; ++k) {
+    for (int j = 0; j <= midDim; ++j) {
+      for (int i = 0; i <= fastDim; ++i) {
+        const int nk = (k == 0 || k == slowDim) ? 1 : 2;
+        const int nj = (j == 0 || j == midDim) ? 1 : 2;
+        const int ni = (i == 0 || i == fastDim) ? 1 : 2;
+        ASSERT_EQ(nodes[k * planeNodes + j * fastNodes + i], nk * nj * ni);
+      }
+    }
+  }
+}
+#endif
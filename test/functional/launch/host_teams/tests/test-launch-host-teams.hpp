@@ -0,0 +1,136 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_LAUNCH_HOST_TEAMS_HPP__
+#define __TEST_LAUNCH_HOST_TEAMS_HPP__
+
+#include <cstdint>
+
+//
+// Transpose of a rows x cols matrix through tiles in shared memory, the
+// threads of a team read a tile, sync, and write the transpose of the tile.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename LAUNCH_POLICY>
+void LaunchHostTeamsTestImpl(INDEX_TYPE rows, INDEX_TYPE cols)
+{
+  constexpr int TILE = 8;
+
+  const int n_rows = static_cast<int>(RAJA::stripIndexType(rows));
+  const int n_cols = static_cast<int>(RAJA::stripIndexType(cols));
+  const int tiles_r = (n_rows + TILE - 1) / TILE;
+  const int tiles_c = (n_cols + TILE - 1) / TILE;
+
+  RAJA::TypedRangeSegment<int> tile_r_range(0, tiles_r);
+  RAJA::TypedRangeSegment<int> tile_c_range(0, tiles_c);
+  RAJA::TypedRangeSegment<int> in_tile_range(0, TILE);
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = n_rows * n_cols;
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  INDEX_TYPE* in_array = check_array;
+  for (int r = 0; r < n_rows; ++r) {
+    for (int c = 0; c < n_cols; ++c) {
+      in_array[c + n_cols * r] = static_cast<INDEX_TYPE>(c + n_cols * r);
+      test_array[r + n_rows * c] = static_cast<INDEX_TYPE>(c + n_cols * r);
+    }
+  }
+
+  int misaligned = 0;
+
+  //one char before the tile to check the alignment of the tile
+  size_t shared_mem_size = sizeof(INDEX_TYPE) + TILE * TILE * sizeof(INDEX_TYPE);
+
+  RAJA::launch<LAUNCH_POLICY>
+    (RAJA::LaunchParams(RAJA::Teams(tiles_c, tiles_r),
+                        RAJA::Threads(TILE, TILE), shared_mem_size),
+     [&](RAJA::LaunchContext ctx) {
+
+      RAJA::loop<RAJA::omp_launch_team_loop>(ctx, tile_c_range, tile_r_range, [&](int bc, int br) {
+
+          char * flag_ptr = ctx.getSharedMemory<char>(1);
+          INDEX_TYPE * tile_ptr = ctx.getSharedMemory<INDEX_TYPE>(TILE * TILE);
+          if (reinterpret_cast<std::uintptr_t>(tile_ptr) % alignof(INDEX_TYPE) != 0) {
+            #pragma omp atomic write
+            misaligned = 1;
+          }
+          RAJA_UNUSED_VAR(flag_ptr);
+
+          RAJA::loop<RAJA::omp_launch_thread_loop>(ctx, in_tile_range, in_tile_range, [&](int tc, int tr) {
+              const int r = br * TILE + tr;
+              const int c = bc * TILE + tc;
+              if (r < n_rows && c < n_cols) {
+                tile_ptr[tc + TILE * tr] = in_array[c + n_cols * r];
+              }
+            });
+
+          ctx.teamSync();
+
+          RAJA::loop<RAJA::omp_launch_thread_loop>(ctx, in_tile_range, in_tile_range, [&](int tr, int tc) {
+              const int r = br * TILE + tr;
+              const int c = bc * TILE + tc;
+              if (r < n_rows && c < n_cols) {
+                working_array[r + n_rows * c] = tile_ptr[tc + TILE * tr];
+              }
+            });
+
+          ctx.teamSync();
+
+          ctx.releaseSharedMemory();
+        });
+
+    });
+
+  ASSERT_EQ(misaligned, 0);
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (size_t i = 0; i < data_len; i++) {
+    ASSERT_EQ(test_array[RAJA::stripIndexType(i)], check_array[RAJA::stripIndexType(i)]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(LaunchHostTeamsTest);
+template <typename T>
+class LaunchHostTeamsTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(LaunchHostTeamsTest, HostTeamsSharedMemTranspose)
+{
+
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using LAUNCH_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  LaunchHostTeamsTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY>
+    (INDEX_TYPE(5), INDEX_TYPE(3));
+
+  LaunchHostTeamsTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY>
+    (INDEX_TYPE(37), INDEX_TYPE(53));
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(LaunchHostTeamsTest,
+                            HostTeamsSharedMemTranspose);
+
+#endif  // __TEST_LAUNCH_HOST_TEAMS_HPP__
@@ -0,0 +1,164 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_BYKEY_HPP__
+#define __TEST_SCAN_BYKEY_HPP__
+
+#include <numeric>
+
+//
+// Check each segment, starting where is_head is true, holds the inclusive
+// or exclusive scan of its own items only.
+//
+template <typename OP, typename T, typename HeadFn>
+::testing::AssertionResult check_by_key(const T* actual,
+                                        const T* original,
+                                        int N,
+                                        HeadFn is_head,
+                                        bool exclusive,
+                                        T init)
+{
+  T agg = init;
+  for (int i = 0; i < N; ++i) {
+    if (is_head(i)) {
+      agg = exclusive ? init : OP::identity();
+    }
+    T expected = exclusive ? agg : OP()(agg, original[i]);
+    if (actual[i] != expected) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected << " (at index " << i << ")";
+    }
+    agg = OP()(agg, original[i]);
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void ScanByKeyTestImpl(int N, int segment_length)
+{
+  using T = typename OP_TYPE::result_type;
+
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  T* work_in;
+  T* work_out;
+  T* host_in;
+  T* host_out;
+
+  allocScanTestData(N,
+                    working_res,
+                    &work_in, &work_out,
+                    &host_in, &host_out);
+
+  int* work_keys = working_res.allocate<int>(N);
+  int* host_keys = host_res.allocate<int>(N);
+
+  // segments of varying length, some of length one
+  std::iota(host_in, host_in + N, 1);
+  for (int i = 0, key = 0; i < N; ++i) {
+    if (i % segment_length == 0 || i % (segment_length + 3) == 0) {
+      ++key;
+    }
+    host_keys[i] = key;
+  }
+  auto is_head = [=](int i) {
+    return i == 0 || host_keys[i] != host_keys[i - 1];
+  };
+
+  res.memcpy(work_in, host_in, sizeof(T) * N);
+  res.memcpy(work_keys, host_keys, sizeof(int) * N);
+  res.wait();
+
+  // test inclusive interface without resource
+  RAJA::inclusive_scan_by_key<EXEC_POLICY>(
+      RAJA::make_span(static_cast<const int*>(work_keys), N),
+      RAJA::make_span(static_cast<const T*>(work_in), N),
+      RAJA::make_span(work_out, N),
+      OP_TYPE{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_by_key<OP_TYPE>(host_out, host_in, N, is_head, false,
+                                    OP_TYPE::identity()));
+
+  // test exclusive interface with resource and initial value
+  const T init = static_cast<T>(7);
+  RAJA::exclusive_scan_by_key<EXEC_POLICY>(
+      res,
+      RAJA::make_span(static_cast<const int*>(work_keys), N),
+      RAJA::make_span(static_cast<const T*>(work_in), N),
+      RAJA::make_span(work_out, N),
+      OP_TYPE{},
+      init);
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_by_key<OP_TYPE>(host_out, host_in, N, is_head, true,
+                                    init));
+
+  // test inplace inclusive scan
+  res.memcpy(work_out, host_in, sizeof(T) * N);
+  res.wait();
+
+  RAJA::inclusive_scan_by_key<EXEC_POLICY>(
+      res,
+      RAJA::make_span(static_cast<const int*>(work_keys), N),
+      RAJA::make_span(work_out, N),
+      RAJA::make_span(work_out, N),
+      OP_TYPE{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_by_key<OP_TYPE>(host_out, host_in, N, is_head, false,
+                                    OP_TYPE::identity()));
+
+  working_res.deallocate(work_keys);
+  host_res.deallocate(host_keys);
+  deallocScanTestData(working_res,
+                      work_in, work_out,
+                      host_in, host_out);
+}
+
+
+TYPED_TEST_SUITE_P(ScanByKeyTest);
+template <typename T>
+class ScanByKeyTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ScanByKeyTest, ScanByKey)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ScanByKeyTestImpl<EXEC_POLICY,
+                     WORKING_RESOURCE,
+                     OP_TYPE>(0, 1);
+  ScanByKeyTestImpl<EXEC_POLICY,
+                     WORKING_RESOURCE,
+                     OP_TYPE>(357, 1);
+  ScanByKeyTestImpl<EXEC_POLICY,
+                     WORKING_RESOURCE,
+                     OP_TYPE>(357, 13);
+  ScanByKeyTestImpl<EXEC_POLICY,
+                     WORKING_RESOURCE,
+                     OP_TYPE>(32000, 40);
+  ScanByKeyTestImpl<EXEC_POLICY,
+                     WORKING_RESOURCE,
+                     OP_TYPE>(32000, 32000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScanByKeyTest,
+                            ScanByKey);
+
+#endif // __TEST_SCAN_BYKEY_HPP__
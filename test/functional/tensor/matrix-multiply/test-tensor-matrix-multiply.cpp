@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for blocked matrix multiplication of Views.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <array>
+#include <vector>
+
+//
+// Multiply M x K column-major A by K x N row-major B into M x N row-major C
+// and compare with a reference computed with plain loops. Element values
+// are small integers so the results are exact.
+//
+template <typename ExecPolicy, typename T>
+void testMatrixMultiply(RAJA::Index_type M,
+                        RAJA::Index_type N,
+                        RAJA::Index_type K,
+                        T alpha,
+                        T beta)
+{
+  std::vector<T> a_vec(M * K);
+  std::vector<T> b_vec(K * N);
+  std::vector<T> c_vec(M * N);
+  std::vector<T> ref_vec(M * N);
+
+  std::array<RAJA::idx_t, 2> col_major{{1, 0}};
+  RAJA::View<T, RAJA::Layout<2>> A(
+      a_vec.data(), RAJA::make_permuted_layout({{M, K}}, col_major));
+  RAJA::View<T, RAJA::Layout<2>> B(b_vec.data(), K, N);
+  RAJA::View<T, RAJA::Layout<2>> C(c_vec.data(), M, N);
+
+  for (RAJA::Index_type i = 0; i < M; ++i) {
+    for (RAJA::Index_type k = 0; k < K; ++k) {
+      A(i, k) = static_cast<T>((i + 2 * k) % 7) - 3;
+    }
+  }
+  for (RAJA::Index_type k = 0; k < K; ++k) {
+    for (RAJA::Index_type j = 0; j < N; ++j) {
+      B(k, j) = static_cast<T>((3 * k + j) % 5) - 2;
+    }
+  }
+  for (RAJA::Index_type i = 0; i < M; ++i) {
+    for (RAJA::Index_type j = 0; j < N; ++j) {
+      C(i, j) = static_cast<T>((i + j) % 3);
+
+      T sum = 0;
+      for (RAJA::Index_type k = 0; k < K; ++k) {
+        sum += A(i, k) * B(k, j);
+      }
+      ref_vec[i * N + j] = alpha * sum + beta * C(i, j);
+    }
+  }
+
+  RAJA::expt::matrix_multiply<ExecPolicy>(M, N, K, A, B, C, alpha, beta);
+
+  for (RAJA::Index_type i = 0; i < M; ++i) {
+    for (RAJA::Index_type j = 0; j < N; ++j) {
+      ASSERT_EQ(C(i, j), ref_vec[i * N + j]) << "at (" << i << ", " << j << ")";
+    }
+  }
+}
+
+//
+// Multiply batch pairs of n x n matrices held in 3D Views.
+//
+template <typename ExecPolicy, typename T>
+void testBatchedMatrixMultiply(RAJA::Index_type batch, RAJA::Index_type n)
+{
+  std::vector<T> a_vec(batch * n * n);
+  std::vector<T> b_vec(batch * n * n);
+  std::vector<T> c_vec(batch * n * n);
+
+  RAJA::View<T, RAJA::Layout<3>> A(a_vec.data(), batch, n, n);
+  RAJA::View<T, RAJA::Layout<3>> B(b_vec.data(), batch, n, n);
+  RAJA::View<T, RAJA::Layout<3>> C(c_vec.data(), batch, n, n);
+
+  for (RAJA::Index_type m = 0; m < batch; ++m) {
+    for (RAJA::Index_type i = 0; i < n; ++i) {
+      for (RAJA::Index_type j = 0; j < n; ++j) {
+        A(m, i, j) = static_cast<T>((m + i + 2 * j) % 5) - 2;
+        B(m, i, j) = static_cast<T>((2 * m + 3 * i + j) % 7) - 3;
+        C(m, i, j) = static_cast<T>(-1);
+      }
+    }
+  }
+
+  RAJA::expt::batched_matrix_multiply<ExecPolicy>(batch, n, n, n, A, B, C);
+
+  for (RAJA::Index_type m = 0; m < batch; ++m) {
+    for (RAJA::Index_type i = 0; i < n; ++i) {
+      for (RAJA::Index_type j = 0; j < n; ++j) {
+        T sum = 0;
+        for (RAJA::Index_type k = 0; k < n; ++k) {
+          sum += A(m, i, k) * B(m, k, j);
+        }
+        ASSERT_EQ(C(m, i, j), sum)
+            << "matrix " << m << " at (" << i << ", " << j << ")";
+      }
+    }
+  }
+}
+
+template <typename ExecPolicy, typename T>
+void testMatrixMultiplySizes()
+{
+  // sizes smaller than, equal to, and just past the register and cache
+  // block sizes, including K == 0 which only scales C
+  testMatrixMultiply<ExecPolicy, T>(1, 1, 1, 1, 0);
+  testMatrixMultiply<ExecPolicy, T>(7, 5, 3, 1, 0);
+  testMatrixMultiply<ExecPolicy, T>(64, 128, 256, 1, 0);
+  testMatrixMultiply<ExecPolicy, T>(65, 129, 257, 2, 3);
+  testMatrixMultiply<ExecPolicy, T>(150, 37, 600, 1, 1);
+  testMatrixMultiply<ExecPolicy, T>(9, 11, 0, 1, 2);
+
+  for (RAJA::Index_type n : {8, 13, 16, 32, 64}) {
+    testBatchedMatrixMultiply<ExecPolicy, T>(40, n);
+  }
+}
+
+TEST(TensorMatrixMultiply, Sequential)
+{
+  testMatrixMultiplySizes<RAJA::seq_exec, double>();
+  testMatrixMultiplySizes<RAJA::seq_exec, int64_t>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(TensorMatrixMultiply, OpenMP)
+{
+  testMatrixMultiplySizes<RAJA::omp_parallel_for_exec, double>();
+  testMatrixMultiplySizes<RAJA::omp_parallel_for_exec, int64_t>();
+}
+#endif
@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for forall with simd_register_exec.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+//
+// y[i] = a * x[i] + y[i] over a range segment of length n starting at 3,
+// so every chunk is unaligned and the last one is partial for most n.
+//
+template <typename T>
+void testSimdRegisterForallRange(RAJA::Index_type n)
+{
+  using chunk_type = RAJA::expt::SimdIndex<T>;
+  using register_type = typename chunk_type::register_type;
+
+  const RAJA::Index_type begin = 3;
+  std::vector<T> x(begin + n + 8);
+  std::vector<T> y(begin + n + 8);
+  std::vector<T> ref(begin + n + 8);
+  for (size_t i = 0; i < x.size(); ++i) {
+    x[i] = static_cast<T>(i % 11);
+    y[i] = static_cast<T>(i % 5);
+    ref[i] = y[i];
+  }
+  for (RAJA::Index_type i = begin; i < begin + n; ++i) {
+    ref[i] = 2 * x[i] + y[i];
+  }
+
+  T const* x_ptr = x.data();
+  T* y_ptr = y.data();
+  RAJA::forall<RAJA::expt::simd_register_exec<T>>(
+      RAJA::TypedRangeSegment<RAJA::Index_type>(begin, begin + n),
+      [=](chunk_type i) {
+        ASSERT_TRUE(i.is_contiguous());
+        register_type a(2);
+        i.store(y_ptr, a * i.load(x_ptr) + i.load(y_ptr));
+      });
+
+  for (size_t i = 0; i < y.size(); ++i) {
+    ASSERT_EQ(y[i], ref[i]) << "n = " << n << " at " << i;
+  }
+}
+
+//
+// The same update over a list segment with indices out of order, so loads
+// and stores are gathers and scatters.
+//
+template <typename T>
+void testSimdRegisterForallList(RAJA::Index_type n)
+{
+  using chunk_type = RAJA::expt::SimdIndex<T>;
+  using register_type = typename chunk_type::register_type;
+
+  const RAJA::Index_type len = 3 * n + 8;
+  std::vector<RAJA::Index_type> indices(n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    indices[i] = (7 * i + 5) % len;
+  }
+
+  std::vector<T> x(len);
+  std::vector<T> y(len);
+  std::vector<T> ref(len);
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    x[i] = static_cast<T>(i % 11);
+    y[i] = static_cast<T>(i % 5);
+    ref[i] = y[i];
+  }
+  for (RAJA::Index_type i : indices) {
+    ref[i] = 2 * x[i] + ref[i];
+  }
+
+  camp::resources::Resource host_res{camp::resources::Host()};
+  RAJA::TypedListSegment<RAJA::Index_type> seg(indices.data(), n, host_res);
+
+  T const* x_ptr = x.data();
+  T* y_ptr = y.data();
+  RAJA::forall<RAJA::expt::simd_register_exec<T>>(seg, [=](chunk_type i) {
+    ASSERT_FALSE(i.is_contiguous());
+    register_type a(2);
+    i.store(y_ptr, a * i.load(x_ptr) + i.load(y_ptr));
+  });
+
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    ASSERT_EQ(y[i], ref[i]) << "n = " << n << " at " << i;
+  }
+}
+
+template <typename T>
+void testSimdRegisterForallSizes()
+{
+  constexpr RAJA::Index_type width = RAJA::expt::SimdIndex<T>::s_num_elem;
+
+  for (RAJA::Index_type n :
+       {RAJA::Index_type(0), RAJA::Index_type(1), width - 1, width, width + 1,
+        3 * width + 2, RAJA::Index_type(1000)}) {
+    testSimdRegisterForallRange<T>(n);
+    testSimdRegisterForallList<T>(n);
+  }
+}
+
+TEST(TensorSimdRegisterForall, Double)
+{
+  testSimdRegisterForallSizes<double>();
+}
+
+TEST(TensorSimdRegisterForall, Float)
+{
+  testSimdRegisterForallSizes<float>();
+}
+
+TEST(TensorSimdRegisterForall, Int64)
+{
+  testSimdRegisterForallSizes<int64_t>();
+}
+
+TEST(TensorSimdRegisterForall, Int32)
+{
+  testSimdRegisterForallSizes<int32_t>();
+}
@@ -26,6 +26,11 @@ using SequentialResourceList = HostResourceList;
 using OpenMPResourceList = HostResourceList;
 #endif
 
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadsResourceList = HostResourceList;
+using HostAsyncResourceList = camp::list<RAJA::resources::HostAsync>;
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 using CudaResourceList = camp::list<camp::resources::Cuda>;
 #endif
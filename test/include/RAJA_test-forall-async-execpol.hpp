@@ -30,6 +30,12 @@ using OpenMPAsyncForallAtomicExecPols = OpenMPForallAtomicExecPols;
 
 #endif  // RAJA_ENABLE_OPENMP
 
+#if defined(RAJA_ENABLE_THREADS)
+
+using HostAsyncAsyncForallExecPols = HostAsyncForallExecPols;
+
+#endif  // RAJA_ENABLE_THREADS
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetAsyncForallExecPols = OpenMPTargetForallExecPols;
 using OpenMPTargetAsyncForallReduceExecPols = OpenMPTargetForallReduceExecPols;
@@ -34,8 +34,16 @@ using OpenMPForallExecPols =
  
               , RAJA::omp_parallel_for_static_exec< >
               , RAJA::omp_parallel_for_static_exec<4>
+              , RAJA::omp_parallel_for_fixed_static_exec
+
+              , RAJA::omp_parallel_for_scan_single_pass_exec
+
+              , RAJA::omp_parallel_ws_exec< >
+              , RAJA::omp_parallel_ws_exec<4>
 
 #if defined(RAJA_TEST_EXHAUSTIVE)
+              , RAJA::omp_parallel_for_scan_three_pass_exec
+
               , RAJA::omp_parallel_for_dynamic_exec< >
               , RAJA::omp_parallel_for_dynamic_exec<4>
 
@@ -55,6 +63,9 @@ using OpenMPForallExecPols =
               , RAJA::omp_parallel_exec<RAJA::omp_for_nowait_static_exec<4>>
               , RAJA::omp_parallel_exec<RAJA::omp_for_nowait_schedule_exec<RAJA::policy::omp::Static<4>>>
 
+              , RAJA::omp_parallel_exec<RAJA::omp_for_fixed_static_exec>
+              , RAJA::omp_parallel_exec<RAJA::omp_for_nowait_fixed_static_exec>
+
               , RAJA::omp_parallel_exec<RAJA::omp_for_dynamic_exec< >>
               , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Dynamic< >>>
               , RAJA::omp_parallel_exec<RAJA::omp_for_dynamic_exec<8>>
@@ -67,6 +78,9 @@ using OpenMPForallExecPols =
 
               , RAJA::omp_parallel_exec<RAJA::omp_for_runtime_exec>
               , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Runtime>>
+
+              , RAJA::omp_parallel_exec<RAJA::omp_ws_exec< >>
+              , RAJA::omp_parallel_exec<RAJA::omp_ws_exec<8>>
 #endif       
              >;
 
@@ -80,6 +94,7 @@ using OpenMPForallAtomicExecPols =
               , RAJA::omp_parallel_for_static_exec<4>
               , RAJA::omp_parallel_exec<RAJA::omp_for_nowait_static_exec< >>
               , RAJA::omp_parallel_exec<RAJA::omp_for_nowait_static_exec<4>>
+              , RAJA::omp_parallel_for_fixed_static_exec
 
               , RAJA::omp_parallel_for_dynamic_exec< >
               , RAJA::omp_parallel_for_dynamic_exec<2>
@@ -88,11 +103,23 @@ using OpenMPForallAtomicExecPols =
               , RAJA::omp_parallel_for_guided_exec<3>
 
               , RAJA::omp_parallel_for_runtime_exec
+
+              , RAJA::omp_parallel_ws_exec< >
 #endif
             >; 
 
 #endif  // RAJA_ENABLE_OPENMP
 
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadsForallExecPols = camp::list< RAJA::threads_exec >;
+
+using ThreadsForallReduceExecPols = ThreadsForallExecPols;
+
+// Host execution policies enqueued on HostAsync resources
+using HostAsyncForallExecPols = camp::list< RAJA::seq_exec,
+                                            RAJA::threads_exec >;
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetForallExecPols =
   camp::list< RAJA::omp_target_parallel_for_exec<8>,
@@ -35,6 +35,13 @@ using OpenMPForallIndexSetReduceExecPols =
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec> >;
 #endif
 
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadsForallIndexSetExecPols =
+  camp::list< RAJA::ExecPolicy<RAJA::seq_segit, RAJA::threads_exec> >;
+
+using ThreadsForallIndexSetReduceExecPols = ThreadsForallIndexSetExecPols;
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetForallIndexSetExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::seq_segit,
@@ -31,12 +31,30 @@ using omp_policies = camp::list<
          RAJA::LoopPolicy<RAJA::omp_for_exec>
   >;
 
+using omp_ws_policies = camp::list<
+         RAJA::LaunchPolicy<RAJA::omp_launch_t>,
+         RAJA::LoopPolicy<RAJA::omp_ws_exec< >>
+  >;
+
 using OpenMP_launch_policies = camp::list<
-  omp_policies
+  omp_policies,
+  omp_ws_policies
   >;
 
 #endif  // RAJA_ENABLE_OPENMP
 
+#if defined(RAJA_ENABLE_THREADS)
+using threads_policies = camp::list<
+         RAJA::LaunchPolicy<RAJA::threads_launch_t>,
+         RAJA::LoopPolicy<RAJA::threads_for_exec>
+  >;
+
+using Threads_launch_policies = camp::list<
+  threads_policies
+  >;
+
+#endif  // RAJA_ENABLE_THREADS
+
 #if defined(RAJA_ENABLE_CUDA)
 
 using cuda_policies = camp::list<
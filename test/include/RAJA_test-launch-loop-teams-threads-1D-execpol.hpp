@@ -33,8 +33,15 @@ using omp_policies = camp::list<
          RAJA::LoopPolicy<RAJA::seq_exec>
   >;
 
+using omp_teams_policies = camp::list<
+         RAJA::LaunchPolicy<RAJA::omp_launch_teams_t<2>>,
+         RAJA::LoopPolicy<RAJA::omp_launch_team_loop>,
+         RAJA::LoopPolicy<RAJA::omp_launch_thread_loop>
+  >;
+
 using OpenMP_launch_policies = camp::list<
-  omp_policies
+  omp_policies,
+  omp_teams_policies
   >;
 
 #endif  // RAJA_ENABLE_OPENMP
@@ -21,7 +21,8 @@ using SequentialMultiReducePols = camp::list< RAJA::seq_multi_reduce >;
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPMultiReducePols =
   camp::list< RAJA::omp_multi_reduce,
-              RAJA::omp_multi_reduce_ordered >;
+              RAJA::omp_multi_reduce_ordered,
+              RAJA::omp_multi_reduce_combine_in_parallel >;
 #endif
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -24,8 +24,13 @@ using OpenMPReducePols =
   camp::list< RAJA::omp_reduce,
               RAJA::omp_reduce_ordered >;
 #else
-  camp::list< RAJA::omp_reduce >;
+  camp::list< RAJA::omp_reduce,
+              RAJA::omp_reduce_combine_on_get >;
+#endif
 #endif
+
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadsReducePols = camp::list< RAJA::threads_reduce >;
 #endif
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
@@ -345,10 +345,16 @@ using SequentialStoragePolicyList =
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPExecPolicyList =
     camp::list<
-                RAJA::omp_work
+                RAJA::omp_work,
+                RAJA::omp_ws_work< >
               >;
 using OpenMPOrderedPolicyList = SequentialOrderedPolicyList;
-using OpenMPOrderPolicyList   = SequentialOrderPolicyList;
+using OpenMPOrderPolicyList   =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered,
+                RAJA::unordered_omp_flattened_loop_iter
+              >;
 using OpenMPStoragePolicyList = SequentialStoragePolicyList;
 #endif
 
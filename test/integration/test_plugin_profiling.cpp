@@ -0,0 +1,143 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/util/ProfilingPlugin.hpp"
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if !defined(RAJA_ENABLE_PROFILING_PLUGIN)
+// Statically loading plugin, it is already registered by RAJA otherwise.
+static RAJA::util::PluginRegistry::add<RAJA::util::ProfilingPlugin> P("ProfilingPlugin", "Profiling");
+#endif
+
+namespace {
+
+const RAJA::util::ProfilingRecord* findRecord(
+    const std::vector<RAJA::util::ProfilingRecord>& records,
+    const std::string& name)
+{
+  for (const RAJA::util::ProfilingRecord& record : records) {
+    if (record.name == name) {
+      return &record;
+    }
+  }
+  return nullptr;
+}
+
+}  // end anonymous namespace
+
+TEST(PluginTestProfiling, Forall)
+{
+  RAJA::util::resetProfilingRecords();
+
+  std::vector<int> a(100, 0);
+  int* a_ptr = a.data();
+
+  for (int rep = 0; rep < 3; ++rep) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 100),
+                                 RAJA::expt::KernelName("profiled-forall"),
+                                 [=](int i) { a_ptr[i] += 1; });
+  }
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 10),
+                               [=](int i) { a_ptr[i] += 1; });
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  iset.push_back(RAJA::RangeSegment(0, 20));
+  iset.push_back(RAJA::RangeSegment(50, 80));
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, RAJA::expt::KernelName("profiled-indexset"),
+      [=](int i) { a_ptr[i] += 1; });
+
+  std::vector<RAJA::util::ProfilingRecord> records =
+      RAJA::util::getProfilingRecords();
+
+  const RAJA::util::ProfilingRecord* named =
+      findRecord(records, "profiled-forall");
+  ASSERT_NE(named, nullptr);
+  ASSERT_EQ(named->platform, RAJA::Platform::host);
+  ASSERT_EQ(named->calls, 3u);
+  ASSERT_EQ(named->iterations, 300u);
+  ASSERT_GE(named->seconds, 0.0);
+
+  const RAJA::util::ProfilingRecord* unnamed =
+      findRecord(records, "<unnamed>");
+  ASSERT_NE(unnamed, nullptr);
+  ASSERT_EQ(unnamed->calls, 1u);
+  ASSERT_EQ(unnamed->iterations, 10u);
+
+  const RAJA::util::ProfilingRecord* indexset =
+      findRecord(records, "profiled-indexset");
+  ASSERT_NE(indexset, nullptr);
+  ASSERT_EQ(indexset->calls, 1u);
+  ASSERT_EQ(indexset->iterations, 50u);
+
+  for (size_t r = 1; r < records.size(); ++r) {
+    ASSERT_GE(records[r-1].seconds, records[r].seconds);
+  }
+}
+
+TEST(PluginTestProfiling, FusedForall)
+{
+  RAJA::util::resetProfilingRecords();
+
+  std::vector<int> a(100, 0);
+  std::vector<int> b(100, 0);
+  int* a_ptr = a.data();
+  int* b_ptr = b.data();
+
+  RAJA::expt::fused_forall<RAJA::seq_exec>(
+      RAJA::RangeSegment(0, 100),
+      [=](int i) { a_ptr[i] += 1; },
+      [=](int i) { b_ptr[i] += a_ptr[i]; });
+
+  std::vector<RAJA::util::ProfilingRecord> records =
+      RAJA::util::getProfilingRecords();
+
+  // the fused loop is one launch
+  const RAJA::util::ProfilingRecord* fused =
+      findRecord(records, "<unnamed>");
+  ASSERT_NE(fused, nullptr);
+  ASSERT_EQ(fused->calls, 1u);
+  ASSERT_EQ(fused->iterations, 100u);
+}
+
+TEST(PluginTestProfiling, Launch)
+{
+  RAJA::util::resetProfilingRecords();
+
+  using launch_policy = RAJA::LaunchPolicy<RAJA::seq_launch_t>;
+  using loop_policy = RAJA::LoopPolicy<RAJA::seq_exec>;
+
+  std::vector<int> a(10, 0);
+  int* a_ptr = a.data();
+
+  RAJA::launch<launch_policy>(
+      RAJA::LaunchParams(), "profiled-launch",
+      [=](RAJA::LaunchContext ctx) {
+        RAJA::loop<loop_policy>(ctx, RAJA::RangeSegment(0, 10), [&](int i) {
+          a_ptr[i] += 1;
+        });
+      });
+
+  std::vector<RAJA::util::ProfilingRecord> records =
+      RAJA::util::getProfilingRecords();
+
+  const RAJA::util::ProfilingRecord* launched =
+      findRecord(records, "profiled-launch");
+  ASSERT_NE(launched, nullptr);
+  ASSERT_EQ(launched->calls, 1u);
+  ASSERT_EQ(launched->iterations, 0u);
+
+  std::ostringstream report;
+  RAJA::util::writeProfilingReport(report);
+  ASSERT_NE(report.str().find("profiled-launch"), std::string::npos);
+}
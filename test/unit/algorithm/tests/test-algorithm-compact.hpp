@@ -0,0 +1,162 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for copy_if, partition, stable_partition,
+/// unique, and unique_by_key
+///
+
+#ifndef __TEST_UNIT_ALGORITHM_COMPACT_HPP__
+#define __TEST_UNIT_ALGORITHM_COMPACT_HPP__
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using SequentialCompactExecPols = camp::list< RAJA::seq_exec >;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMPCompactExecPols = camp::list< RAJA::omp_parallel_for_exec >;
+#endif
+
+using CompactValueTypeList = camp::list< int, double >;
+
+
+template <typename T>
+struct CompactIsMultipleOfThree
+{
+  bool operator()(T const& v) const
+  {
+    return static_cast<long>(v) % 3 == 0;
+  }
+};
+
+template <typename EXEC_POLICY, typename RES, typename T>
+void testCompact(RAJA::Index_type N, unsigned seed)
+{
+  RES res = RES::get_default();
+
+  // values with runs of repeated items for unique
+  std::mt19937 gen(seed);
+  std::vector<T> in(N);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    in[i] = (i > 0 && gen() % 3 == 0) ? in[i - 1] : static_cast<T>(gen() % 100);
+  }
+
+  CompactIsMultipleOfThree<T> pred;
+
+  // copy_if
+  {
+    std::vector<T> out(N);
+    std::vector<T> expected;
+    std::copy_if(in.begin(), in.end(), std::back_inserter(expected), pred);
+
+    auto count = RAJA::copy_if<EXEC_POLICY>(RAJA::make_span(in.data(), N),
+                                            RAJA::make_span(out.data(), N),
+                                            pred);
+
+    ASSERT_EQ(count, static_cast<decltype(count)>(expected.size()));
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_EQ(out[i], expected[i]) << "copy_if N " << N << " at " << i;
+    }
+  }
+
+  // stable_partition
+  {
+    std::vector<T> c(in);
+    std::vector<T> expected(in);
+    auto expected_count =
+        std::stable_partition(expected.begin(), expected.end(), pred) -
+        expected.begin();
+
+    auto count = RAJA::stable_partition<EXEC_POLICY>(
+        res, RAJA::make_span(c.data(), N), pred);
+
+    ASSERT_EQ(count, expected_count);
+    ASSERT_EQ(c, expected) << "stable_partition N " << N;
+  }
+
+  // partition, only the groups are checked as the order is unspecified
+  {
+    std::vector<T> c(in);
+    auto count = RAJA::partition<EXEC_POLICY>(RAJA::make_span(c.data(), N),
+                                              pred);
+
+    ASSERT_EQ(count, std::count_if(in.begin(), in.end(), pred));
+    ASSERT_TRUE(std::all_of(c.begin(), c.begin() + count, pred));
+    ASSERT_TRUE(std::none_of(c.begin() + count, c.end(), pred));
+
+    std::vector<T> sorted(in);
+    std::sort(sorted.begin(), sorted.end());
+    std::sort(c.begin(), c.end());
+    ASSERT_EQ(c, sorted) << "partition N " << N;
+  }
+
+  // unique
+  {
+    std::vector<T> c(in);
+    std::vector<T> expected(in);
+    auto expected_count =
+        std::unique(expected.begin(), expected.end()) - expected.begin();
+
+    auto count = RAJA::unique<EXEC_POLICY>(res, RAJA::make_span(c.data(), N));
+
+    ASSERT_EQ(count, expected_count);
+    for (RAJA::Index_type i = 0; i < expected_count; ++i) {
+      ASSERT_EQ(c[i], expected[i]) << "unique N " << N << " at " << i;
+    }
+  }
+
+  // unique_by_key, values are the index of each key
+  {
+    std::vector<T> keys(in);
+    std::vector<RAJA::Index_type> vals(N);
+    for (RAJA::Index_type i = 0; i < N; ++i) {
+      vals[i] = i;
+    }
+
+    auto count = RAJA::unique_by_key<EXEC_POLICY>(
+        RAJA::make_span(keys.data(), N),
+        RAJA::make_span(vals.data(), N),
+        RAJA::operators::equal_to<T>{});
+
+    RAJA::Index_type expected_count = 0;
+    for (RAJA::Index_type i = 0; i < N; ++i) {
+      if (i == 0 || in[i] != in[i - 1]) {
+        ASSERT_LT(expected_count, count);
+        ASSERT_EQ(keys[expected_count], in[i]) << "unique_by_key N " << N;
+        ASSERT_EQ(vals[expected_count], i) << "unique_by_key N " << N;
+        ++expected_count;
+      }
+    }
+    ASSERT_EQ(count, expected_count);
+  }
+}
+
+
+TYPED_TEST_SUITE_P(CompactUnitTest);
+template <typename T>
+class CompactUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(CompactUnitTest, UnitCompact)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using RES         = typename camp::at<TypeParam, camp::num<1>>::type;
+  using T           = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // sizes within one tile, just past one tile, and of many tiles
+  for (RAJA::Index_type N : {0, 1, 2, 100, 10007, 1000003}) {
+    testCompact<EXEC_POLICY, RES, T>(N, static_cast<unsigned>(N));
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(CompactUnitTest,
+                            UnitCompact);
+
+#endif  // __TEST_UNIT_ALGORITHM_COMPACT_HPP__
@@ -0,0 +1,201 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for histogram and reduce_by_key
+///
+
+#ifndef __TEST_UNIT_ALGORITHM_HISTOGRAM_HPP__
+#define __TEST_UNIT_ALGORITHM_HISTOGRAM_HPP__
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+
+using SequentialHistogramExecPols = camp::list< RAJA::seq_exec >;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMPHistogramExecPols = camp::list< RAJA::omp_parallel_for_exec >;
+#endif
+
+using HistogramValueTypeList = camp::list< int, double >;
+
+
+template <typename EXEC_POLICY, typename RES, typename T>
+void testHistogram(RAJA::Index_type N, RAJA::Index_type num_bins, unsigned seed)
+{
+  RES res = RES::get_default();
+
+  std::mt19937 gen(seed);
+  std::vector<RAJA::Index_type> keys(N);
+  std::vector<T> vals(N);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    keys[i] = static_cast<RAJA::Index_type>(gen() % num_bins);
+    vals[i] = static_cast<T>(gen() % 100);
+  }
+
+  // histogram of values, combined into the initial bins
+  {
+    std::vector<T> bins(num_bins, T(1));
+    std::vector<T> expected(num_bins, T(1));
+    for (RAJA::Index_type i = 0; i < N; ++i) {
+      expected[keys[i]] += vals[i];
+    }
+
+    RAJA::histogram<EXEC_POLICY>(res,
+                                 RAJA::make_span(keys.data(), N),
+                                 RAJA::make_span(vals.data(), N),
+                                 RAJA::make_span(bins.data(), num_bins),
+                                 RAJA::operators::plus<T>{});
+
+    ASSERT_EQ(bins, expected) << "histogram N " << N << " bins " << num_bins;
+  }
+
+  // counting histogram
+  {
+    std::vector<T> bins(num_bins, T(0));
+    std::vector<T> expected(num_bins, T(0));
+    for (RAJA::Index_type i = 0; i < N; ++i) {
+      expected[keys[i]] += T(1);
+    }
+
+    RAJA::histogram<EXEC_POLICY>(RAJA::make_span(keys.data(), N),
+                                 RAJA::make_span(bins.data(), num_bins));
+
+    ASSERT_EQ(bins, expected) << "counting histogram N " << N << " bins "
+                              << num_bins;
+  }
+}
+
+template <typename EXEC_POLICY, typename RES, typename T>
+void testReduceByKey(RAJA::Index_type N, long long key_range, unsigned seed)
+{
+  RES res = RES::get_default();
+
+  std::mt19937_64 gen(seed);
+  std::vector<long long> keys(N);
+  std::vector<T> vals(N);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    keys[i] = static_cast<long long>(gen() % key_range) - key_range / 2;
+    vals[i] = static_cast<T>(gen() % 100);
+  }
+
+  std::map<long long, T> expected_sum;
+  std::map<long long, T> expected_max;
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    auto it = expected_max.find(keys[i]);
+    if (it == expected_max.end()) {
+      expected_sum[keys[i]] = vals[i];
+      expected_max[keys[i]] = vals[i];
+    } else {
+      expected_sum[keys[i]] += vals[i];
+      it->second = std::max(it->second, vals[i]);
+    }
+  }
+
+  std::vector<long long> keys_out(N);
+  std::vector<T> vals_out(N);
+
+  auto count = RAJA::reduce_by_key<EXEC_POLICY>(
+      RAJA::make_span(keys.data(), N),
+      RAJA::make_span(vals.data(), N),
+      RAJA::make_span(keys_out.data(), N),
+      RAJA::make_span(vals_out.data(), N));
+
+  ASSERT_EQ(count, static_cast<decltype(count)>(expected_sum.size()));
+  RAJA::Index_type i = 0;
+  for (auto const& kv : expected_sum) {
+    ASSERT_EQ(keys_out[i], kv.first) << "reduce_by_key N " << N << " at " << i;
+    ASSERT_EQ(vals_out[i], kv.second) << "reduce_by_key N " << N << " at " << i;
+    ++i;
+  }
+
+  count = RAJA::reduce_by_key<EXEC_POLICY>(
+      res,
+      RAJA::make_span(keys.data(), N),
+      RAJA::make_span(vals.data(), N),
+      RAJA::make_span(keys_out.data(), N),
+      RAJA::make_span(vals_out.data(), N),
+      RAJA::operators::maximum<T>{});
+
+  ASSERT_EQ(count, static_cast<decltype(count)>(expected_max.size()));
+  i = 0;
+  for (auto const& kv : expected_max) {
+    ASSERT_EQ(keys_out[i], kv.first) << "reduce_by_key max N " << N << " at " << i;
+    ASSERT_EQ(vals_out[i], kv.second) << "reduce_by_key max N " << N << " at " << i;
+    ++i;
+  }
+}
+
+
+TYPED_TEST_SUITE_P(HistogramUnitTest);
+template <typename T>
+class HistogramUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(HistogramUnitTest, UnitHistogram)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using RES         = typename camp::at<TypeParam, camp::num<1>>::type;
+  using T           = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // few bins, privatized by thread, and more bins than items, sparse
+  for (RAJA::Index_type N : {0, 1, 100, 100003}) {
+    for (RAJA::Index_type num_bins : {1, 100, 1000000}) {
+      testHistogram<EXEC_POLICY, RES, T>(N, num_bins,
+                                         static_cast<unsigned>(N + num_bins));
+    }
+  }
+}
+
+TYPED_TEST_P(HistogramUnitTest, UnitReduceByKey)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using RES         = typename camp::at<TypeParam, camp::num<1>>::type;
+  using T           = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  // keys in dense bins and keys too sparse for bins that are sorted
+  for (RAJA::Index_type N : {0, 1, 100, 100003}) {
+    for (long long key_range : {5LL, 1000LL, 1LL << 40}) {
+      testReduceByKey<EXEC_POLICY, RES, T>(N, key_range,
+                                           static_cast<unsigned>(N));
+    }
+  }
+}
+
+TYPED_TEST_P(HistogramUnitTest, UnitReduceByKeyNested)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using RES         = typename camp::at<TypeParam, camp::num<1>>::type;
+  using T           = typename camp::at<TypeParam, camp::num<2>>::type;
+
+#if defined(RAJA_ENABLE_OPENMP)
+  // inside a parallel region with nesting disabled parallel regions get
+  // one thread, fewer than they ask for
+  const int max_active_levels = omp_get_max_active_levels();
+  omp_set_max_active_levels(1);
+#pragma omp parallel num_threads(2)
+  {
+#pragma omp single
+    for (long long key_range : {5LL, 1LL << 40}) {
+      testReduceByKey<EXEC_POLICY, RES, T>(100003, key_range, 7u);
+    }
+  }
+  omp_set_max_active_levels(max_active_levels);
+#else
+  testReduceByKey<EXEC_POLICY, RES, T>(100003, 1LL << 40, 7u);
+#endif
+}
+
+REGISTER_TYPED_TEST_SUITE_P(HistogramUnitTest,
+                            UnitHistogram,
+                            UnitReduceByKey,
+                            UnitReduceByKeyNested);
+
+#endif  // __TEST_UNIT_ALGORITHM_HISTOGRAM_HPP__
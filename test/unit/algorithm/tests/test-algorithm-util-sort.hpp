@@ -57,6 +57,12 @@ struct MergeSort;
 template < typename test_policy, typename platform = test_platform<test_policy> >
 struct MergeSortPairs;
 
+template < typename test_policy, typename platform = test_platform<test_policy> >
+struct RadixSort;
+
+template < typename test_policy, typename platform = test_platform<test_policy> >
+struct RadixSortPairs;
+
 
 template < typename test_policy >
 struct InsertionSort<test_policy, RunOnHost>
@@ -283,6 +289,49 @@ struct MergeSortPairs<test_policy, RunOnHost>
   }
 };
 
+template < typename test_policy >
+struct RadixSort<test_policy, RunOnHost>
+  : ForoneSynchronize<test_policy>
+{
+  using sort_category = stable_sort_tag;
+  using sort_interface = sort_interface_tag;
+  using supports_resource = std::false_type;
+
+  const char* name()
+  {
+    return "RAJA::radix_sort";
+  }
+
+  template < typename... Args >
+  void operator()(Args&&... args)
+  {
+    RAJA::radix_sort(std::forward<Args>(args)...);
+  }
+};
+
+template < typename test_policy >
+struct RadixSortPairs<test_policy, RunOnHost>
+  : ForoneSynchronize<test_policy>
+{
+  using sort_category = stable_sort_tag;
+  using sort_interface = sort_pairs_interface_tag;
+  using supports_resource = std::false_type;
+
+  const char* name()
+  {
+    return "RAJA::radix_sort_pairs";
+  }
+
+  template < typename KeyContainer, typename ValContainer,
+             typename Compare = RAJA::operators::less<RAJA::detail::ContainerVal<KeyContainer>>>
+  void operator()(KeyContainer&& keys,
+                  ValContainer&& vals,
+                  Compare comp = Compare{})
+  {
+    RAJA::radix_sort_pairs(keys, vals, comp);
+  }
+};
+
 #if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
 
 template < typename test_policy >
@@ -663,6 +712,12 @@ using SequentialMergeSortSorters =
               MergeSortPairs<test_seq>
             >;
 
+using SequentialRadixSortSorters =
+  camp::list<
+              RadixSort<test_seq>,
+              RadixSortPairs<test_seq>
+            >;
+
 #if defined(RAJA_ENABLE_CUDA)
 
 using CudaInsertionSortSorters =
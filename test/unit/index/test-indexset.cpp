@@ -13,6 +13,10 @@
 
 #include "camp/resource.hpp"
 
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
 //
 // Resource object used to construct list segment objects with indices
 // living in host (CPU) memory. Used in all tests.
@@ -224,3 +228,106 @@ TEST(IndexSetUnitTest, ConditionalLessThan100Indices)
     EXPECT_EQ(lt100_indices[i], ref_lt100_indices[i]);
   }
 }
+
+TEST(IndexSetUnitTest, DependencyGraph)
+{
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  using RIndexSetType = RAJA::TypedIndexSet<RangeSegType>;
+  RIndexSetType iset;
+
+  for (int i = 0; i < 4; ++i) {
+    iset.push_back(RangeSegType(10 * i, 10 * (i + 1)));
+  }
+  ASSERT_FALSE(iset.dependencyGraphSet());
+
+  // diamond: 0 -> {1, 2} -> 3
+  iset.initDependencyGraph();
+  iset.addSegmentDependency(1, 0);
+  iset.addSegmentDependency(2, 0);
+  iset.addSegmentDependency(3, 1);
+  iset.addSegmentDependency(3, 2);
+  ASSERT_FALSE(iset.dependencyGraphSet());
+  iset.finalizeDependencyGraph();
+  ASSERT_TRUE(iset.dependencyGraphSet());
+
+  ASSERT_EQ(0, iset.getDepGraphNode(0).semaphoreReloadValue());
+  ASSERT_EQ(1, iset.getDepGraphNode(1).semaphoreReloadValue());
+  ASSERT_EQ(1, iset.getDepGraphNode(2).semaphoreReloadValue());
+  ASSERT_EQ(2, iset.getDepGraphNode(3).semaphoreReloadValue());
+
+  ASSERT_EQ(2, iset.getDepGraphNode(0).numDepTasks());
+  ASSERT_EQ(1, iset.getDepGraphNode(0).depTaskNum(0));
+  ASSERT_EQ(2, iset.getDepGraphNode(0).depTaskNum(1));
+  ASSERT_EQ(0, iset.getDepGraphNode(3).numDepTasks());
+
+  // copies keep the graph, adding a segment discards it
+  RIndexSetType iset_copy(iset);
+  ASSERT_TRUE(iset_copy.dependencyGraphSet());
+  iset_copy.push_back(RangeSegType(40, 50));
+  ASSERT_FALSE(iset_copy.dependencyGraphSet());
+
+  EXPECT_THROW(iset.addSegmentDependency(4, 0), std::runtime_error);
+  EXPECT_THROW(iset.addSegmentDependency(1, 1), std::runtime_error);
+
+  iset.addSegmentDependency(0, 3);
+  EXPECT_THROW(iset.finalizeDependencyGraph(), std::runtime_error);
+  ASSERT_FALSE(iset.dependencyGraphSet());
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(IndexSetUnitTest, OpenMPTaskGraphExecution)
+{
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  using RIndexSetType = RAJA::TypedIndexSet<RangeSegType>;
+
+  // blocks of a 2D grid swept as a wavefront, block (i, j) depends on
+  // blocks (i-1, j) and (i, j-1)
+  constexpr int nblocks = 16;
+  constexpr int block_size = 8;
+  RIndexSetType iset;
+  for (int b = 0; b < nblocks * nblocks; ++b) {
+    iset.push_back(RangeSegType(b * block_size, (b + 1) * block_size));
+  }
+  iset.initDependencyGraph();
+  for (int i = 0; i < nblocks; ++i) {
+    for (int j = 0; j < nblocks; ++j) {
+      if (i > 0) {
+        iset.addSegmentDependency(i * nblocks + j, (i - 1) * nblocks + j);
+      }
+      if (j > 0) {
+        iset.addSegmentDependency(i * nblocks + j, i * nblocks + j - 1);
+      }
+    }
+  }
+  iset.finalizeDependencyGraph();
+
+  // each index records the value of the blocks it depends on, which are
+  // only complete when the dependencies were respected
+  std::vector<int> value(nblocks * nblocks * block_size, 0);
+  int* val = value.data();
+
+  using EXEC_POL = RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>;
+
+  for (int rep = 0; rep < 4; ++rep) {
+    std::fill(value.begin(), value.end(), 0);
+
+    RAJA::forall<EXEC_POL>(iset, [=](int idx) {
+      const int b = idx / block_size;
+      const int i = b / nblocks;
+      const int j = b % nblocks;
+      const int up = (i > 0) ? val[((b - nblocks) + 1) * block_size - 1] : 0;
+      const int left = (j > 0) ? val[b * block_size - 1] : 0;
+      val[idx] = 1 + ((up > left) ? up : left);
+    });
+
+    for (int i = 0; i < nblocks; ++i) {
+      for (int j = 0; j < nblocks; ++j) {
+        const int b = i * nblocks + j;
+        for (int k = 0; k < block_size; ++k) {
+          ASSERT_EQ(i + j + 1, value[b * block_size + k]);
+        }
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,67 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for getting OpenMP multi-reducer values
+/// inside parallel loops.
+///
+
+#include <vector>
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+#include "RAJA_test-multi-reducepol.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+template <typename T>
+class MultiReducerGetOpenMPUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(MultiReducerGetOpenMPUnitTest);
+
+TYPED_TEST_P(MultiReducerGetOpenMPUnitTest, GetInsideParallel)
+{
+  using MultiReducePolicy = TypeParam;
+
+  constexpr int num_bins = 100;
+  constexpr int N = 100000;
+
+  RAJA::MultiReduceSum<MultiReducePolicy, int> sums(num_bins, 5);
+
+  RAJA::forall<RAJA::omp_parallel_for_exec>(
+      RAJA::TypedRangeSegment<int>(0, N), [=](int i) {
+        sums[i % num_bins] += 1;
+      });
+
+  std::vector<int> out(num_bins, 0);
+  int* out_ptr = out.data();
+
+  for (int rep = 0; rep < 2; ++rep) {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::TypedRangeSegment<int>(0, num_bins), [=](int bin) {
+          out_ptr[bin] = sums.get(bin);
+        });
+
+    for (int bin = 0; bin < num_bins; ++bin) {
+      ASSERT_EQ(out[bin], 5 + N / num_bins);
+      ASSERT_EQ(sums.get(bin), 5 + N / num_bins);
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(MultiReducerGetOpenMPUnitTest,
+                            GetInsideParallel);
+
+using OpenMPMultiReducerGetTypes = Test<OpenMPMultiReducePols>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMPGetTest,
+                               MultiReducerGetOpenMPUnitTest,
+                               OpenMPMultiReducerGetTypes);
+
+#endif
@@ -0,0 +1,71 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for OpenMP reducers used in nested
+/// parallel regions.
+///
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+#include "RAJA_test-reducepol.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+template <typename T>
+class ReducerNestedOpenMPUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(ReducerNestedOpenMPUnitTest);
+
+TYPED_TEST_P(ReducerNestedOpenMPUnitTest, ForallInsideParallel)
+{
+  using ReducePolicy = TypeParam;
+
+  constexpr int N = 1000;
+
+  // the inner parallel regions run serialized, so every outer thread has
+  // thread number 0 in its inner region
+  const int max_active_levels = omp_get_max_active_levels();
+  omp_set_max_active_levels(1);
+
+  RAJA::ReduceSum<ReducePolicy, int> sum(0);
+  RAJA::ReduceMax<ReducePolicy, int> max(-1);
+
+  int num_outer_threads = 0;
+
+#pragma omp parallel num_threads(4)
+  {
+#pragma omp single
+    num_outer_threads = omp_get_num_threads();
+
+    const int outer = omp_get_thread_num();
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::TypedRangeSegment<int>(0, N), [=](int i) {
+          sum += 1;
+          max.max(outer * N + i);
+        });
+  }
+
+  omp_set_max_active_levels(max_active_levels);
+
+  ASSERT_EQ(sum.get(), num_outer_threads * N);
+  ASSERT_EQ(max.get(), num_outer_threads * N - 1);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ReducerNestedOpenMPUnitTest,
+                            ForallInsideParallel);
+
+using OpenMPReducerNestedTypes = Test<OpenMPReducePols>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMPNestedTest,
+                               ReducerNestedOpenMPUnitTest,
+                               OpenMPReducerNestedTypes);
+
+#endif
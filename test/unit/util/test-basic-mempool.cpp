@@ -0,0 +1,181 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for basic_mempool::MemPool
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/basic_mempool.hpp"
+
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+using TestMemPool =
+    RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>;
+
+TEST(BasicMemPoolUnitTest, MallocFree)
+{
+  TestMemPool pool;
+
+  const size_t sizes[] = {1, 8, 63, 64, 65, 1000,
+                          TestMemPool::max_size_class_bytes,
+                          TestMemPool::max_size_class_bytes + 1,
+                          100000};
+  const size_t alignment = 64;
+
+  std::vector<char*> ptrs;
+  for (size_t size : sizes) {
+    for (int i = 0; i < 20; ++i) {
+      char* ptr = pool.malloc<char>(size, alignment);
+      ASSERT_NE(ptr, nullptr);
+      ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0u);
+      for (size_t j = 0; j < size; ++j) {
+        ptr[j] = static_cast<char>(i);
+      }
+      ptrs.push_back(ptr);
+    }
+  }
+
+  std::set<char*> unique_ptrs(ptrs.begin(), ptrs.end());
+  ASSERT_EQ(unique_ptrs.size(), ptrs.size());
+
+  for (char* ptr : ptrs) {
+    pool.free(ptr);
+  }
+
+  RAJA::basic_mempool::MemPoolStatistics stats = pool.get_statistics();
+  ASSERT_EQ(stats.num_mallocs, ptrs.size());
+  ASSERT_EQ(stats.num_frees, ptrs.size());
+  ASSERT_EQ(stats.num_thread_cache_mallocs + stats.num_size_class_mallocs,
+            7u * 20u);
+  ASSERT_EQ(stats.num_arena_mallocs, 2u * 20u);
+  ASSERT_GT(stats.num_backing_allocations, 0u);
+
+  pool.reset_statistics();
+  stats = pool.get_statistics();
+  ASSERT_EQ(stats.num_mallocs, 0u);
+
+  pool.free_chunks();
+}
+
+TEST(BasicMemPoolUnitTest, ReuseSizeClass)
+{
+  TestMemPool pool;
+
+  double* first = pool.malloc<double>(4);
+  ASSERT_NE(first, nullptr);
+  pool.free(first);
+
+  const size_t num_backing = pool.get_statistics().num_backing_allocations;
+  for (int i = 0; i < 1000; ++i) {
+    double* ptr = pool.malloc<double>(4);
+    ASSERT_NE(ptr, nullptr);
+    pool.free(ptr);
+  }
+  ASSERT_EQ(pool.get_statistics().num_backing_allocations, num_backing);
+
+  pool.free_chunks();
+}
+
+TEST(BasicMemPoolUnitTest, SeparatePools)
+{
+  TestMemPool pool_a;
+  TestMemPool pool_b;
+
+  double* a = pool_a.malloc<double>(4);
+  ASSERT_NE(a, nullptr);
+  pool_a.free(a);
+
+  double* b = pool_b.malloc<double>(4);
+  ASSERT_NE(b, nullptr);
+  ASSERT_NE(b, a);
+  pool_b.free(b);
+
+  // each pool gets back its own block
+  ASSERT_EQ(pool_a.malloc<double>(4), a);
+  ASSERT_EQ(pool_b.malloc<double>(4), b);
+  pool_a.free(a);
+  pool_b.free(b);
+
+  ASSERT_EQ(pool_a.get_statistics().num_mallocs, 2u);
+  ASSERT_EQ(pool_b.get_statistics().num_mallocs, 2u);
+
+  pool_a.free_chunks();
+  pool_b.free_chunks();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(BasicMemPoolUnitTest, ThreadExit)
+{
+  TestMemPool pool;
+
+  double* ptr = nullptr;
+  std::thread thread([&]() {
+    ptr = pool.malloc<double>(4);
+    pool.free(ptr);
+  });
+  thread.join();
+  ASSERT_NE(ptr, nullptr);
+
+  // the block cached by the exited thread was returned to the pool
+  ASSERT_EQ(pool.malloc<double>(4), ptr);
+  pool.free(ptr);
+
+  RAJA::basic_mempool::MemPoolStatistics stats = pool.get_statistics();
+  ASSERT_EQ(stats.num_mallocs, 2u);
+  ASSERT_EQ(stats.num_frees, 2u);
+
+  pool.free_chunks();
+}
+
+TEST(BasicMemPoolUnitTest, OpenMPMallocFree)
+{
+  TestMemPool pool;
+
+  const int num_iters = 2000;
+  int num_errors = 0;
+
+#pragma omp parallel reduction(+ : num_errors)
+  {
+    const int thread_id = omp_get_thread_num();
+    std::vector<int*> ptrs;
+    for (int i = 0; i < num_iters; ++i) {
+      int* ptr = pool.malloc<int>(1 + i % 300);
+      if (ptr == nullptr) {
+        ++num_errors;
+        continue;
+      }
+      ptr[0] = thread_id;
+      ptrs.push_back(ptr);
+      if (ptrs.size() == 40 || i + 1 == num_iters) {
+        for (int* p : ptrs) {
+          if (p[0] != thread_id) {
+            ++num_errors;
+          }
+          pool.free(p);
+        }
+        ptrs.clear();
+      }
+    }
+  }
+
+  ASSERT_EQ(num_errors, 0);
+
+  RAJA::basic_mempool::MemPoolStatistics stats = pool.get_statistics();
+  ASSERT_EQ(stats.num_mallocs, stats.num_frees);
+  ASSERT_GE(stats.num_mallocs, static_cast<size_t>(num_iters));
+
+  pool.reset_statistics();
+  ASSERT_EQ(pool.get_statistics().num_mallocs, 0u);
+
+  pool.free_chunks();
+}
+#endif
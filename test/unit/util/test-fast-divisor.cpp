@@ -0,0 +1,83 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for FastDivisor
+///
+
+#include <RAJA/RAJA.hpp>
+#include "RAJA_gtest.hpp"
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+template <typename IntegerType>
+void testFastDivisorValue(IntegerType divisor, IntegerType n)
+{
+  RAJA::FastDivisor<IntegerType> d(divisor);
+
+  ASSERT_EQ(d.divisor(), divisor);
+  ASSERT_EQ(n / d, IntegerType(n / divisor));
+  ASSERT_EQ(n % d, IntegerType(n % divisor));
+}
+
+template <typename IntegerType>
+void testFastDivisorTypes()
+{
+  using limits = std::numeric_limits<IntegerType>;
+
+  // small divisors, powers of 2 and their neighbors, and the largest value
+  std::vector<IntegerType> divisors;
+  for (IntegerType d = 1; d < 100; ++d) {
+    divisors.push_back(d);
+  }
+  for (int s = 1; s < limits::digits; ++s) {
+    IntegerType p = IntegerType(1) << s;
+    divisors.push_back(p - 1);
+    divisors.push_back(p);
+    divisors.push_back(p + 1);
+  }
+  divisors.push_back(limits::max());
+
+  std::vector<IntegerType> numerators;
+  for (IntegerType n = 0; n < 1000; ++n) {
+    numerators.push_back(n);
+  }
+  numerators.push_back(limits::max());
+  numerators.push_back(limits::max() - 1);
+  numerators.push_back(limits::max() / 3);
+  if (std::is_signed<IntegerType>::value) {
+    numerators.push_back(IntegerType(-1));
+    numerators.push_back(IntegerType(-1000));
+    numerators.push_back(IntegerType(limits::min() + 1));
+  }
+
+  for (IntegerType d : divisors) {
+    for (IntegerType n : numerators) {
+      testFastDivisorValue<IntegerType>(d, n);
+    }
+    testFastDivisorValue<IntegerType>(d, d - 1);
+    testFastDivisorValue<IntegerType>(d, d);
+  }
+
+  // default constructed divisors divide by 1
+  RAJA::FastDivisor<IntegerType> one;
+  ASSERT_EQ(IntegerType(37) / one, IntegerType(37));
+  ASSERT_EQ(IntegerType(37) % one, IntegerType(0));
+}
+
+
+#define RAJA_FAST_DIVISOR_RUN_TEST(test) \
+  test<int>(); \
+  test<unsigned int>(); \
+  test<long long>(); \
+  test<size_t>();
+
+TEST(FastDivisor, basic_divide_FastDivisor)
+{
+  RAJA_FAST_DIVISOR_RUN_TEST(testFastDivisorTypes)
+}
@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for FirstTouchAllocator and the
+/// fixed static OpenMP schedule
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdint>
+#include <vector>
+
+template <typename ExecPolicy>
+void testAllocateFirstTouch()
+{
+  const size_t sizes[] = {0, 1, 100, 4097, 100000};
+
+  for (size_t n : sizes) {
+    double* ptr = RAJA::allocate_first_touch<double, ExecPolicy>(n);
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) %
+                  RAJA::first_touch_alignment,
+              0u);
+    for (size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(ptr[i], 0.0);
+    }
+    RAJA::free_aligned(ptr);
+  }
+}
+
+template <typename ExecPolicy>
+void testFirstTouchContainers()
+{
+  using alloc = RAJA::FirstTouchAllocator<int, ExecPolicy>;
+
+  std::vector<int, alloc> vec(1000, 3);
+  ASSERT_EQ(vec.size(), 1000u);
+  for (int v : vec) {
+    ASSERT_EQ(v, 3);
+  }
+
+  RAJA::RAJAVec<int, alloc> rvec;
+  for (int i = 0; i < 1000; ++i) {
+    rvec.push_back(i);
+  }
+  ASSERT_EQ(rvec.size(), 1000u);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(rvec[i], i);
+  }
+}
+
+TEST(FirstTouchAllocatorUnitTest, SeqAllocate)
+{
+  testAllocateFirstTouch<RAJA::seq_exec>();
+}
+
+TEST(FirstTouchAllocatorUnitTest, SeqContainers)
+{
+  testFirstTouchContainers<RAJA::seq_exec>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(FirstTouchAllocatorUnitTest, OpenMPAllocate)
+{
+  testAllocateFirstTouch<RAJA::omp_parallel_for_fixed_static_exec>();
+}
+
+TEST(FirstTouchAllocatorUnitTest, OpenMPContainers)
+{
+  testFirstTouchContainers<RAJA::omp_parallel_for_fixed_static_exec>();
+}
+
+TEST(FixedStaticUnitTest, OpenMPThreadMapping)
+{
+  using RAJA::policy::omp::FixedStatic;
+
+  const int num_threads = omp_get_max_threads();
+  const int lens[] = {0, 1, 7, num_threads, 1000, 1001};
+
+  for (int len : lens) {
+    std::vector<int> first(len, -1);
+    std::vector<int> second(len, -1);
+    int* first_ptr = first.data();
+    int* second_ptr = second.data();
+
+    RAJA::forall<RAJA::omp_parallel_for_fixed_static_exec>(
+        RAJA::TypedRangeSegment<int>(0, len),
+        [=](int i) { first_ptr[i] = omp_get_thread_num(); });
+
+    RAJA::forall<RAJA::omp_parallel_exec<RAJA::omp_for_fixed_static_exec>>(
+        RAJA::TypedRangeSegment<int>(0, len),
+        [=](int i) { second_ptr[i] = omp_get_thread_num(); });
+
+    // every loop of the same length maps each iteration to the same thread
+    // as the blocks given by FixedStatic
+    int tid = 0;
+    for (int i = 0; i < len; ++i) {
+      while (i >= FixedStatic::end(len, num_threads, tid)) {
+        ++tid;
+      }
+      ASSERT_GE(i, FixedStatic::begin(len, num_threads, tid));
+      ASSERT_EQ(first[i], tid);
+      ASSERT_EQ(second[i], tid);
+    }
+  }
+}
+#endif
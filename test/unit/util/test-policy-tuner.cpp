@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for tuned_forall policy selection
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/PolicyTuner.hpp"
+
+#include <cstdio>
+#include <vector>
+
+using TunerPolicyList = camp::list<RAJA::seq_exec, RAJA::simd_exec>;
+
+// run the kernel until a policy is selected, checking every result
+static int tuneKernel(const char* name, int len)
+{
+  std::vector<int> data(len);
+  int* d = &data[0];
+
+  RAJA::expt::PolicyTuningEntry* entry =
+      RAJA::expt::getPolicyTuningEntry(name, len, 2);
+
+  int calls = 0;
+  while (RAJA::expt::getTunedPolicy(entry) < 0 && calls < 1000) {
+    RAJA::expt::tuned_forall<TunerPolicyList>(
+        RAJA::TypedRangeSegment<int>(0, len),
+        RAJA::expt::KernelName(name),
+        [=](int i) { d[i] = i + calls; });
+    for (int i = 0; i < len; ++i) {
+      EXPECT_EQ(data[i], i + calls);
+    }
+    ++calls;
+  }
+  return calls;
+}
+
+TEST(PolicyTunerUnitTest, SelectsPolicy)
+{
+  RAJA::expt::resetPolicyTuning();
+
+  const int calls = tuneKernel("tuner_select", 1000);
+  ASSERT_LT(calls, 1000);
+  ASSERT_GE(calls, 2);
+
+  RAJA::expt::PolicyTuningEntry* entry =
+      RAJA::expt::getPolicyTuningEntry("tuner_select", 1000, 2);
+  const int policy = RAJA::expt::getTunedPolicy(entry);
+  ASSERT_GE(policy, 0);
+  ASSERT_LT(policy, 2);
+
+  // lengths in the same power of two bucket share the selection, others
+  // are tuned separately
+  ASSERT_EQ(entry, RAJA::expt::getPolicyTuningEntry("tuner_select", 600, 2));
+  ASSERT_NE(entry, RAJA::expt::getPolicyTuningEntry("tuner_select", 100, 2));
+  ASSERT_NE(entry, RAJA::expt::getPolicyTuningEntry("tuner_other", 1000, 2));
+  ASSERT_EQ(RAJA::expt::getTunedPolicy(
+                RAJA::expt::getPolicyTuningEntry("tuner_select", 100, 2)),
+            -1);
+}
+
+TEST(PolicyTunerUnitTest, SaveAndLoad)
+{
+  RAJA::expt::resetPolicyTuning();
+
+  tuneKernel("tuner_file", 4096);
+
+  RAJA::expt::PolicyTuningEntry* entry =
+      RAJA::expt::getPolicyTuningEntry("tuner_file", 4096, 2);
+  const int policy = RAJA::expt::getTunedPolicy(entry);
+  ASSERT_GE(policy, 0);
+
+  const char* path = "test-policy-tuner.txt";
+  RAJA::expt::savePolicyTuning(path);
+
+  RAJA::expt::resetPolicyTuning();
+  ASSERT_EQ(RAJA::expt::getTunedPolicy(entry), -1);
+
+  RAJA::expt::loadPolicyTuning(path);
+  ASSERT_EQ(RAJA::expt::getTunedPolicy(entry), policy);
+
+  std::remove(path);
+}
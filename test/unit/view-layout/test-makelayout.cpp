@@ -222,6 +222,24 @@ TEST(StaticLayoutUnitTest, 3D_PermutedStaticLayout)
 }
 
 
+TEST(StaticLayoutUnitTest, 3D_PermutedStaticLayoutToIndices)
+{
+  using static_layout = RAJA::StaticLayout<RAJA::PERM_JKI, 7,13,5>;
+
+  // Check that toIndices inverts the layout
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 13; ++j) {
+      for (int k = 0; k < 5; ++k) {
+        int ii, jj, kk;
+        static_layout::toIndices(static_layout::s_oper(i,j,k), ii, jj, kk);
+        ASSERT_EQ(ii, i);
+        ASSERT_EQ(jj, j);
+        ASSERT_EQ(kk, k);
+      }
+    }
+  }
+}
+
 TEST(StaticLayoutUnitTest, 4D_PermutedStaticLayout)
 {
   auto dynamic_layout = 
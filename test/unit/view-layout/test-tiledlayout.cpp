@@ -0,0 +1,196 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <vector>
+
+#include "RAJA_test-base.hpp"
+
+using namespace RAJA;
+
+RAJA_INDEX_VALUE(TTX, "TTX");
+RAJA_INDEX_VALUE(TTY, "TTY");
+
+TEST(TiledLayout, 2D)
+{
+  /*
+   * 10 x 13 with 4 x 4 tiles, so 3 x 4 tiles of 16
+   */
+  TiledLayout<2, 4> layout(10, 13);
+
+  ASSERT_EQ(layout.size(), 3 * 4 * 16);
+  ASSERT_EQ(layout.size_noproj(), 10 * 13);
+  ASSERT_EQ(layout.get_dim_size<0>(), 10);
+  ASSERT_EQ(layout.get_dim_size<1>(), 13);
+
+  // first tile is row major
+  ASSERT_EQ(layout(0, 0), 0);
+  ASSERT_EQ(layout(0, 1), 1);
+  ASSERT_EQ(layout(1, 0), 4);
+  ASSERT_EQ(layout(3, 3), 15);
+
+  // next tile in each dimension
+  ASSERT_EQ(layout(0, 4), 16);
+  ASSERT_EQ(layout(4, 0), 4 * 16);
+  ASSERT_EQ(layout(9, 12), (2 * 4 + 3) * 16 + 1 * 4 + 0);
+
+  // every index has a distinct entry, and toIndices is the inverse
+  std::vector<int> seen(layout.size(), 0);
+  for (Index_type i = 0; i < 10; ++i) {
+    for (Index_type j = 0; j < 13; ++j) {
+      Index_type lin = layout(i, j);
+      ASSERT_LT(lin, layout.size());
+      ASSERT_EQ(seen[lin], 0);
+      seen[lin] = 1;
+
+      Index_type ii, jj;
+      layout.toIndices(lin, ii, jj);
+      ASSERT_EQ(ii, i);
+      ASSERT_EQ(jj, j);
+    }
+  }
+}
+
+TEST(TiledLayout, 3D)
+{
+  TiledLayout<3, 2, int> layout(3, 4, 5);
+
+  ASSERT_EQ(layout.size(), 2 * 2 * 3 * 8);
+
+  std::vector<int> seen(layout.size(), 0);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      for (int k = 0; k < 5; ++k) {
+        int lin = layout(i, j, k);
+        ASSERT_EQ(lin,
+                  ((i / 2) * 2 * 3 + (j / 2) * 3 + (k / 2)) * 8 +
+                      (i % 2) * 4 + (j % 2) * 2 + (k % 2));
+        ASSERT_EQ(seen[lin], 0);
+        seen[lin] = 1;
+
+        int ii, jj, kk;
+        layout.toIndices(lin, ii, jj, kk);
+        ASSERT_EQ(ii, i);
+        ASSERT_EQ(jj, j);
+        ASSERT_EQ(kk, k);
+      }
+    }
+  }
+}
+
+TEST(MortonLayout, 2D)
+{
+  MortonLayout<2> layout(4, 4);
+
+  ASSERT_EQ(layout.size(), 16);
+
+  // bits interleave with the last dimension lowest
+  ASSERT_EQ(layout(0, 1), 1);
+  ASSERT_EQ(layout(1, 0), 2);
+  ASSERT_EQ(layout(1, 1), 3);
+  ASSERT_EQ(layout(0, 2), 4);
+  ASSERT_EQ(layout(1, 2), 6);
+  ASSERT_EQ(layout(3, 3), 15);
+
+  for (Index_type lin = 0; lin < layout.size(); ++lin) {
+    Index_type i, j;
+    layout.toIndices(lin, i, j);
+    ASSERT_EQ(layout(i, j), lin);
+  }
+}
+
+TEST(MortonLayout, 3DNonPowerOf2)
+{
+  /*
+   * 5 x 2 x 9 needs 3, 1, and 4 bits, dimensions that run out of bits
+   * are skipped so the storage is 2^8
+   */
+  MortonLayout<3, int> layout(5, 2, 9);
+
+  ASSERT_EQ(layout.size(), 256);
+  ASSERT_EQ(layout.size_noproj(), 5 * 2 * 9);
+
+  // k gets bits 0, 3, 5, 7, j gets bit 1, and i gets bits 2, 4, 6
+  ASSERT_EQ(layout(0, 0, 8), 128);
+  ASSERT_EQ(layout(0, 1, 0), 2);
+  ASSERT_EQ(layout(4, 0, 0), 64);
+
+  std::vector<int> seen(layout.size(), 0);
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 2; ++j) {
+      for (int k = 0; k < 9; ++k) {
+        int lin = layout(i, j, k);
+        ASSERT_LT(lin, layout.size());
+        ASSERT_EQ(seen[lin], 0);
+        seen[lin] = 1;
+
+        int ii, jj, kk;
+        layout.toIndices(lin, ii, jj, kk);
+        ASSERT_EQ(ii, i);
+        ASSERT_EQ(jj, j);
+        ASSERT_EQ(kk, k);
+      }
+    }
+  }
+}
+
+TEST(TiledLayout, View)
+{
+  constexpr int N = 11;
+  constexpr int M = 6;
+
+  std::vector<double> a_data(N * M);
+  for (int i = 0; i < N * M; ++i) {
+    a_data[i] = i;
+  }
+  View<double, Layout<2>> a(a_data.data(), N, M);
+
+  TiledLayout<2, 4> tiled(N, M);
+  std::vector<double> b_data(tiled.size(), -1.0);
+  View<double, TiledLayout<2, 4>> b(b_data.data(), tiled);
+
+  MortonLayout<2> morton(N, M);
+  std::vector<double> c_data(morton.size(), -1.0);
+  View<double, MortonLayout<2>> c(c_data.data(), morton);
+
+  copy_view<seq_exec>(b, a);
+  copy_view<seq_exec>(c, b);
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      ASSERT_EQ(b(i, j), a(i, j));
+      ASSERT_EQ(c(i, j), a(i, j));
+    }
+  }
+
+  // padding is not written
+  ASSERT_EQ(b_data[tiled(0, M)], -1.0);
+
+  // and back to strided storage
+  std::vector<double> d_data(N * M, -1.0);
+  View<double, Layout<2>> d(d_data.data(), N, M);
+  copy_view<seq_exec>(d, c);
+
+  for (int i = 0; i < N * M; ++i) {
+    ASSERT_EQ(d_data[i], a_data[i]);
+  }
+}
+
+TEST(TiledLayout, TypedView)
+{
+  std::vector<Index_type> data(TiledLayout<2, 8>(20, 20).size());
+  TypedView<Index_type, TiledLayout<2, 8>, TTX, TTY> view(data.data(), 20, 20);
+
+  for (Index_type i = 0; i < 20; ++i) {
+    for (Index_type j = 0; j < 20; ++j) {
+      view(TTX(i), TTY(j)) = i * 20 + j;
+    }
+  }
+
+  // second row of the second tile
+  ASSERT_EQ(data[64 + 8 + 1], 1 * 20 + 9);
+  ASSERT_EQ(view(TTX(19), TTY(19)), 19 * 20 + 19);
+}